@@ -165,6 +165,68 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall, sends a distinct block of \c nelem
+ * elements to every unit in the team.
+ * Block \c i in \c sendbuf is sent to unit \c i, the block received
+ * from unit \c i is stored at block \c i in \c recvbuf.
+ * Blocks exceeding \c INT_MAX elements are transferred in chunks.
+ *
+ * \param sendbuf The buffer containing \c nelem elements for every unit,
+ *                or \c recvbuf or \c NULL to exchange blocks in-place.
+ * \param recvbuf The buffer to hold \c nelem elements from every unit.
+ * \param nelem   Number of elements sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param teamid  The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv, sends a distinct number of elements
+ * to every unit in the team.
+ * Counts and displacements are not limited to \c INT_MAX elements,
+ * larger transfers are performed in chunks.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to the
+ *                    units, or \c recvbuf or \c NULL to exchange in-place.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit, ignored for in-place exchange.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf, ignored for in-place
+ *                    exchange.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -213,6 +275,59 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Scan, computes the inclusive prefix reduction of
+ * the values in \c sendbuf over all units in the team, in the order of
+ * their ids.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the element-wise
+ *                reduction of the values of units \c 0 to \c myid.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_scan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Exscan, computes the exclusive prefix reduction
+ * of the values in \c sendbuf over all units in the team, in the order of
+ * their ids.
+ * The content of \c recvbuf at unit \c 0 is undefined.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the element-wise
+ *                reduction of the values of units \c 0 to \c myid-1.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -619,6 +734,112 @@ dart_ret_t dart_testall_local(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations
+ * Collective operations that return a handle to be completed using
+ * \c dart_wait, \c dart_test_local and the like.
+ * Buffers passed to these operations must not be accessed before the
+ * operation completed.
+ * Non-blocking collective operations must be started in the same order
+ * at all units in the team.
+ */
+
+/** \{ */
+
+/**
+ * Non-blocking variant of \c dart_barrier.
+ * The barrier is complete once all units in the team have entered it.
+ *
+ * \param team       The team to participate in the barrier.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                   with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_bcast.
+ *
+ * \param buf        The buffer to send from on the root unit and to
+ *                   receive into on all other units.
+ * \param nelem      The number of elements of type \c dtype in \c buf.
+ * \param dtype      The data type of values in \c buf.
+ * \param root       The unit broadcasting the values.
+ * \param team       The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                   with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allreduce.
+ *
+ * \param sendbuf    The buffer containing the data to be sent by each unit.
+ * \param recvbuf    The buffer to hold the received data.
+ * \param nelem      Number of elements sent by each unit.
+ * \param dtype      The data type of values in \c sendbuf and \c recvbuf.
+ * \param op         The reduction operation to perform.
+ * \param team       The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                   with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allgather.
+ *
+ * \param sendbuf    The buffer containing the data to be sent by each unit.
+ * \param recvbuf    The buffer to hold the received data of all units.
+ * \param nelem      Number of elements sent by each unit.
+ * \param dtype      The data type of values in \c sendbuf and \c recvbuf.
+ * \param team       The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                   with \c dart_wait, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -677,6 +898,211 @@ dart_ret_t dart_put_blocking(
 /** \} */
 
 
+/**
+ * \name Notified single-sided communication operations
+ * Point-to-point synchronization of producers and consumers: a put
+ * increments a notification counter at the target once its data is
+ * visible, the target waits for or tests the counter.
+ */
+
+/** \{ */
+
+/**
+ * The number of notification counters of every unit in a team.
+ *
+ * \ingroup DartCommunication
+ */
+#define DART_NOTIFY_NUM_IDS 64
+
+/**
+ * 'BLOCKING' variant of \ref dart_put that increments notification counter
+ * \c notify_id of the target unit in the team of \c gptr after the data
+ * has been written to the target.
+ * Returns after the notification has been delivered.
+ *
+ * \param gptr       Global pointer being the target of the data transfer.
+ * \param src        Local source memory to transfer data from.
+ * \param nelem      The number of elements of type \c dtype to transfer.
+ * \param src_type   The data type of the values in buffer \c src.
+ * \param dst_type   The data type of the values at the target.
+ * \param notify_id  The notification counter to increment at the target,
+ *                   less than \ref DART_NOTIFY_NUM_IDS.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  int               notify_id) DART_NOTHROW;
+
+/**
+ * Wait until notification counter \c notify_id of the calling unit in
+ * team \c teamid has been incremented \c count times and consume these
+ * notifications, i.e. decrement the counter by \c count.
+ * Data of the corresponding calls to \ref dart_put_notify is visible
+ * when the call returns.
+ *
+ * \param teamid     The team the notifications are received in.
+ * \param notify_id  The notification counter to wait for.
+ * \param count      The number of notifications to consume.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_notify_wait(
+  dart_team_t       teamid,
+  int               notify_id,
+  uint64_t          count) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_notify_wait, consumes \c count
+ * notifications if they have been received.
+ *
+ * \param teamid     The team the notifications are received in.
+ * \param notify_id  The notification counter to test.
+ * \param count      The number of notifications to consume.
+ * \param[out] flag  1 if the notifications have been consumed,
+ *                   0 otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_notify_test(
+  dart_team_t       teamid,
+  int               notify_id,
+  uint64_t          count,
+  int32_t         * flag) DART_NOTHROW;
+
+/** \} */
+
+
+/**
+ * \name Vectored single-sided communication operations
+ * Transfers of lists of scattered elements, e.g. for indirect accesses to
+ * a distributed container. Transfers to the same unit are combined into a
+ * single message.
+ */
+
+/** \{ */
+
+/**
+ * 'BLOCKING' transfer of \c count blocks of data, block \c i consisting
+ * of \c nelem[i] elements of basic type \c dtype from \c gptrs[i] to the
+ * local buffer \c dest[i].
+ * Blocks in the same segment of the same unit are transferred in a single
+ * operation. Both local and remote completion is guaranteed.
+ *
+ * \param dest      Local target memory of every block.
+ * \param gptrs     Global pointers to the source of every block.
+ * \param nelem     The number of elements in every block, or \c NULL if
+ *                  every block consists of a single element.
+ * \param count     The number of blocks.
+ * \param dtype     The basic data type of the elements.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_getv(
+  void              * const dest[],
+  const dart_gptr_t         gptrs[],
+  const size_t              nelem[],
+  size_t                    count,
+  dart_datatype_t           dtype) DART_NOTHROW;
+
+/**
+ * 'BLOCKING' transfer of \c count blocks of data, block \c i consisting
+ * of \c nelem[i] elements of basic type \c dtype from the local buffer
+ * \c src[i] to \c gptrs[i].
+ * Blocks in the same segment of the same unit are transferred in a single
+ * operation and must not overlap. Both local and remote completion is
+ * guaranteed.
+ *
+ * \param gptrs     Global pointers to the target of every block.
+ * \param src       Local source memory of every block.
+ * \param nelem     The number of elements in every block, or \c NULL if
+ *                  every block consists of a single element.
+ * \param count     The number of blocks.
+ * \param dtype     The basic data type of the elements.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_putv(
+  const dart_gptr_t         gptrs[],
+  const void        * const src[],
+  const size_t              nelem[],
+  size_t                    count,
+  dart_datatype_t           dtype) DART_NOTHROW;
+
+/** \} */
+
+
+/**
+ * \name Aggregation of small single-sided operations
+ * Buffering of fine-grained puts and accumulates to amortize the overhead
+ * of individual transfers.
+ */
+
+/** \{ */
+
+/**
+ * Enable aggregation of small puts and accumulates issued by the calling
+ * thread until the matching call of \ref dart_aggregation_end in the same
+ * thread. Operations of other threads are not buffered.
+ * Calls can be nested, aggregation remains enabled until the outermost
+ * call of \ref dart_aggregation_end.
+ *
+ * While aggregation is enabled, \ref dart_put, \ref dart_put_blocking and
+ * \ref dart_accumulate of at most 256 bytes of a basic type to a unit
+ * that is not accessible through shared memory are buffered per target
+ * unit and packed into a single transfer when the buffer is full
+ * (see \c dart_config_t::aggregation_buffer_size) or on any of
+ * \ref dart_flush, \ref dart_flush_local, \ref dart_flush_all,
+ * \ref dart_flush_local_all, \ref dart_barrier and the outermost
+ * \ref dart_aggregation_end.
+ * Completion of a buffered \ref dart_put_blocking is deferred accordingly.
+ * Other operations on a target unit issue the operations buffered for the
+ * unit first, reads additionally wait for their completion.
+ *
+ * This operation is not collective.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_begin() DART_NOTHROW;
+
+/**
+ * Disable aggregation of small puts and accumulates enabled by
+ * \ref dart_aggregation_begin. Leaving the outermost aggregation region
+ * guarantees local and remote completion of all buffered operations.
+ *
+ * \return \c DART_OK on success, \c DART_ERR_INVAL if aggregation is not
+ *         enabled in the calling thread.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_end() DART_NOTHROW;
+
+/** \} */
+
+
 /**
  * \name Blocking two-sided communication operations
  * These operations will block until the operation is finished,
@@ -25,6 +25,11 @@ extern "C" {
  * Lock type to ensure mutual exclusion among units in a team.
  * The lock is thread-aware so only one thread of a unit can acquire
  * the lock at once.
+ *
+ * The lock can either be held exclusively by a single unit or in shared
+ * mode by any number of units.
+ * Units on the same node pass the lock among each other before it is
+ * handed over to units on other nodes.
  * \ingroup DartSync
  */
 typedef struct dart_lock_struct *dart_lock_t;
@@ -108,6 +113,54 @@ dart_ret_t dart_lock_try_acquire(
 dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
+/**
+ * Block until the \c lock was acquired in shared mode.
+ *
+ * Any number of units can hold the lock in shared mode at the same time
+ * while no unit holds it exclusively.
+ * Units waiting to acquire the lock exclusively do not take precedence:
+ * units may keep acquiring the lock in shared mode while other units on
+ * their node hold it in shared mode.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_acquire_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the lock in shared mode and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_shared(
+  dart_lock_t   lock,
+  int32_t     * result) DART_NOTHROW;
+
+/**
+ * Release the lock acquired through \ref dart_lock_acquire_shared or
+ * \ref dart_lock_try_acquire_shared.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_release_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
 
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
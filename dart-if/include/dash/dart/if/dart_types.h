@@ -11,6 +11,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,37 +60,56 @@ enum {
 
 /**
  * Operations to be used for certain RMA and collective operations.
+ *
+ * Values smaller than \ref DART_OP_LAST denote predefined operations,
+ * user-defined operations are created using \ref dart_op_create.
+ *
  * \ingroup DartTypes
  */
-typedef enum
-{
-  /** Undefined, do not use */
-  DART_OP_UNDEFINED = 0,
-  /** Minimum */
-  DART_OP_MIN,
-  /** Maximum */
-  DART_OP_MAX,
-  /** Summation */
-  DART_OP_SUM,
-  /** Product */
-  DART_OP_PROD,
-  /** Binary AND */
-  DART_OP_BAND,
-  /** Logical AND */
-  DART_OP_LAND,
-  /** Binary OR */
-  DART_OP_BOR,
-  /** Logical OR */
-  DART_OP_LOR,
-  /** Binary XOR */
-  DART_OP_BXOR,
-  /** Logical XOR */
-  DART_OP_LXOR,
-  /** Replace Value */
-  DART_OP_REPLACE,
-  /** No operation */
-  DART_OP_NO_OP
-} dart_operation_t;
+typedef intptr_t dart_operation_t;
+
+/** Undefined, do not use */
+#define DART_OP_UNDEFINED (dart_operation_t)(0)
+/** Minimum */
+#define DART_OP_MIN       (dart_operation_t)(1)
+/** Maximum */
+#define DART_OP_MAX       (dart_operation_t)(2)
+/** Summation */
+#define DART_OP_SUM       (dart_operation_t)(3)
+/** Product */
+#define DART_OP_PROD      (dart_operation_t)(4)
+/** Binary AND */
+#define DART_OP_BAND      (dart_operation_t)(5)
+/** Logical AND */
+#define DART_OP_LAND      (dart_operation_t)(6)
+/** Binary OR */
+#define DART_OP_BOR       (dart_operation_t)(7)
+/** Logical OR */
+#define DART_OP_LOR       (dart_operation_t)(8)
+/** Binary XOR */
+#define DART_OP_BXOR      (dart_operation_t)(9)
+/** Logical XOR */
+#define DART_OP_LXOR      (dart_operation_t)(10)
+/** Replace Value */
+#define DART_OP_REPLACE   (dart_operation_t)(11)
+/** No operation */
+#define DART_OP_NO_OP     (dart_operation_t)(12)
+/** Reserved, do not use */
+#define DART_OP_LAST      (dart_operation_t)(13)
+
+/**
+ * Signature of user-defined reduction operators, see \ref dart_op_create.
+ * The operator combines \c len elements in \c invec and \c inoutvec
+ * element-wise and stores the results in \c inoutvec, i.e.
+ * <tt>inoutvec[i] = invec[i] op inoutvec[i]</tt>.
+ *
+ * \ingroup DartTypes
+ */
+typedef void (*dart_operator_t)(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata);
 
 /**
  * Raw data types supported by the DART interface.
@@ -686,7 +706,62 @@ dart_unit_locality_t;
  */
 typedef struct
 {
-  int log_enabled;
+  int    log_enabled;
+  /**
+   * Size of the symmetric heap of every team per unit in bytes, small
+   * collective allocations are served from the heap of their team.
+   * Applies to teams created afterwards, 0 disables the heap.
+   * Can be set with environment variable \c DART_TEAM_HEAP_SIZE.
+   */
+  size_t team_heap_size;
+  /**
+   * Size of the buffer of small puts and accumulates per target unit in
+   * bytes while aggregation is enabled, see \ref dart_aggregation_begin.
+   * Can be set with environment variable \c DART_AGGREGATION_BUFFER_SIZE.
+   */
+  size_t aggregation_buffer_size;
+  /**
+   * Whether atomic operations on basic types are applied using processor
+   * atomics on memory that all units of the team can access through
+   * shared memory. Only valid if the memory is not accessed concurrently
+   * by means other than DART atomic operations.
+   * Applies to teams created afterwards, disabled by default.
+   * Can be enabled with environment variable \c DART_LOCAL_ATOMICS=1.
+   */
+  int    local_atomics;
+  /**
+   * Whether a progress thread is started in \c dart_init that polls MPI
+   * so that non-blocking operations complete while the application
+   * computes. Requires \c MPI_THREAD_MULTIPLE, i.e. DART built with
+   * thread support and initialized with \c dart_init_thread.
+   * Can be enabled with environment variable \c DART_PROGRESS_THREAD=1.
+   */
+  int    progress_thread;
+  /**
+   * Interval in microseconds between two polls of the progress thread,
+   * 0 polls continuously.
+   * Can be set with environment variable \c DART_PROGRESS_INTERVAL.
+   */
+  int    progress_interval;
+  /**
+   * The CPU the progress thread is pinned to, the last CPU available to
+   * the process if negative.
+   * Can be set with environment variable \c DART_PROGRESS_CPU.
+   */
+  int    progress_cpu;
+  /**
+   * Size of the memory pool per unit in bytes that \c dart_memalloc
+   * allocates from.
+   * Can be set with environment variable \c DART_LOCAL_ALLOC_SIZE.
+   */
+  size_t local_alloc_size;
+  /**
+   * Whether \c dart_memalloc uses the buddy allocator of earlier versions
+   * instead of the size-class allocator, which rounds requests up to the
+   * next power of two.
+   * Can be enabled with environment variable \c DART_LOCAL_ALLOC_BUDDY=1.
+   */
+  int    local_alloc_buddy;
 }
 dart_config_t;
 
@@ -753,6 +828,68 @@ dart_type_create_indexed(
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type);
 
+/**
+ * Create a contiguous data type of \c num_bytes bytes, e.g. to represent
+ * a struct in collective reductions with user-defined operations.
+ * Elements of the resulting type are never split in transfers.
+ *
+ * \param      num_bytes  The size of a single element in bytes.
+ * \param[out] newtype    The newly created data type.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_create_custom(
+  size_t            num_bytes,
+  dart_datatype_t * newtype);
+
+/**
+ * Create a user-defined reduction operation on elements of type \c dtype
+ * that can be used in the collective reduction operations
+ * \ref dart_allreduce, \ref dart_reduce, \ref dart_scan,
+ * \ref dart_exscan and \ref dart_iallreduce.
+ * User-defined operations cannot be used in RMA operations such as
+ * \ref dart_accumulate.
+ *
+ * Collective reductions using the operation have to be called with data
+ * type \c dtype.
+ *
+ * \param      op        The operator applied to elements of type \c dtype.
+ * \param      userdata  Pointer passed to every invocation of \c op.
+ * \param      commute   Whether the operation is commutative. Operands of
+ *                       non-commutative operations are combined in
+ *                       ascending order of unit IDs.
+ * \param      dtype     The type of the elements the operation is
+ *                       applied to.
+ * \param[out] new_op    The newly created operation.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op);
+
+/**
+ * Destroy an operation that was previously created using
+ * \ref dart_op_create.
+ *
+ * \param      op  The operation to be destroyed.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_op_destroy(dart_operation_t *op);
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
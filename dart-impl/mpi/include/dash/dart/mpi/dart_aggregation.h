@@ -0,0 +1,159 @@
+#ifndef DART__MPI__DART_AGGREGATION_H__
+#define DART__MPI__DART_AGGREGATION_H__
+
+#include <mpi.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * \file dart_aggregation.h
+ *
+ * Aggregation of small puts and accumulates.
+ *
+ * While aggregation is enabled in a thread (see
+ * \ref dart_aggregation_begin), small
+ * puts and accumulates to units that are not reachable through shared
+ * memory are copied into a buffer of their target unit instead of being
+ * issued individually. Buffered operations are packed into a single
+ * transfer per window, data type and operation using an indexed MPI type
+ * at the target when the buffer is full or completion is requested.
+ */
+
+/**
+ * The maximum size in bytes of a single put or accumulate that is
+ * buffered, larger transfers are issued immediately.
+ */
+#define DART_AGGREGATION_MAX_MSG_SIZE 256
+
+/**
+ * Default size in bytes of the buffer of a target unit.
+ */
+#define DART_AGGREGATION_DEFAULT_BUFFER_SIZE (64 * 1024)
+
+struct dart_team_data;
+
+typedef struct dart_aggregation_entry {
+  MPI_Win        win;
+  MPI_Aint       disp;
+  MPI_Datatype   mpi_type;
+  /// the accumulate operation, \c MPI_OP_NULL for puts
+  MPI_Op         mpi_op;
+  int            count;
+  /// offset of the origin values in the data buffer
+  size_t         data_offs;
+} dart_aggregation_entry_t;
+
+typedef struct dart_aggregation_buffer {
+  dart_aggregation_entry_t * entries;
+  int                        num_entries;
+  int                        max_entries;
+  char                     * data;
+  size_t                     data_size;
+  size_t                     data_capacity;
+} dart_aggregation_buffer_t;
+
+typedef struct dart_aggregation {
+  /// buffers of all units in the team, allocated on first use
+  dart_aggregation_buffer_t * buffers;
+  int                         num_buffers;
+  /// units with buffered operations
+  int                       * pending;
+  int                         num_pending;
+} dart_aggregation_t;
+
+#ifdef DART_ENABLE_THREADSUPPORT
+#define DART_AGGREGATION_THREAD_LOCAL __thread
+#else
+#define DART_AGGREGATION_THREAD_LOCAL
+#endif
+
+/**
+ * Nesting depth of aggregation regions and buffer threshold of the calling
+ * thread. Aggregation is enabled per thread, puts of other threads are not
+ * buffered while a thread is in an aggregation region.
+ */
+extern DART_AGGREGATION_THREAD_LOCAL int
+  dart__mpi__aggregation_depth DART_INTERNAL;
+extern DART_AGGREGATION_THREAD_LOCAL size_t
+  dart__mpi__aggregation_threshold DART_INTERNAL;
+
+/**
+ * Whether a transfer of \c nbytes by the calling thread is buffered.
+ */
+static inline
+bool dart__mpi__aggregation_applies(size_t nbytes)
+{
+  return (dart__mpi__aggregation_depth > 0 &&
+          nbytes > 0 &&
+          nbytes <= DART_AGGREGATION_MAX_MSG_SIZE &&
+          nbytes <= dart__mpi__aggregation_threshold);
+}
+
+/**
+ * Whether operations to \c unit are buffered.
+ *
+ * May be called without holding the aggregation mutex as a hint on the
+ * communication paths: \c buffers and \c num_entries are only accessed
+ * atomically, operations buffered by the calling thread are always seen.
+ * Buffers must be issued with \c dart__mpi__aggregation_issue, which
+ * repeats the check under the mutex.
+ */
+static inline
+bool dart__mpi__aggregation_pending(
+  const dart_aggregation_t * aggregation,
+  dart_team_unit_t           unit)
+{
+  const dart_aggregation_buffer_t *buffers =
+    __atomic_load_n(&aggregation->buffers, __ATOMIC_ACQUIRE);
+  return (buffers != NULL &&
+          __atomic_load_n(&buffers[unit.id].num_entries,
+                          __ATOMIC_RELAXED) > 0);
+}
+
+/**
+ * Buffers a put (\c mpi_op is \c MPI_OP_NULL) or accumulate of \c count
+ * values of type \c mpi_type to displacement \c disp in window \c win of
+ * \c unit. The buffer of \c unit is issued first if \c src does not fit.
+ */
+dart_ret_t
+dart__mpi__aggregation_add(
+  struct dart_team_data * team_data,
+  dart_team_unit_t        unit,
+  MPI_Win                 win,
+  MPI_Aint                disp,
+  const void            * src,
+  int                     count,
+  MPI_Datatype            mpi_type,
+  size_t                  type_size,
+  MPI_Op                  mpi_op) DART_INTERNAL;
+
+/**
+ * Issues the operations buffered for \c unit. The buffered operations are
+ * completed locally, \c complete additionally guarantees their remote
+ * completion.
+ */
+dart_ret_t
+dart__mpi__aggregation_issue(
+  struct dart_team_data * team_data,
+  dart_team_unit_t        unit,
+  bool                    complete) DART_INTERNAL;
+
+/**
+ * Issues the operations buffered for all units in the team.
+ */
+dart_ret_t
+dart__mpi__aggregation_issue_all(
+  struct dart_team_data * team_data,
+  bool                    complete) DART_INTERNAL;
+
+/**
+ * Releases the buffers of a team, buffered operations are discarded.
+ */
+void
+dart__mpi__aggregation_fini(
+  dart_aggregation_t * aggregation) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_AGGREGATION_H__ */
@@ -12,6 +12,7 @@
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -49,11 +50,21 @@ typedef struct dart_datatype_struct {
       MPI_Datatype     max_type;
     } basic;
     /// used for DART_KIND_STRIDED
-    /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    /// NOTE: the underlying MPI strided type depends on the number of blocks
+    ///       transferred, it is created on first use for a number of blocks
+    ///       and cached until the DART type is destroyed.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
+      /// committed MPI vector types by number of blocks
+      struct dart_strided_cache_entry {
+        size_t         num_blocks;
+        MPI_Datatype   mpi_type;
+      }              * cache;
+      int              cache_size;
+      int              cache_capacity;
+      /// protects the cache
+      dart_mutex_t     cache_mutex;
     } strided;
     /// used for DART_KIND_INDEXED
     struct {
@@ -79,6 +90,25 @@ dart__mpi__datatype_init() DART_INTERNAL;
 dart_ret_t
 dart__mpi__datatype_fini() DART_INTERNAL;
 
+typedef struct dart_operation_struct {
+  /// the underlying MPI operation
+  MPI_Op               mpi_op;
+  /// duplicate of the MPI type of \c dtype carrying this operation as
+  /// attribute, used in all collectives with this operation
+  MPI_Datatype         mpi_type;
+  /// the type of elements this operation is applied to
+  dart_datatype_t      dtype;
+  /// the user-defined operator
+  dart_operator_t      op;
+  /// user data passed to \c op
+  void               * userdata;
+} dart_operation_struct_t;
+
+DART_INLINE
+bool dart__mpi__op_isbasic(dart_operation_t dart_op) {
+  return (dart_op < DART_OP_LAST);
+}
+
 DART_INLINE MPI_Op dart__mpi__op(dart_operation_t dart_op) {
   switch (dart_op) {
     case DART_OP_MIN     : return MPI_MIN;
@@ -93,7 +123,10 @@ DART_INLINE MPI_Op dart__mpi__op(dart_operation_t dart_op) {
     case DART_OP_LXOR    : return MPI_LXOR;
     case DART_OP_REPLACE : return MPI_REPLACE;
     case DART_OP_NO_OP   : return MPI_NO_OP;
-    default              : return (MPI_Op)(-1);
+    default              :
+      return (!dart__mpi__op_isbasic(dart_op))
+               ? ((dart_operation_struct_t *)dart_op)->mpi_op
+               : (MPI_Op)(-1);
   }
 }
 
@@ -154,14 +187,17 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Returns the committed MPI type of \c num_blocks blocks of the strided
+ * type \c dart_type. The MPI type is owned by \c dart_type and must not be
+ * freed by the caller. Returns \c MPI_DATATYPE_NULL if the type could not
+ * be created.
+ */
 MPI_Datatype
-dart__mpi__create_strided_mpi(
+dart__mpi__strided_mpi_type(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
-
 DART_INLINE
 void
 dart__mpi__datatype_convert_mpi(
@@ -178,7 +214,7 @@ dart__mpi__datatype_convert_mpi(
       break;
     case DART_KIND_STRIDED:
       *mpi_num_elem = 1;
-      *mpi_type     = dart__mpi__create_strided_mpi(
+      *mpi_type     = dart__mpi__strided_mpi_type(
                                       dart_type, dart_num_elem / dts->num_elem);
       break;
     case DART_KIND_INDEXED:
@@ -193,6 +229,23 @@ dart__mpi__datatype_convert_mpi(
 
 char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
 
+/**
+ * The MPI type to use in a collective reduction with operation
+ * \c dart_op on elements of type \c dart_type, or \c MPI_DATATYPE_NULL if
+ * \c dart_op is a user-defined operation on a different type.
+ */
+DART_INLINE
+MPI_Datatype dart__mpi__op_datatype(
+  dart_operation_t dart_op,
+  dart_datatype_t  dart_type)
+{
+  if (dart__mpi__op_isbasic(dart_op)) {
+    return dart__mpi__datatype_struct(dart_type)->basic.mpi_type;
+  }
+  dart_operation_struct_t *dos = (dart_operation_struct_t *)dart_op;
+  return (dos->dtype == dart_type) ? dos->mpi_type : MPI_DATATYPE_NULL;
+}
+
 /**
  * Helper macro that checks whether the given type is a basic type
  * and errors out in case of an error.
@@ -210,5 +263,40 @@ char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
     }                                                                         \
   } while (0)
 
+/**
+ * Helper macro that checks whether the given operation is a predefined
+ * operation and errors out in case of an error.
+ */
+#define CHECK_IS_BASICOP(_op) \
+  do {                                                                        \
+    if (dart__unlikely(!dart__mpi__op_isbasic(_op))) {                        \
+      DART_LOG_ERROR(                                                         \
+                 "%s ! Only predefined operations allowed in this operation", \
+                 __FUNCTION__);                                               \
+      return DART_ERR_INVAL;                                                  \
+    }                                                                         \
+  } while (0)
+
+/**
+ * Releases the handles cached for reuse by non-blocking operations.
+ */
+void
+dart__mpi__handle_pool_fini() DART_INTERNAL;
+
+struct dart_team_data;
+
+/**
+ * Allocates the window of notification counters of a team, see
+ * \ref dart_put_notify. Collective on the team.
+ */
+dart_ret_t
+dart__mpi__notify_init(struct dart_team_data *team_data) DART_INTERNAL;
+
+/**
+ * Frees the window of notification counters of a team.
+ * Collective on the team.
+ */
+dart_ret_t
+dart__mpi__notify_fini(struct dart_team_data *team_data) DART_INTERNAL;
 
 #endif /* DART_ADAPT_COMMUNICATION_PRIV_H_INCLUDED */
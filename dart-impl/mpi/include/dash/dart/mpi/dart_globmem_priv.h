@@ -2,9 +2,17 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/mpi/dart_team_private.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * Release the symmetric heap of a team and the window segment holding its
+ * memory. Collective on the team, to be called before the team is
+ * destroyed.
+ */
+void dart__mpi__team_heap_release(dart_team_data_t *team_data) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
@@ -0,0 +1,104 @@
+#ifndef DART__MPI__DART_LOCAL_ATOMICS_H__
+#define DART__MPI__DART_LOCAL_ATOMICS_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+/**
+ * \file dart_local_atomics.h
+ *
+ * Atomic operations on node-local memory using processor atomics.
+ *
+ * If enabled (see \c dart_config_t::local_atomics), accumulates, fetch-and-op
+ * and compare-and-swap operations on basic types are applied directly on
+ * memory that every unit in the team can access through shared memory
+ * instead of being issued through MPI.
+ * Processor atomics and MPI atomics are not atomic with respect to each
+ * other, the fast path is therefore only taken if no unit in the team has
+ * to resort to MPI for the target memory, i.e. if all units in the team
+ * share the node or the team consists of a single unit.
+ * Accesses to the memory other than through DART atomics (e.g., MPI
+ * accumulates issued by the application) are not synchronized.
+ */
+
+/**
+ * Returns the address of \c offset in the segment \c seginfo of \c unit if
+ * atomics on it are applied using processor atomics, \c NULL otherwise.
+ */
+static inline
+char *
+dart__mpi__local_atomics_addr(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  dart_team_unit_t            unit,
+  uint64_t                    offset)
+{
+  if (dart__likely(!team_data->local_atomics)) {
+    return NULL;
+  }
+  if (team_data->size == 1) {
+    return seginfo->selfbaseptr + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 &&
+      team_data->sharedmem_nodesize == team_data->size) {
+    if (unit.id == team_data->unitid) {
+      return seginfo->selfbaseptr + offset;
+    }
+    if (seginfo->baseptr != NULL) {
+      dart_team_unit_t luid = team_data->sharedmem_tab[unit.id];
+      return seginfo->baseptr[luid.id] + offset;
+    }
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return NULL;
+}
+
+/**
+ * Atomically applies \c op with \c value to the element of type \c dtype
+ * at \c addr and stores the previous value in \c result.
+ * Returns false if the operation is not defined on \c dtype, in which case
+ * the memory is not modified.
+ */
+bool
+dart__mpi__local_fetch_and_op(
+  void             * addr,
+  const void       * value,
+  void             * result,
+  dart_datatype_t    dtype,
+  dart_operation_t   op) DART_INTERNAL;
+
+/**
+ * Applies \c op with the \c nelem elements in \c values to the elements
+ * at \c addr, each element is updated atomically.
+ * Returns false if the operation is not defined on \c dtype, in which case
+ * the memory is not modified.
+ */
+bool
+dart__mpi__local_accumulate(
+  void             * addr,
+  const void       * values,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op) DART_INTERNAL;
+
+/**
+ * Atomically replaces the integral element at \c addr with \c value if it
+ * equals \c compare and stores the previous value in \c result.
+ * Returns false if \c dtype is not an integral type.
+ */
+bool
+dart__mpi__local_compare_and_swap(
+  void             * addr,
+  const void       * value,
+  const void       * compare,
+  void             * result,
+  dart_datatype_t    dtype) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_LOCAL_ATOMICS_H__ */
@@ -14,10 +14,20 @@
 
 #include <dash/dart/base/macro.h>
 
+/** Default size of the local allocation pool per unit in bytes */
+#define DART_LOCAL_ALLOC_DEFAULT_SIZE (1024*1024*16)
+
 // forward declaration
 struct dart_buddy;
+struct dart_slab;
 extern char* dart_mempool_localalloc DART_INTERNAL;
-extern struct dart_buddy* dart_localpool DART_INTERNAL;
+/** Allocator of the local allocation pool */
+extern struct dart_slab* dart_localpool DART_INTERNAL;
+/**
+ * Allocator of the local allocation pool if the buddy allocator is
+ * selected, see \c dart_config_t.local_alloc_buddy, NULL otherwise.
+ */
+extern struct dart_buddy* dart_localpool_buddy DART_INTERNAL;
 
 /**
  * Create a new buddy allocator instance.
@@ -0,0 +1,39 @@
+#ifndef DART__MPI__DART_PROGRESS_H__
+#define DART__MPI__DART_PROGRESS_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * \file dart_progress.h
+ *
+ * Asynchronous progress of non-blocking operations.
+ *
+ * Many MPI implementations only advance outstanding transfers while the
+ * application calls into MPI, a large non-blocking transfer then only
+ * completes in the final wait. If enabled (see
+ * \c dart_config_t::progress_thread), a pinned thread polls MPI in the
+ * background so that transfers progress while the application computes.
+ */
+
+/**
+ * Default interval in microseconds between two polls of the progress
+ * thread.
+ */
+#define DART_PROGRESS_DEFAULT_INTERVAL 10
+
+/**
+ * Starts the progress thread if it is enabled in the configuration and
+ * MPI provides \c MPI_THREAD_MULTIPLE. Collective on \c DART_TEAM_ALL.
+ */
+dart_ret_t
+dart__mpi__progress_init() DART_INTERNAL;
+
+/**
+ * Stops the progress thread if it is running.
+ * Collective on \c DART_TEAM_ALL.
+ */
+dart_ret_t
+dart__mpi__progress_fini() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_PROGRESS_H__ */
@@ -15,7 +15,8 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/** Initial capacity of the segment tables of a team */
+#define DART_SEGMENT_TABLE_SIZE 256
 
 typedef struct
 {
@@ -28,16 +29,26 @@ typedef struct
   uint16_t     flags;       /* 16 bit flags */
   dart_segid_t segid;       /* ID of the segment, globally unique in a team */
   bool         is_dynamic;  /* whether this is a shared memory segment */
+  bool         is_pooled;   /* whether this segment is part of the team heap */
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /**
+   * Segments are resolved on every RMA operation, they are stored in
+   * tables directly indexed by segment ID rather than hashed.
+   * Allocated segments (non-negative IDs) are indexed by their ID,
+   * registered segments (negative IDs) by their negated ID.
+   */
+  dart_segment_info_t ** mem_segments;
+  dart_segment_info_t ** reg_segments;
+  int                    mem_capacity;
+  int                    reg_capacity;
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -60,7 +71,7 @@ typedef enum {
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -85,11 +96,22 @@ dart_segment_register(
   dart_segment_info_t *seg) DART_INTERNAL;
 
 /**
- * Returns the segment info for the segment with ID \c segid.
+ * Returns the segment info for the segment with ID \c segid or \c NULL
+ * if no such segment exists. Constant time, inlined on the RMA path.
  */
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid) DART_INTERNAL;
+static inline
+dart_segment_info_t *
+dart_segment_get_info(
+  const dart_segmentdata_t *segdata,
+  dart_segid_t              segid)
+{
+  if (segid >= 0) {
+    return (segid < segdata->mem_capacity)
+             ? segdata->mem_segments[segid] : NULL;
+  }
+  return (-segid < segdata->reg_capacity)
+           ? segdata->reg_segments[-segid] : NULL;
+}
 
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
@@ -178,7 +200,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
@@ -0,0 +1,81 @@
+#ifndef DART__MPI__DART_SLAB_H__
+#define DART__MPI__DART_SLAB_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * \file dart_slab.h
+ *
+ * Size-class allocator managing offsets in externally allocated memory
+ * regions, used to serve \c dart_memalloc from the local allocation
+ * window.
+ *
+ * Requests of up to \c DART_SLAB_MAX_SMALL bytes are rounded up to one
+ * of the size classes, which are spaced at most 25% apart, and served
+ * from slabs of equally sized blocks. Larger requests are served from
+ * runs of pages. All bookkeeping is kept outside of the managed memory.
+ *
+ * The allocator is thread-safe. Optionally, freed blocks of small size
+ * classes are kept in per-thread caches to avoid contention on the
+ * allocator in the common case. Cached blocks are returned when their
+ * thread exits and reclaimed from all threads before an allocation
+ * fails. Additional memory regions can be registered at any time.
+ */
+
+/** Offset returned if an allocation cannot be served */
+#define DART_SLAB_ALLOC_FAILED ((uint64_t)(-1))
+
+/** Largest request served from a slab */
+#define DART_SLAB_MAX_SMALL    (32 * 1024)
+
+// forward declaration
+struct dart_slab;
+
+/**
+ * Create a new allocator instance without memory regions.
+ *
+ * \param thread_cache  Whether freed small blocks are cached per thread.
+ *                      Thread caches serve a single allocator at a
+ *                      time, blocks cached for another allocator are
+ *                      returned to it first.
+ */
+struct dart_slab *
+dart_slab_new(bool thread_cache) DART_INTERNAL;
+
+/**
+ * Register the memory region \c [offset, offset + size) with the
+ * allocator. Regions must not overlap, only full pages of the region
+ * are used.
+ */
+dart_ret_t
+dart_slab_add_region(
+  struct dart_slab * self,
+  uint64_t           offset,
+  size_t             size) DART_INTERNAL;
+
+/**
+ * Delete the given allocator instance.
+ */
+void dart_slab_delete(struct dart_slab * self) DART_INTERNAL;
+
+/**
+ * Allocate \c size bytes from the registered regions.
+ *
+ * \return The offset of the allocated memory or
+ *         \c DART_SLAB_ALLOC_FAILED if no region has sufficient space.
+ */
+uint64_t dart_slab_alloc(struct dart_slab * self, size_t size) DART_INTERNAL;
+
+/**
+ * Return the memory at \c offset to the allocator for reuse.
+ *
+ * \return 0 on success, -1 if \c offset has not been allocated.
+ */
+int dart_slab_free(struct dart_slab * self, uint64_t offset) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_SLAB_H__ */
@@ -0,0 +1,104 @@
+#ifndef DART__MPI__DART_TEAM_HEAP_H__
+#define DART__MPI__DART_TEAM_HEAP_H__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * \file dart_team_heap.h
+ *
+ * Symmetric heap of a team, serves collective allocations from a single
+ * pre-allocated window segment instead of allocating a window for every
+ * allocation.
+ *
+ * Collective allocations are performed by all units in the team in the
+ * same order and with the same size, the allocator is deterministic so
+ * every unit obtains the same offset in the heap without communication.
+ */
+
+/** Default size of a team's heap per unit in bytes */
+#define DART_TEAM_HEAP_DEFAULT_SIZE (16 * 1024 * 1024)
+
+/**
+ * Allocations larger than this fraction of the heap size are served by a
+ * dedicated window.
+ */
+#define DART_TEAM_HEAP_MAX_ALLOC_FRACTION 8
+
+/** Alignment of allocations in the heap, avoids false sharing */
+#define DART_TEAM_HEAP_ALIGN 64
+
+typedef struct dart_team_heap_block dart_team_heap_block_t;
+
+typedef struct {
+  /// the size of the heap per unit in bytes, 0 if the heap is disabled
+  size_t                   size;
+  /// the segment holding the heap memory, 0 if not allocated yet
+  int16_t                  segid;
+  /// free blocks in the heap, sorted by offset
+  dart_team_heap_block_t * freelist;
+  /// the number of allocations served from the heap
+  size_t                   num_pooled;
+  /// the number of allocations served by dedicated windows
+  size_t                   num_windows;
+} dart_team_heap_t;
+
+/**
+ * Initialize the heap data of a team, the heap memory is not allocated
+ * before the first allocation.
+ *
+ * \param heap  The heap to initialize.
+ * \param size  The size of the heap per unit in bytes, 0 disables the heap.
+ */
+void
+dart_team_heap_init(
+  dart_team_heap_t * heap,
+  size_t             size) DART_INTERNAL;
+
+/**
+ * Whether an allocation of \c nbytes bytes should be served from the heap.
+ */
+static inline
+int
+dart_team_heap_accepts(
+  const dart_team_heap_t * heap,
+  size_t                   nbytes)
+{
+  return (heap->size > 0 &&
+          nbytes <= heap->size / DART_TEAM_HEAP_MAX_ALLOC_FRACTION);
+}
+
+/**
+ * Allocate a block of \c nbytes bytes from the heap.
+ *
+ * \param[out] offset  The offset of the block in the heap segment.
+ *
+ * \return \c DART_OK on success,
+ *         \c DART_ERR_NOTFOUND if no sufficiently large block is free.
+ */
+dart_ret_t
+dart_team_heap_alloc(
+  dart_team_heap_t * heap,
+  size_t             nbytes,
+  size_t           * offset) DART_INTERNAL;
+
+/**
+ * Return the block of \c nbytes bytes at \c offset to the heap.
+ */
+void
+dart_team_heap_free(
+  dart_team_heap_t * heap,
+  size_t             offset,
+  size_t             nbytes) DART_INTERNAL;
+
+/**
+ * Release the heap data. The heap segment has to be released separately.
+ */
+void
+dart_team_heap_fini(
+  dart_team_heap_t * heap) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_TEAM_HEAP_H__ */
@@ -142,6 +142,8 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_team_heap.h>
+#include <dash/dart/mpi/dart_aggregation.h>
 #include <dash/dart/base/macro.h>
 
 extern dart_team_t dart_next_availteamid DART_INTERNAL;
@@ -151,6 +153,8 @@ extern MPI_Comm dart_comm_world DART_INTERNAL;
 
 #define DART_MAX_TEAM_NUMBER (256)
 
+#define DART_TEAM_HASH_SIZE (256)
+
 typedef struct dart_team_data {
 
   struct dart_team_data *next;
@@ -165,8 +169,29 @@ typedef struct dart_team_data {
    */
   MPI_Win window;
 
+  /**
+   * @brief Window of the notification counters of the units in this team.
+   */
+  MPI_Win notify_win;
+
   dart_segmentdata_t segdata;
 
+  /**
+   * @brief Symmetric heap serving small collective allocations.
+   */
+  dart_team_heap_t heap;
+
+  /**
+   * @brief Buffers of small puts and accumulates to units in this team.
+   */
+  dart_aggregation_t aggregation;
+
+  /**
+   * @brief Whether atomics are applied using processor atomics where
+   * possible, see \c dart_config_t::local_atomics.
+   */
+  bool local_atomics;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
@@ -225,11 +250,31 @@ dart_ret_t dart_adapt_teamlist_alloc(dart_team_t teamid) DART_INTERNAL;
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 
+extern dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE] DART_INTERNAL;
+
+static inline int
+dart_adapt_teamlist_hash(dart_team_t teamid)
+{
+  return (teamid % DART_TEAM_HASH_SIZE);
+}
+
 /**
  * Retrieve the \c dart_team_data for \c teamid.
+ * Inlined as it is called on every RMA operation, teams are found in
+ * the first entry of their bucket unless more than
+ * \c DART_TEAM_HASH_SIZE teams have been created.
  */
+static inline
 dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
+dart_adapt_teamlist_get(dart_team_t teamid)
+{
+  dart_team_data_t *res = dart_team_data[dart_adapt_teamlist_hash(teamid)];
+  while (res != NULL && res->teamid != teamid) {
+    res = res->next;
+  }
+
+  return res;
+}
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
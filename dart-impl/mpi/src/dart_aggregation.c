@@ -0,0 +1,452 @@
+/**
+ * \file dart_aggregation.c
+ *
+ * Buffering and packing of small puts and accumulates.
+ */
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_config.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/dart/mpi/dart_aggregation.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK_MPI_RET(__call, __name)                      \
+  do {                                                     \
+    if (dart__unlikely(__call != MPI_SUCCESS)) {           \
+      DART_LOG_ERROR("%s ! %s failed!", __func__, __name); \
+      return DART_ERR_OTHER;                               \
+    }                                                      \
+  } while (0)
+
+DART_AGGREGATION_THREAD_LOCAL int    dart__mpi__aggregation_depth     = 0;
+DART_AGGREGATION_THREAD_LOCAL size_t dart__mpi__aggregation_threshold = 0;
+
+static dart_mutex_t aggregation_mutex = DART_MUTEX_INITIALIZER;
+
+/**
+ * Target extent of a buffered operation, used to detect operations on
+ * overlapping memory which must not be packed into the same transfer.
+ */
+typedef struct {
+  MPI_Aint begin;
+  MPI_Aint end;
+} entry_extent_t;
+
+static int cmp_extent(const void *lhs, const void *rhs)
+{
+  MPI_Aint l = ((const entry_extent_t *)lhs)->begin;
+  MPI_Aint r = ((const entry_extent_t *)rhs)->begin;
+  return (l > r) - (l < r);
+}
+
+static inline bool
+same_run(
+  const dart_aggregation_entry_t * lhs,
+  const dart_aggregation_entry_t * rhs)
+{
+  return (lhs->win      == rhs->win      &&
+          lhs->mpi_type == rhs->mpi_type &&
+          lhs->mpi_op   == rhs->mpi_op);
+}
+
+static inline int
+issue_single(
+  const dart_aggregation_buffer_t * buffer,
+  const dart_aggregation_entry_t  * entry,
+  dart_team_unit_t                  unit)
+{
+  const char *src = buffer->data + entry->data_offs;
+  if (entry->mpi_op == MPI_OP_NULL) {
+    return MPI_Put(src, entry->count, entry->mpi_type,
+                   unit.id, entry->disp, entry->count, entry->mpi_type,
+                   entry->win);
+  }
+  return MPI_Accumulate(src, entry->count, entry->mpi_type,
+                        unit.id, entry->disp, entry->count, entry->mpi_type,
+                        entry->mpi_op, entry->win);
+}
+
+/**
+ * Issues the \c num entries starting at \c first which share their window,
+ * type and operation.
+ * Their values are contiguous in the data buffer so a single transfer with
+ * an indexed type at the target suffices unless the target locations
+ * overlap, in which case the entries are issued individually in order.
+ * \c extents, \c blocklens and \c displs provide space for \c num
+ * elements.
+ */
+static dart_ret_t
+issue_run(
+  const dart_aggregation_buffer_t * buffer,
+  int                               first,
+  int                               num,
+  dart_team_unit_t                  unit,
+  entry_extent_t                  * extents,
+  int                             * blocklens,
+  MPI_Aint                        * displs)
+{
+  const dart_aggregation_entry_t *entries = buffer->entries + first;
+
+  int type_size;
+  MPI_Type_size(entries[0].mpi_type, &type_size);
+
+  bool overlaps = false;
+  if (num > 1) {
+    for (int i = 0; i < num; ++i) {
+      extents[i].begin = entries[i].disp;
+      extents[i].end   = entries[i].disp +
+                         (MPI_Aint)entries[i].count * type_size;
+    }
+    qsort(extents, num, sizeof(entry_extent_t), &cmp_extent);
+    for (int i = 1; i < num && !overlaps; ++i) {
+      overlaps = (extents[i].begin < extents[i-1].end);
+    }
+  }
+
+  if (num == 1 || overlaps) {
+    DART_LOG_TRACE("dart_aggregation: issuing %d operations on unit %d",
+                   num, unit.id);
+    for (int i = 0; i < num; ++i) {
+      CHECK_MPI_RET(issue_single(buffer, &entries[i], unit),
+                    "MPI_Put/MPI_Accumulate");
+      // unlike accumulates, puts to the same location are not ordered
+      if (overlaps && entries[i].mpi_op == MPI_OP_NULL) {
+        CHECK_MPI_RET(MPI_Win_flush(unit.id, entries[i].win),
+                      "MPI_Win_flush");
+      }
+    }
+    return DART_OK;
+  }
+
+  // displacements are relative to the lowest target location
+  MPI_Aint base  = extents[0].begin;
+  int      count = 0;
+  for (int i = 0; i < num; ++i) {
+    blocklens[i] = entries[i].count;
+    displs[i]    = entries[i].disp - base;
+    count       += entries[i].count;
+  }
+
+  MPI_Datatype target_type;
+  CHECK_MPI_RET(
+    MPI_Type_create_hindexed(num, blocklens, displs,
+                             entries[0].mpi_type, &target_type),
+    "MPI_Type_create_hindexed");
+  CHECK_MPI_RET(MPI_Type_commit(&target_type), "MPI_Type_commit");
+
+  DART_LOG_TRACE("dart_aggregation: packing %d operations (%d elements) "
+                 "on unit %d", num, count, unit.id);
+
+  const char *src = buffer->data + entries[0].data_offs;
+  int ret;
+  if (entries[0].mpi_op == MPI_OP_NULL) {
+    ret = MPI_Put(src, count, entries[0].mpi_type,
+                  unit.id, base, 1, target_type, entries[0].win);
+  } else {
+    ret = MPI_Accumulate(src, count, entries[0].mpi_type,
+                         unit.id, base, 1, target_type,
+                         entries[0].mpi_op, entries[0].win);
+  }
+  // freeing the type does not affect the pending transfer
+  MPI_Type_free(&target_type);
+  CHECK_MPI_RET(ret, "MPI_Put/MPI_Accumulate");
+
+  return DART_OK;
+}
+
+static dart_ret_t
+issue_buffer(
+  dart_aggregation_buffer_t * buffer,
+  dart_team_unit_t            unit,
+  bool                        complete)
+{
+  int num_entries = buffer->num_entries;
+  if (num_entries == 0) {
+    return DART_OK;
+  }
+
+  entry_extent_t *extents   = malloc(num_entries * sizeof(entry_extent_t));
+  int            *blocklens = malloc(num_entries * sizeof(int));
+  MPI_Aint       *displs    = malloc(num_entries * sizeof(MPI_Aint));
+
+  // single operations are issued without temporaries, the buffered
+  // operations must not be lost
+  int max_run = num_entries;
+  if (extents == NULL || blocklens == NULL || displs == NULL) {
+    DART_LOG_WARN("dart_aggregation: failed to allocate temporaries for "
+                  "%d operations, issuing them individually", num_entries);
+    max_run = 1;
+  }
+
+  dart_ret_t ret   = DART_OK;
+  int        first = 0;
+  while (first < num_entries && ret == DART_OK) {
+    int last = first + 1;
+    while (last < num_entries && last - first < max_run &&
+           same_run(&buffer->entries[first], &buffer->entries[last])) {
+      ++last;
+    }
+    ret = issue_run(buffer, first, last - first, unit,
+                    extents, blocklens, displs);
+    // MPI does not order puts and accumulates of different types, complete
+    // a run before the next one on the same window. The data buffer is
+    // reused, transfers are completed at least locally.
+    if (ret == DART_OK) {
+      MPI_Win win      = buffer->entries[first].win;
+      bool    same_win = (last < num_entries &&
+                          buffer->entries[last].win == win);
+      if (complete || same_win) {
+        if (MPI_Win_flush(unit.id, win) != MPI_SUCCESS) {
+          DART_LOG_ERROR("dart_aggregation ! MPI_Win_flush failed!");
+          ret = DART_ERR_OTHER;
+        }
+      } else {
+        if (MPI_Win_flush_local(unit.id, win) != MPI_SUCCESS) {
+          DART_LOG_ERROR("dart_aggregation ! MPI_Win_flush_local failed!");
+          ret = DART_ERR_OTHER;
+        }
+      }
+    }
+    first = last;
+  }
+
+  free(extents);
+  free(blocklens);
+  free(displs);
+
+  __atomic_store_n(&buffer->num_entries, 0, __ATOMIC_RELAXED);
+  buffer->data_size = 0;
+  return ret;
+}
+
+static void
+remove_pending(
+  dart_aggregation_t * aggregation,
+  dart_team_unit_t     unit)
+{
+  for (int i = 0; i < aggregation->num_pending; ++i) {
+    if (aggregation->pending[i] == unit.id) {
+      aggregation->pending[i] =
+        aggregation->pending[--aggregation->num_pending];
+      return;
+    }
+  }
+}
+
+dart_ret_t
+dart__mpi__aggregation_add(
+  struct dart_team_data * team_data,
+  dart_team_unit_t        unit,
+  MPI_Win                 win,
+  MPI_Aint                disp,
+  const void            * src,
+  int                     count,
+  MPI_Datatype            mpi_type,
+  size_t                  type_size,
+  MPI_Op                  mpi_op)
+{
+  dart_aggregation_t *aggregation = &team_data->aggregation;
+  size_t              nbytes      = count * type_size;
+  dart_ret_t          ret         = DART_OK;
+
+  dart__base__mutex_lock(&aggregation_mutex);
+
+  if (aggregation->buffers == NULL) {
+    // buffers are published last, they are tested without the mutex in
+    // dart__mpi__aggregation_pending
+    dart_aggregation_buffer_t *buffers = calloc(
+                                           team_data->size,
+                                           sizeof(dart_aggregation_buffer_t));
+    aggregation->pending = malloc(team_data->size * sizeof(int));
+    if (buffers == NULL || aggregation->pending == NULL) {
+      free(buffers);
+      free(aggregation->pending);
+      aggregation->pending = NULL;
+      dart__base__mutex_unlock(&aggregation_mutex);
+      DART_LOG_ERROR("dart_aggregation ! Failed to allocate buffers for "
+                     "%d units", team_data->size);
+      return DART_ERR_OTHER;
+    }
+    aggregation->num_buffers = team_data->size;
+    aggregation->num_pending = 0;
+    __atomic_store_n(&aggregation->buffers, buffers, __ATOMIC_RELEASE);
+  }
+
+  dart_aggregation_buffer_t *buffer = &aggregation->buffers[unit.id];
+
+  if (buffer->data_size + nbytes > dart__mpi__aggregation_threshold) {
+    ret = issue_buffer(buffer, unit, false);
+    remove_pending(aggregation, unit);
+    if (ret != DART_OK) {
+      dart__base__mutex_unlock(&aggregation_mutex);
+      return ret;
+    }
+  }
+
+  // on failure, the buffered operations are kept
+  if (buffer->num_entries == buffer->max_entries) {
+    int max_entries = (buffer->max_entries > 0)
+                        ? 2 * buffer->max_entries : 64;
+    dart_aggregation_entry_t *entries = realloc(
+                                          buffer->entries,
+                                          max_entries *
+                                            sizeof(dart_aggregation_entry_t));
+    if (entries == NULL) {
+      dart__base__mutex_unlock(&aggregation_mutex);
+      DART_LOG_ERROR("dart_aggregation ! Failed to allocate %d entries",
+                     max_entries);
+      return DART_ERR_OTHER;
+    }
+    buffer->entries     = entries;
+    buffer->max_entries = max_entries;
+  }
+  if (buffer->data_size + nbytes > buffer->data_capacity) {
+    size_t capacity = (buffer->data_capacity > 0)
+                        ? buffer->data_capacity : 4096;
+    while (capacity < buffer->data_size + nbytes) {
+      capacity *= 2;
+    }
+    char *data = realloc(buffer->data, capacity);
+    if (data == NULL) {
+      dart__base__mutex_unlock(&aggregation_mutex);
+      DART_LOG_ERROR("dart_aggregation ! Failed to allocate %zu bytes",
+                     capacity);
+      return DART_ERR_OTHER;
+    }
+    buffer->data          = data;
+    buffer->data_capacity = capacity;
+  }
+
+  if (buffer->num_entries == 0) {
+    aggregation->pending[aggregation->num_pending++] = unit.id;
+  }
+
+  dart_aggregation_entry_t *entry = &buffer->entries[buffer->num_entries];
+  entry->win       = win;
+  entry->disp      = disp;
+  entry->mpi_type  = mpi_type;
+  entry->mpi_op    = mpi_op;
+  entry->count     = count;
+  entry->data_offs = buffer->data_size;
+  memcpy(buffer->data + buffer->data_size, src, nbytes);
+  buffer->data_size += nbytes;
+  __atomic_store_n(&buffer->num_entries, buffer->num_entries + 1,
+                   __ATOMIC_RELAXED);
+
+  dart__base__mutex_unlock(&aggregation_mutex);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__aggregation_issue(
+  struct dart_team_data * team_data,
+  dart_team_unit_t        unit,
+  bool                    complete)
+{
+  dart_aggregation_t *aggregation = &team_data->aggregation;
+  dart_ret_t          ret         = DART_OK;
+
+  dart__base__mutex_lock(&aggregation_mutex);
+  if (dart__mpi__aggregation_pending(aggregation, unit)) {
+    ret = issue_buffer(&aggregation->buffers[unit.id], unit, complete);
+    remove_pending(aggregation, unit);
+  }
+  dart__base__mutex_unlock(&aggregation_mutex);
+  return ret;
+}
+
+dart_ret_t
+dart__mpi__aggregation_issue_all(
+  struct dart_team_data * team_data,
+  bool                    complete)
+{
+  dart_aggregation_t *aggregation = &team_data->aggregation;
+  dart_ret_t          ret         = DART_OK;
+
+  dart__base__mutex_lock(&aggregation_mutex);
+  for (int i = 0; i < aggregation->num_pending; ++i) {
+    dart_team_unit_t unit = DART_TEAM_UNIT_ID(aggregation->pending[i]);
+    dart_ret_t unit_ret   = issue_buffer(&aggregation->buffers[unit.id],
+                                         unit, complete);
+    if (unit_ret != DART_OK) {
+      ret = unit_ret;
+    }
+  }
+  aggregation->num_pending = 0;
+  dart__base__mutex_unlock(&aggregation_mutex);
+  return ret;
+}
+
+void
+dart__mpi__aggregation_fini(
+  dart_aggregation_t * aggregation)
+{
+  if (aggregation->buffers == NULL) {
+    return;
+  }
+  if (aggregation->num_pending > 0) {
+    DART_LOG_WARN("dart_aggregation: discarding buffered operations "
+                  "to %d units", aggregation->num_pending);
+  }
+  for (int i = 0; i < aggregation->num_buffers; ++i) {
+    free(aggregation->buffers[i].entries);
+    free(aggregation->buffers[i].data);
+  }
+  free(aggregation->buffers);
+  free(aggregation->pending);
+  __atomic_store_n(&aggregation->buffers, NULL, __ATOMIC_RELEASE);
+  aggregation->pending     = NULL;
+  aggregation->num_buffers = 0;
+  aggregation->num_pending = 0;
+}
+
+/* -- Public interface -- */
+
+dart_ret_t dart_aggregation_begin()
+{
+  // the depth is thread-local, only the buffers are shared between threads
+  if (dart__mpi__aggregation_depth++ == 0) {
+    dart_config_t *config;
+    dart_config(&config);
+    dart__mpi__aggregation_threshold = config->aggregation_buffer_size;
+  }
+  DART_LOG_DEBUG("dart_aggregation_begin: depth %d, threshold %zu bytes",
+                 dart__mpi__aggregation_depth,
+                 dart__mpi__aggregation_threshold);
+  return DART_OK;
+}
+
+dart_ret_t dart_aggregation_end()
+{
+  if (dart__mpi__aggregation_depth == 0) {
+    DART_LOG_ERROR("dart_aggregation_end ! aggregation is not enabled");
+    return DART_ERR_INVAL;
+  }
+  int depth = --dart__mpi__aggregation_depth;
+
+  DART_LOG_DEBUG("dart_aggregation_end: depth %d", depth);
+
+  if (depth > 0) {
+    return DART_OK;
+  }
+
+  // complete all buffered operations of all teams
+  dart_ret_t ret = DART_OK;
+  for (int i = 0; i < DART_TEAM_HASH_SIZE; ++i) {
+    for (dart_team_data_t *team_data = dart_team_data[i];
+         team_data != NULL; team_data = team_data->next) {
+      dart_ret_t team_ret = dart__mpi__aggregation_issue_all(team_data, true);
+      if (team_ret != DART_OK) {
+        ret = team_ret;
+      }
+    }
+  }
+  return ret;
+}
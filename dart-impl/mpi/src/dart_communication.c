@@ -19,9 +19,12 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_aggregation.h>
+#include <dash/dart/mpi/dart_local_atomics.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/mutex.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -97,8 +100,69 @@ struct dart_handle_struct
   dart_unit_t dest;
   uint8_t     num_reqs;
   bool        needs_flush;
+  struct dart_handle_struct * next;  // next free handle in the handle pool
 };
 
+/**
+ * Completed handles are kept in a free list and reused, issuing a
+ * non-blocking operation does not allocate memory in the steady state.
+ */
+static dart_handle_t handle_pool       = DART_HANDLE_NULL;
+static dart_mutex_t  handle_pool_mutex = DART_MUTEX_INITIALIZER;
+
+/**
+ * Obtains a handle from the handle pool, allocates a new handle if the
+ * pool is empty.
+ *
+ * \return  The handle or \c DART_HANDLE_NULL if allocation failed.
+ */
+static dart_handle_t dart__mpi__handle_alloc()
+{
+  dart__base__mutex_lock(&handle_pool_mutex);
+  dart_handle_t handle = handle_pool;
+  if (handle != DART_HANDLE_NULL) {
+    handle_pool = handle->next;
+  }
+  dart__base__mutex_unlock(&handle_pool_mutex);
+  if (handle == DART_HANDLE_NULL) {
+    handle = malloc(sizeof(struct dart_handle_struct));
+    if (handle == NULL) {
+      DART_LOG_ERROR("dart__mpi__handle_alloc ! Failed to allocate handle");
+      return DART_HANDLE_NULL;
+    }
+  }
+  handle->reqs[0]     = MPI_REQUEST_NULL;
+  handle->reqs[1]     = MPI_REQUEST_NULL;
+  handle->win         = MPI_WIN_NULL;
+  handle->dest        = DART_UNDEFINED_UNIT_ID;
+  handle->num_reqs    = 0;
+  handle->needs_flush = false;
+  handle->next        = DART_HANDLE_NULL;
+  return handle;
+}
+
+/**
+ * Returns a completed handle to the handle pool.
+ */
+static void dart__mpi__handle_free(dart_handle_t handle)
+{
+  dart__base__mutex_lock(&handle_pool_mutex);
+  handle->next = handle_pool;
+  handle_pool  = handle;
+  dart__base__mutex_unlock(&handle_pool_mutex);
+}
+
+void dart__mpi__handle_pool_fini()
+{
+  dart__base__mutex_lock(&handle_pool_mutex);
+  while (handle_pool != DART_HANDLE_NULL) {
+    dart_handle_t handle = handle_pool;
+    handle_pool = handle->next;
+    free(handle);
+  }
+  dart__base__mutex_unlock(&handle_pool_mutex);
+}
+
 /**
  * Help to check for return of MPI call.
  * Since DART currently does not define an MPI error handler the abort will not
@@ -311,6 +375,12 @@ dart__mpi__get_complex(
     dst_mpi_type = src_mpi_type;
     dst_num_elem = src_num_elem;
   }
+  if (dart__unlikely(src_mpi_type == MPI_DATATYPE_NULL ||
+                     dst_mpi_type == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! Failed to convert DART types to MPI types",
+                   __func__);
+    return DART_ERR_OTHER;
+  }
 
   DART_LOG_TRACE("dart_get:  MPI_Rget (dest %p, size %zu)", dest_ptr, nelem);
   CHECK_MPI_RET(
@@ -324,13 +394,6 @@ dart__mpi__get_complex(
             win,
             reqs, num_reqs),
     "MPI_Rget");
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
-  }
   return DART_OK;
 }
 
@@ -453,6 +516,12 @@ dart__mpi__put_complex(
     dst_mpi_type = src_mpi_type;
     dst_num_elem = src_num_elem;
   }
+  if (dart__unlikely(src_mpi_type == MPI_DATATYPE_NULL ||
+                     dst_mpi_type == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! Failed to convert DART types to MPI types",
+                   __func__);
+    return DART_ERR_OTHER;
+  }
 
   DART_LOG_TRACE(
     "dart_put:  MPI_Put (src %p, size %zu, src_type %p, dst_type %p)",
@@ -470,12 +539,65 @@ dart__mpi__put_complex(
             reqs, num_reqs),
     "MPI_Put");
 
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
+  return DART_OK;
+}
+
+/**
+ * Buffers a put (\c mpi_op is \c MPI_OP_NULL) or accumulate of a basic
+ * type if aggregation is enabled and the target is not accessed through
+ * shared memory.
+ * Returns false if the operation has to be issued directly.
+ */
+static inline
+bool
+dart__mpi__aggregate(
+  dart_team_data_t          * team_data,
+  dart_team_unit_t            team_unit_id,
+  const dart_segment_info_t * seginfo,
+  const void                * src,
+  uint64_t                    offset,
+  size_t                      nelem,
+  dart_datatype_t             dtype,
+  MPI_Op                      mpi_op,
+  dart_ret_t                * ret)
+{
+  size_t type_size = dart__mpi__datatype_sizeof(dtype);
+  if (dart__likely(!dart__mpi__aggregation_applies(nelem * type_size))) {
+    return false;
   }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+  if (team_unit_id.id == team_data->unitid) {
+    return false;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 &&
+      team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    return false;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  *ret = dart__mpi__aggregation_add(
+           team_data, team_unit_id, seginfo->win,
+           offset + dart_segment_disp(seginfo, team_unit_id),
+           src, nelem, dart__mpi__datatype_struct(dtype)->basic.mpi_type,
+           type_size, mpi_op);
+  return true;
+}
+
+/**
+ * Issues the operations buffered for \c team_unit_id ahead of an operation
+ * that is not aggregated to preserve their order. Reads pass \c complete
+ * to observe the buffered writes. The unlocked test is re-checked under
+ * the aggregation mutex by \c dart__mpi__aggregation_issue.
+ */
+static inline
+dart_ret_t
+dart__mpi__aggregation_sync(
+  dart_team_data_t * team_data,
+  dart_team_unit_t   team_unit_id,
+  bool               complete)
+{
+  if (dart__unlikely(dart__mpi__aggregation_pending(
+                       &team_data->aggregation, team_unit_id))) {
+    return dart__mpi__aggregation_issue(team_data, team_unit_id, complete);
   }
   return DART_OK;
 }
@@ -514,7 +636,11 @@ dart_ret_t dart_get(
     return DART_ERR_INVAL;
   }
 
-  dart_ret_t ret = DART_OK;
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
 
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_isbasic(src_type) &&
@@ -565,6 +691,19 @@ dart_ret_t dart_put(
 
   dart_ret_t ret = DART_OK;
 
+  if (dart__mpi__datatype_isbasic(src_type) &&
+      dart__mpi__datatype_isbasic(dst_type) &&
+      dart__mpi__aggregate(team_data, team_unit_id, seginfo, src,
+                           offset, nelem, src_type, MPI_OP_NULL, &ret)) {
+    return ret;
+  }
+
+  // issue buffered operations to the unit first
+  ret = dart__mpi__aggregation_sync(team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   if (dart__mpi__datatype_isbasic(src_type) &&
       dart__mpi__datatype_isbasic(dst_type)) {
     // fast path for basic data types
@@ -597,6 +736,7 @@ dart_ret_t dart_accumulate(
   dart_team_t teamid = gptr.teamid;
 
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BASICOP(op);
   mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
   mpi_op             = dart__mpi__op(op);
 
@@ -620,6 +760,26 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  char *local_addr = dart__mpi__local_atomics_addr(
+                       team_data, seginfo, team_unit_id, offset);
+  if (local_addr != NULL &&
+      dart__mpi__local_accumulate(local_addr, values, nelem, dtype, op)) {
+    DART_LOG_DEBUG("dart_accumulate > finished using processor atomics");
+    return DART_OK;
+  }
+
+  dart_ret_t ret = DART_OK;
+  if (dart__mpi__aggregate(team_data, team_unit_id, seginfo, values,
+                           offset, nelem, dtype, mpi_op, &ret)) {
+    return ret;
+  }
+
+  // issue buffered operations to the unit first
+  ret = dart__mpi__aggregation_sync(team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -684,6 +844,7 @@ dart_ret_t dart_fetch_and_op(
   dart_team_t teamid = gptr.teamid;
 
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BASICOP(op);
   mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
   mpi_op             = dart__mpi__op(op);
 
@@ -708,6 +869,20 @@ dart_ret_t dart_fetch_and_op(
                  dtype, op, team_unit_id.id,
                  gptr.addr_or_offs.offset, seg_id);
 
+  char *local_addr = dart__mpi__local_atomics_addr(
+                       team_data, seginfo, team_unit_id, offset);
+  if (local_addr != NULL &&
+      dart__mpi__local_fetch_and_op(local_addr, value, result, dtype, op)) {
+    DART_LOG_DEBUG("dart_fetch_and_op > finished using processor atomics");
+    return DART_OK;
+  }
+
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -766,6 +941,22 @@ dart_ret_t dart_compare_and_swap(
     return DART_ERR_INVAL;
   }
 
+  char *local_addr = dart__mpi__local_atomics_addr(
+                       team_data, seginfo, team_unit_id, offset);
+  if (local_addr != NULL &&
+      dart__mpi__local_compare_and_swap(local_addr, value, compare, result,
+                                        dtype)) {
+    DART_LOG_TRACE("dart_compare_and_swap > finished using processor "
+                   "atomics");
+    return DART_OK;
+  }
+
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
@@ -816,19 +1007,18 @@ dart_ret_t dart_get_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest         = team_unit_id.id;
-  handle->win          = win;
-  handle->needs_flush  = false;
-
-
   DART_LOG_DEBUG("dart_get_handle() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
-  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(handle));
 
-  dart_ret_t ret = DART_OK;
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  // requests are only moved to a handle if the operation is pending
+  MPI_Request reqs[2]  = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+  uint8_t     num_reqs = 0;
 
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_isbasic(src_type) &&
@@ -837,23 +1027,30 @@ dart_ret_t dart_get_handle(
     CHECK_EQUAL_BASETYPE(src_type, dst_type);
     ret = dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
                                offset, nelem, src_type,
-                               handle->reqs, &handle->num_reqs);
+                               reqs, &num_reqs);
   } else {
     // slow path for derived types
     ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
-                                 handle->reqs, &handle->num_reqs);
+                                 reqs, &num_reqs);
   }
 
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    if (handle == DART_HANDLE_NULL) {
+      return DART_ERR_OTHER;
+    }
+    handle->reqs[0]      = reqs[0];
+    handle->reqs[1]      = reqs[1];
+    handle->num_reqs     = num_reqs;
+    handle->dest         = team_unit_id.id;
+    handle->win          = seginfo->win;
+    handle->needs_flush  = false;
+    *handleptr           = handle;
   }
 
-  *handleptr = handle;
-
   DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
-                 (void*)(handle), handle->dest);
+                 (void*)(*handleptr), team_unit_id.id);
   return ret;
 }
 
@@ -890,15 +1087,16 @@ dart_ret_t dart_put_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  // chunk up the put
-  dart_handle_t handle   = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest           = team_unit_id.id;
-  handle->win            = win;
-  handle->needs_flush    = true;
+  // issue buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
 
-  dart_ret_t ret = DART_OK;
+  // requests are only moved to a handle if the operation is pending
+  MPI_Request reqs[2]     = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+  uint8_t     num_reqs    = 0;
+  bool        needs_flush = true;
 
   if (dart__mpi__datatype_isbasic(src_type) &&
       dart__mpi__datatype_isbasic(dst_type)) {
@@ -906,27 +1104,30 @@ dart_ret_t dart_put_handle(
     CHECK_EQUAL_BASETYPE(src_type, dst_type);
     ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
                                offset, nelem, src_type,
-                               handle->reqs,
-                               &handle->num_reqs,
-                               &handle->needs_flush);
+                               reqs, &num_reqs, &needs_flush);
   } else {
     // slow path for complex data types
     ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
-                                 handle->reqs,
-                                 &handle->num_reqs,
-                                 &handle->needs_flush);
+                                 reqs, &num_reqs, &needs_flush);
   }
 
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    if (handle == DART_HANDLE_NULL) {
+      return DART_ERR_OTHER;
+    }
+    handle->reqs[0]      = reqs[0];
+    handle->reqs[1]      = reqs[1];
+    handle->num_reqs     = num_reqs;
+    handle->dest         = team_unit_id.id;
+    handle->win          = seginfo->win;
+    handle->needs_flush  = needs_flush;
+    *handleptr           = handle;
   }
 
-  *handleptr = handle;
-
   DART_LOG_TRACE("dart_put_handle > handle(%p) dest:%d",
-                 (void*)(handle), handle->dest);
+                 (void*)(*handleptr), team_unit_id.id);
 
   return ret;
 }
@@ -972,6 +1173,20 @@ dart_ret_t dart_put_blocking(
   MPI_Win win  = seginfo->win;
 
   dart_ret_t ret = DART_OK;
+
+  if (dart__mpi__datatype_isbasic(src_type) &&
+      dart__mpi__datatype_isbasic(dst_type) &&
+      dart__mpi__aggregate(team_data, team_unit_id, seginfo, src,
+                           offset, nelem, src_type, MPI_OP_NULL, &ret)) {
+    return ret;
+  }
+
+  // issue buffered operations to the unit first
+  ret = dart__mpi__aggregation_sync(team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   bool needs_flush = false;
 
   if (dart__mpi__datatype_isbasic(src_type) &&
@@ -1035,7 +1250,11 @@ dart_ret_t dart_get_blocking(
     return DART_ERR_INVAL;
   }
 
-  dart_ret_t ret = DART_OK;
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
 
   MPI_Request reqs[2]  = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
   uint8_t     num_reqs = 0;
@@ -1064,22 +1283,61 @@ dart_ret_t dart_get_blocking(
   return DART_OK;
 }
 
-/* -- Dart RMA Synchronization Operations -- */
+/* -- Notified single-sided operations -- */
 
-dart_ret_t dart_flush(
-  dart_gptr_t gptr)
+dart_ret_t dart__mpi__notify_init(dart_team_data_t *team_data)
 {
-  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  int16_t          seg_id       = gptr.segid;
-  dart_team_t      teamid       = gptr.teamid;
-  DART_LOG_DEBUG("dart_flush() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  int64_t *counters;
+  CHECK_MPI_RET(
+    MPI_Win_allocate(
+      DART_NOTIFY_NUM_IDS * sizeof(int64_t), sizeof(int64_t),
+      MPI_INFO_NULL, team_data->comm, &counters, &team_data->notify_win),
+    "MPI_Win_allocate");
+  memset(counters, 0, DART_NOTIFY_NUM_IDS * sizeof(int64_t));
+  // counters have to be initialized before any unit notifies
+  CHECK_MPI_RET(MPI_Barrier(team_data->comm), "MPI_Barrier");
+  CHECK_MPI_RET(
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, team_data->notify_win),
+    "MPI_Win_lock_all");
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__notify_fini(dart_team_data_t *team_data)
+{
+  if (team_data->notify_win == MPI_WIN_NULL) {
+    return DART_OK;
+  }
+  CHECK_MPI_RET(
+    MPI_Win_unlock_all(team_data->notify_win), "MPI_Win_unlock_all");
+  CHECK_MPI_RET(
+    MPI_Win_free(&team_data->notify_win), "MPI_Win_free");
+  return DART_OK;
+}
+
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  int               notify_id)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
+  int16_t           seg_id       = gptr.segid;
+  dart_team_t       teamid       = gptr.teamid;
+
+  CHECK_EQUAL_BASETYPE(src_type, dst_type);
+
+  if (dart__unlikely(notify_id < 0 || notify_id >= DART_NOTIFY_NUM_IDS)) {
+    DART_LOG_ERROR("dart_put_notify ! Invalid notification ID %d",
+                   notify_id);
+    return DART_ERR_INVAL;
+  }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", teamid);
+    DART_LOG_ERROR("dart_put_notify ! failed: Unknown team %i!", teamid);
     return DART_ERR_INVAL;
   }
 
@@ -1088,107 +1346,632 @@ dart_ret_t dart_flush(
   dart_segment_info_t *seginfo = dart_segment_get_info(
                                     &(team_data->segdata), seg_id);
   if (dart__unlikely(seginfo == NULL)) {
-    DART_LOG_ERROR("dart_flush ! "
+    DART_LOG_ERROR("dart_put_notify ! "
                    "Unknown segment %i on team %i", seg_id, teamid);
     return DART_ERR_INVAL;
   }
 
-  MPI_Comm comm = team_data->comm;
-  MPI_Win  win  = seginfo->win;
+  DART_LOG_DEBUG("dart_put_notify() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nelem:%zu id:%d",
+                 team_unit_id.id, offset, seg_id, teamid, nelem, notify_id);
 
-  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
-  CHECK_MPI_RET(
-    MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
-  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
-  CHECK_MPI_RET(
-    MPI_Win_sync(win), "MPI_Win_sync");
+  // complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(team_data, team_unit_id, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
 
-  // trigger progress
-  int flag;
+  bool needs_flush = false;
+
+  if (dart__mpi__datatype_isbasic(src_type) &&
+      dart__mpi__datatype_isbasic(dst_type)) {
+    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                               offset, nelem, src_type,
+                               NULL, NULL, &needs_flush);
+  } else {
+    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+                                 offset, nelem, src_type, dst_type,
+                                 NULL, NULL, &needs_flush);
+  }
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  // the data has to be visible at the target before the notification
+  if (needs_flush) {
+    CHECK_MPI_RET(
+      MPI_Win_flush(team_unit_id.id, seginfo->win), "MPI_Win_flush");
+  } else {
+    CHECK_MPI_RET(MPI_Win_sync(seginfo->win), "MPI_Win_sync");
+  }
+
+  const int64_t one = 1;
   CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+    MPI_Accumulate(&one, 1, MPI_INT64_T, team_unit_id.id, notify_id,
+                   1, MPI_INT64_T, MPI_SUM, team_data->notify_win),
+    "MPI_Accumulate");
+  // a waiting target only progresses on delivered notifications
+  CHECK_MPI_RET(
+    MPI_Win_flush(team_unit_id.id, team_data->notify_win), "MPI_Win_flush");
 
-  DART_LOG_DEBUG("dart_flush > finished");
+  DART_LOG_DEBUG("dart_put_notify > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_flush_all(
-  dart_gptr_t gptr)
+/**
+ * Consumes \c count notifications of counter \c notify_id of the calling
+ * unit if available.
+ */
+static dart_ret_t dart__mpi__notify_consume(
+  const dart_team_data_t * team_data,
+  int                      notify_id,
+  uint64_t                 count,
+  bool                   * consumed)
 {
-  int16_t     seg_id = gptr.segid;
-  dart_team_t teamid = gptr.teamid;
+  // the counter is read with atomics as it is updated by other units
+  int64_t value;
+  CHECK_MPI_RET(
+    MPI_Fetch_and_op(NULL, &value, MPI_INT64_T, team_data->unitid,
+                     notify_id, MPI_NO_OP, team_data->notify_win),
+    "MPI_Fetch_and_op");
+  CHECK_MPI_RET(
+    MPI_Win_flush(team_data->unitid, team_data->notify_win),
+    "MPI_Win_flush");
 
-  DART_LOG_DEBUG("dart_flush_all() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  *consumed = ((uint64_t)value >= count);
+  if (*consumed && count > 0) {
+    // other units only increment the counter
+    const int64_t decrement = -(int64_t)count;
+    CHECK_MPI_RET(
+      MPI_Accumulate(&decrement, 1, MPI_INT64_T, team_data->unitid,
+                     notify_id, 1, MPI_INT64_T, MPI_SUM,
+                     team_data->notify_win),
+      "MPI_Accumulate");
+    CHECK_MPI_RET(
+      MPI_Win_flush(team_data->unitid, team_data->notify_win),
+      "MPI_Win_flush");
+  }
+  return DART_OK;
+}
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
-  if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", teamid);
+dart_ret_t dart_notify_wait(
+  dart_team_t   teamid,
+  int           notify_id,
+  uint64_t      count)
+{
+  if (dart__unlikely(notify_id < 0 || notify_id >= DART_NOTIFY_NUM_IDS)) {
+    DART_LOG_ERROR("dart_notify_wait ! Invalid notification ID %d",
+                   notify_id);
     return DART_ERR_INVAL;
   }
 
-  dart_segment_info_t *seginfo = dart_segment_get_info(
-                                    &(team_data->segdata), seg_id);
-  if (dart__unlikely(seginfo == NULL)) {
-    DART_LOG_ERROR("dart_get_blocking ! "
-                   "Unknown segment %i on team %i", seg_id, teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_notify_wait ! failed: Unknown team %i!", teamid);
     return DART_ERR_INVAL;
   }
 
-  MPI_Comm comm = team_data->comm;
-  MPI_Win  win  = seginfo->win;
-
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
-  CHECK_MPI_RET(
-    MPI_Win_flush_all(win), "MPI_Win_flush");
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
-  CHECK_MPI_RET(
-    MPI_Win_sync(win), "MPI_Win_sync");
+  DART_LOG_DEBUG("dart_notify_wait() team:%d id:%d count:%"PRIu64,
+                 teamid, notify_id, count);
 
-  // trigger progress
-  int flag;
-  CHECK_MPI_RET(
-    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
-    "MPI_Iprobe");
+  bool consumed = false;
+  while (!consumed) {
+    dart_ret_t ret = dart__mpi__notify_consume(
+                       team_data, notify_id, count, &consumed);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
 
-  DART_LOG_DEBUG("dart_flush_all > finished");
+  DART_LOG_DEBUG("dart_notify_wait > finished");
   return DART_OK;
 }
 
-dart_ret_t dart_flush_local(
-  dart_gptr_t gptr)
+dart_ret_t dart_notify_test(
+  dart_team_t   teamid,
+  int           notify_id,
+  uint64_t      count,
+  int32_t     * flag)
 {
-  int16_t     seg_id = gptr.segid;
-  dart_team_t teamid = gptr.teamid;
-  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  *flag = 0;
 
-  DART_LOG_DEBUG("dart_flush_local() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  if (dart__unlikely(notify_id < 0 || notify_id >= DART_NOTIFY_NUM_IDS)) {
+    DART_LOG_ERROR("dart_notify_test ! Invalid notification ID %d",
+                   notify_id);
+    return DART_ERR_INVAL;
+  }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", teamid);
+    DART_LOG_ERROR("dart_notify_test ! failed: Unknown team %i!", teamid);
     return DART_ERR_INVAL;
   }
 
-  CHECK_UNITID_RANGE(team_unit_id, team_data);
-
-  dart_segment_info_t *seginfo = dart_segment_get_info(
-                                    &(team_data->segdata), seg_id);
-  if (dart__unlikely(seginfo == NULL)) {
-    DART_LOG_ERROR("dart_flush_local ! "
-                   "Unknown segment %i on team %i", seg_id, teamid);
-    return DART_ERR_INVAL;
+  bool consumed;
+  dart_ret_t ret = dart__mpi__notify_consume(
+                     team_data, notify_id, count, &consumed);
+  if (ret == DART_OK) {
+    *flag = consumed;
   }
-  MPI_Comm comm = team_data->comm;
-  MPI_Win  win  = seginfo->win;
+  return ret;
+}
 
-  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
+/* -- Vectored single-sided communication operations -- */
+
+/**
+ * Transfer of a vectored operation, transfers are grouped by their target
+ * segment and unit and ordered by their location in the segment.
+ */
+typedef struct {
+  dart_gptr_t gptr;
+  size_t      idx;
+} dart_vector_entry_t;
+
+static int cmp_vector_entry(const void *lhs, const void *rhs)
+{
+  const dart_vector_entry_t *l = (const dart_vector_entry_t *)lhs;
+  const dart_vector_entry_t *r = (const dart_vector_entry_t *)rhs;
+  if (l->gptr.teamid != r->gptr.teamid) {
+    return (l->gptr.teamid < r->gptr.teamid) ? -1 : 1;
+  }
+  if (l->gptr.segid != r->gptr.segid) {
+    return (l->gptr.segid < r->gptr.segid) ? -1 : 1;
+  }
+  if (l->gptr.unitid != r->gptr.unitid) {
+    return (l->gptr.unitid < r->gptr.unitid) ? -1 : 1;
+  }
+  uint64_t loffs = l->gptr.addr_or_offs.offset;
+  uint64_t roffs = r->gptr.addr_or_offs.offset;
+  return (loffs > roffs) - (loffs < roffs);
+}
+
+static inline bool
+same_vector_target(
+  const dart_vector_entry_t * lhs,
+  const dart_vector_entry_t * rhs)
+{
+  return (lhs->gptr.teamid == rhs->gptr.teamid &&
+          lhs->gptr.segid  == rhs->gptr.segid  &&
+          lhs->gptr.unitid == rhs->gptr.unitid);
+}
+
+/**
+ * Issues the \c num transfers in \c entries to the same target segment and
+ * unit, using a single MPI operation with indexed types at the origin and
+ * the target if the target is not accessible through shared memory.
+ * Gets into \c dst if \c src is \c NULL, puts from \c src otherwise.
+ * Sets \c win to the window to flush or \c MPI_WIN_NULL if the transfers
+ * are already complete.
+ */
+static dart_ret_t
+dart__mpi__vector_issue(
+  const dart_vector_entry_t * entries,
+  int                         num,
+  void       * const        * dst,
+  const void * const        * src,
+  const size_t              * nelem,
+  dart_datatype_t             dtype,
+  int                       * blocklens,
+  MPI_Aint                  * origin_displs,
+  MPI_Aint                  * target_displs,
+  MPI_Win                   * win)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(entries[0].gptr.unitid);
+  dart_team_t      teamid       = entries[0].gptr.teamid;
+  int16_t          seg_id       = entries[0].gptr.segid;
+  size_t           type_size    = dart__mpi__datatype_sizeof(dtype);
+  bool             is_put       = (src != NULL);
+
+  *win = MPI_WIN_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_getv/putv ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_getv/putv ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // issue or complete buffered operations to the unit first
+  dart_ret_t ret = dart__mpi__aggregation_sync(
+                     team_data, team_unit_id, !is_put);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  char *baseptr = NULL;
+  if (team_data->unitid == team_unit_id.id) {
+    baseptr = seginfo->selfbaseptr;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  else if (seginfo->segid >= 0 &&
+           team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    baseptr = seginfo->baseptr[team_data->sharedmem_tab[team_unit_id.id].id];
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (baseptr != NULL) {
+    DART_LOG_TRACE("dart_getv/putv: memcpy of %d transfers on unit %d",
+                   num, team_unit_id.id);
+    for (int i = 0; i < num; ++i) {
+      size_t idx    = entries[i].idx;
+      char * target = baseptr + entries[i].gptr.addr_or_offs.offset;
+      size_t nbytes = nelem[idx] * type_size;
+      if (is_put) {
+        memcpy(target, src[idx], nbytes);
+      } else {
+        memcpy(dst[idx], target, nbytes);
+      }
+    }
+    return DART_OK;
+  }
+
+  MPI_Datatype mpi_type = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  MPI_Aint     disp     = dart_segment_disp(seginfo, team_unit_id);
+
+  // displacements at the target are relative to the lowest location
+  MPI_Aint base = entries[0].gptr.addr_or_offs.offset + disp;
+  for (int i = 0; i < num; ++i) {
+    size_t idx = entries[i].idx;
+    if (dart__unlikely(nelem[idx] > INT_MAX)) {
+      DART_LOG_ERROR("dart_getv/putv ! Transfer of %zu elements exceeds "
+                     "the maximum of INT_MAX", nelem[idx]);
+      return DART_ERR_INVAL;
+    }
+    blocklens[i]     = (int)nelem[idx];
+    target_displs[i] = entries[i].gptr.addr_or_offs.offset + disp - base;
+    MPI_Get_address(is_put ? src[idx] : dst[idx], &origin_displs[i]);
+  }
+
+  if (is_put) {
+    // puts to overlapping locations are not ordered within a transfer
+    for (int i = 1; i < num; ++i) {
+      MPI_Aint prev_end = target_displs[i-1] +
+                          (MPI_Aint)blocklens[i-1] * (MPI_Aint)type_size;
+      if (target_displs[i] < prev_end) {
+        DART_LOG_ERROR("dart_putv ! Overlapping target locations");
+        return DART_ERR_INVAL;
+      }
+    }
+  }
+
+  MPI_Datatype origin_type = MPI_DATATYPE_NULL;
+  MPI_Datatype target_type = MPI_DATATYPE_NULL;
+  const char * mpi_call    = "MPI_Type_create_hindexed";
+  int          mpi_ret     = MPI_Type_create_hindexed(
+                               num, blocklens, origin_displs, mpi_type,
+                               &origin_type);
+  if (mpi_ret != MPI_SUCCESS) {
+    origin_type = MPI_DATATYPE_NULL;
+    goto cleanup;
+  }
+  mpi_call = "MPI_Type_commit";
+  if ((mpi_ret = MPI_Type_commit(&origin_type)) != MPI_SUCCESS) {
+    goto cleanup;
+  }
+  mpi_call = "MPI_Type_create_hindexed";
+  mpi_ret  = MPI_Type_create_hindexed(num, blocklens, target_displs,
+                                      mpi_type, &target_type);
+  if (mpi_ret != MPI_SUCCESS) {
+    target_type = MPI_DATATYPE_NULL;
+    goto cleanup;
+  }
+  mpi_call = "MPI_Type_commit";
+  if ((mpi_ret = MPI_Type_commit(&target_type)) != MPI_SUCCESS) {
+    goto cleanup;
+  }
+
+  DART_LOG_TRACE("dart_getv/putv: packing %d transfers to unit %d",
+                 num, team_unit_id.id);
+  if (is_put) {
+    mpi_call = "MPI_Put";
+    mpi_ret  = MPI_Put(MPI_BOTTOM, 1, origin_type,
+                       team_unit_id.id, base, 1, target_type, seginfo->win);
+  } else {
+    mpi_call = "MPI_Get";
+    mpi_ret  = MPI_Get(MPI_BOTTOM, 1, origin_type,
+                       team_unit_id.id, base, 1, target_type, seginfo->win);
+  }
+  if (mpi_ret == MPI_SUCCESS) {
+    *win = seginfo->win;
+  }
+
+cleanup:
+  // the types may be freed while the transfer is pending
+  if (origin_type != MPI_DATATYPE_NULL) {
+    MPI_Type_free(&origin_type);
+  }
+  if (target_type != MPI_DATATYPE_NULL) {
+    MPI_Type_free(&target_type);
+  }
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_getv/putv ! %s failed!", mpi_call);
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+/**
+ * Gets into \c dst if \c src is \c NULL, puts from \c src otherwise.
+ */
+static dart_ret_t
+dart__mpi__vector_op(
+  const dart_gptr_t  * gptrs,
+  void       * const * dst,
+  const void * const * src,
+  const size_t       * nelem,
+  size_t               count,
+  dart_datatype_t      dtype)
+{
+  CHECK_IS_BASICTYPE(dtype);
+
+  if (count == 0) {
+    return DART_OK;
+  }
+  if (dart__unlikely(count > INT_MAX)) {
+    DART_LOG_ERROR("dart_getv/putv ! %zu transfers exceed the maximum of "
+                   "INT_MAX", count);
+    return DART_ERR_INVAL;
+  }
+
+  size_t *ones = NULL;
+  if (nelem == NULL) {
+    ones = malloc(count * sizeof(size_t));
+    if (ones == NULL) {
+      DART_LOG_ERROR("dart_getv/putv ! Failed to allocate %zu counts",
+                     count);
+      return DART_ERR_OTHER;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      ones[i] = 1;
+    }
+    nelem = ones;
+  }
+
+  dart_vector_entry_t *entries = malloc(count * sizeof(dart_vector_entry_t));
+  int      *blocklens     = malloc(count * sizeof(int));
+  MPI_Aint *origin_displs = malloc(count * sizeof(MPI_Aint));
+  MPI_Aint *target_displs = malloc(count * sizeof(MPI_Aint));
+  // windows and units to complete
+  MPI_Win  *wins          = malloc(count * sizeof(MPI_Win));
+  int      *units         = malloc(count * sizeof(int));
+  int       num_wins      = 0;
+
+  if (entries == NULL || blocklens == NULL || origin_displs == NULL ||
+      target_displs == NULL || wins == NULL || units == NULL) {
+    DART_LOG_ERROR("dart_getv/putv ! Failed to allocate buffers for %zu "
+                   "transfers", count);
+    free(units);
+    free(wins);
+    free(target_displs);
+    free(origin_displs);
+    free(blocklens);
+    free(entries);
+    free(ones);
+    return DART_ERR_OTHER;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    entries[i].gptr = gptrs[i];
+    entries[i].idx  = i;
+  }
+  qsort(entries, count, sizeof(dart_vector_entry_t), &cmp_vector_entry);
+
+  dart_ret_t ret = DART_OK;
+  for (size_t first = 0; first < count && ret == DART_OK; ) {
+    size_t last = first + 1;
+    while (last < count && same_vector_target(&entries[first],
+                                              &entries[last])) {
+      ++last;
+    }
+    MPI_Win win;
+    ret = dart__mpi__vector_issue(entries + first, last - first,
+                                  dst, src, nelem, dtype, blocklens,
+                                  origin_displs, target_displs, &win);
+    if (ret == DART_OK && win != MPI_WIN_NULL) {
+      wins[num_wins]  = win;
+      units[num_wins] = entries[first].gptr.unitid;
+      ++num_wins;
+    }
+    first = last;
+  }
+
+  // complete all transfers issued before an error
+  for (int i = 0; i < num_wins; ++i) {
+    if (MPI_Win_flush(units[i], wins[i]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_getv/putv ! MPI_Win_flush failed!");
+      ret = DART_ERR_OTHER;
+    }
+  }
+
+  free(units);
+  free(wins);
+  free(target_displs);
+  free(origin_displs);
+  free(blocklens);
+  free(entries);
+  free(ones);
+  return ret;
+}
+
+dart_ret_t dart_getv(
+  void              * const dest[],
+  const dart_gptr_t         gptrs[],
+  const size_t              nelem[],
+  size_t                    count,
+  dart_datatype_t           dtype)
+{
+  DART_LOG_DEBUG("dart_getv() count:%zu dtype:%d", count, dtype);
+  dart_ret_t ret = dart__mpi__vector_op(
+                     gptrs, dest, NULL, nelem, count, dtype);
+  DART_LOG_DEBUG("dart_getv > finished");
+  return ret;
+}
+
+dart_ret_t dart_putv(
+  const dart_gptr_t         gptrs[],
+  const void        * const src[],
+  const size_t              nelem[],
+  size_t                    count,
+  dart_datatype_t           dtype)
+{
+  DART_LOG_DEBUG("dart_putv() count:%zu dtype:%d", count, dtype);
+  dart_ret_t ret = dart__mpi__vector_op(
+                     gptrs, NULL, src, nelem, count, dtype);
+  DART_LOG_DEBUG("dart_putv > finished");
+  return ret;
+}
+
+/* -- Dart RMA Synchronization Operations -- */
+
+dart_ret_t dart_flush(
+  dart_gptr_t gptr)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  int16_t          seg_id       = gptr.segid;
+  dart_team_t      teamid       = gptr.teamid;
+  DART_LOG_DEBUG("dart_flush() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_flush ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_ret_t ret = dart__mpi__aggregation_issue(
+                     team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  MPI_Comm comm = team_data->comm;
+  MPI_Win  win  = seginfo->win;
+
+  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
+  CHECK_MPI_RET(
+    MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
+  CHECK_MPI_RET(
+    MPI_Win_sync(win), "MPI_Win_sync");
+
+  // trigger progress
+  int flag;
+  CHECK_MPI_RET(
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+    "MPI_Iprobe");
+
+  DART_LOG_DEBUG("dart_flush > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_all(
+  dart_gptr_t gptr)
+{
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  DART_LOG_DEBUG("dart_flush_all() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_get_blocking ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_ret_t ret = dart__mpi__aggregation_issue_all(team_data, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  MPI_Comm comm = team_data->comm;
+  MPI_Win  win  = seginfo->win;
+
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
+  CHECK_MPI_RET(
+    MPI_Win_flush_all(win), "MPI_Win_flush");
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
+  CHECK_MPI_RET(
+    MPI_Win_sync(win), "MPI_Win_sync");
+
+  // trigger progress
+  int flag;
+  CHECK_MPI_RET(
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+    "MPI_Iprobe");
+
+  DART_LOG_DEBUG("dart_flush_all > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_local(
+  dart_gptr_t gptr)
+{
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  DART_LOG_DEBUG("dart_flush_local() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_flush_local ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+  // buffered operations are completed locally when issued
+  dart_ret_t ret = dart__mpi__aggregation_issue(
+                     team_data, team_unit_id, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  MPI_Comm comm = team_data->comm;
+  MPI_Win  win  = seginfo->win;
+
+  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
   CHECK_MPI_RET(
     MPI_Win_flush_local(team_unit_id.id, win),
     "MPI_Win_flush_local");
@@ -1227,6 +2010,12 @@ dart_ret_t dart_flush_local_all(
     return DART_ERR_INVAL;
   }
 
+  // buffered operations are completed locally when issued
+  dart_ret_t ret = dart__mpi__aggregation_issue_all(team_data, false);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
@@ -1263,7 +2052,7 @@ dart_ret_t dart_wait_local(
     } else {
       DART_LOG_TRACE("dart_wait_local:     handle->num_reqs == 0");
     }
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
@@ -1295,7 +2084,7 @@ dart_ret_t dart_wait(
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
     /* Free handle resource */
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
@@ -1362,7 +2151,7 @@ dart_ret_t dart_waitall_local(
         DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1469,7 +2258,7 @@ dart_ret_t dart_waitall(
         DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1504,7 +2293,7 @@ dart_ret_t dart_test_local(
 
   if (flag) {
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1552,7 +2341,7 @@ dart_ret_t dart_testall_local(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_free(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1588,6 +2377,12 @@ dart_ret_t dart_barrier(
     return DART_ERR_INVAL;
   }
 
+  /* Buffered operations have to complete before the barrier. */
+  dart_ret_t ret = dart__mpi__aggregation_issue_all(team_data, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
   /* Fetch proper communicator from teams. */
   CHECK_MPI_RET(
     MPI_Barrier(team_data->comm), "MPI_Barrier");
@@ -1908,24 +2703,300 @@ dart_ret_t dart_allgatherv(
   return DART_OK;
 }
 
-dart_ret_t dart_allreduce(
-  const void       * sendbuf,
-  void             * recvbuf,
-  size_t             nelem,
-  dart_datatype_t    dtype,
-  dart_operation_t   op,
-  dart_team_t        team)
+/**
+ * Personalized all-to-all exchange in point-to-point messages of at most
+ * MAX_CONTIG_ELEMENTS elements, used for counts or displacements that
+ * exceed the range of MPI collectives. A null send buffer denotes
+ * in-place exchange.
+ * Collective on the team, messages are exchanged on a duplicate of the
+ * team's communicator to not match point-to-point messages of the
+ * application, e.g. in \c dart_send and \c dart_recv.
+ */
+static dart_ret_t dart__mpi__alltoallv_chunked(
+  const char             * sendbuf,
+  const size_t           * nsendelem,
+  const size_t           * senddispls,
+  char                   * recvbuf,
+  const size_t           * nrecvelem,
+  const size_t           * recvdispls,
+  dart_datatype_t          dtype,
+  const dart_team_data_t * team_data)
 {
-
-  CHECK_IS_BASICTYPE(dtype);
-
-  MPI_Op       mpi_op    = dart__mpi__op(op);
+  const int    tag       = 0;
+  const int    nunits    = team_data->size;
+  const size_t elem_size = dart__mpi__datatype_sizeof(dtype);
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+  size_t nreqs = 0;
+  for (int u = 0; u < nunits; ++u) {
+    nreqs += (nsendelem[u] + MAX_CONTIG_ELEMENTS - 1) / MAX_CONTIG_ELEMENTS;
+    nreqs += (nrecvelem[u] + MAX_CONTIG_ELEMENTS - 1) / MAX_CONTIG_ELEMENTS;
+  }
+  MPI_Request *reqs   = malloc(sizeof(MPI_Request) * (nreqs + 1));
+  char        *tmpbuf = NULL;
+  if (sendbuf == NULL) {
+    // the chunked exchange requires a separate send buffer
+    size_t nbytes = 0;
+    for (int i = 0; i < nunits; i++) {
+      size_t end = (recvdispls[i] + nrecvelem[i]) * elem_size;
+      if (end > nbytes) nbytes = end;
+    }
+    tmpbuf = malloc(nbytes + 1);
+    if (tmpbuf != NULL) {
+      memcpy(tmpbuf, recvbuf, nbytes);
+    }
+    sendbuf = tmpbuf;
+  }
+  // Units must agree on failed allocations before any message is posted:
+  int ok = (reqs != NULL && sendbuf != NULL);
+  if (MPI_Allreduce(MPI_IN_PLACE, &ok, 1, MPI_INT, MPI_LAND,
+                    team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! MPI_Allreduce failed");
+    ok = 0;
+  } else if (!ok) {
+    DART_LOG_ERROR("dart_alltoallv ! Failed to allocate buffers for "
+                   "chunked exchange");
+  }
+  MPI_Comm comm = MPI_COMM_NULL;
+  if (ok && MPI_Comm_dup(team_data->comm, &comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! MPI_Comm_dup failed");
+    ok = 0;
+  }
+  if (!ok) {
+    free(reqs);
+    free(tmpbuf);
+    return DART_ERR_OTHER;
+  }
+
+  size_t r = 0;
+  // Post receives first, chunks of a message are matched in order:
+  for (int i = 0; i < nunits; ++i) {
+    int u = (team_data->unitid + nunits - i) % nunits;
+    for (size_t offset = 0; offset < nrecvelem[u];
+         offset += MAX_CONTIG_ELEMENTS) {
+      size_t nchunk = nrecvelem[u] - offset;
+      if (nchunk > MAX_CONTIG_ELEMENTS) nchunk = MAX_CONTIG_ELEMENTS;
+      MPI_Irecv(recvbuf + (recvdispls[u] + offset) * elem_size,
+                nchunk, mpi_dtype, u, tag, comm, &reqs[r++]);
+    }
+  }
+  for (int i = 0; i < nunits; ++i) {
+    int u = (team_data->unitid + i) % nunits;
+    for (size_t offset = 0; offset < nsendelem[u];
+         offset += MAX_CONTIG_ELEMENTS) {
+      size_t nchunk = nsendelem[u] - offset;
+      if (nchunk > MAX_CONTIG_ELEMENTS) nchunk = MAX_CONTIG_ELEMENTS;
+      MPI_Isend(sendbuf + (senddispls[u] + offset) * elem_size,
+                nchunk, mpi_dtype, u, tag, comm, &reqs[r++]);
+    }
+  }
+  int ret = MPI_Waitall(r, reqs, MPI_STATUSES_IGNORE);
+  free(reqs);
+  free(tmpbuf);
+  MPI_Comm_free(&comm);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! MPI_Waitall failed");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (nelem <= MAX_CONTIG_ELEMENTS) {
+    if (sendbuf == recvbuf || NULL == sendbuf) {
+      sendbuf = MPI_IN_PLACE;
+    }
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Alltoall(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm),
+      "MPI_Alltoall");
+  } else {
+    // Blocks exceed the range of MPI counts, exchange in chunks:
+    size_t  nunits = team_data->size;
+    size_t *counts = malloc(sizeof(size_t) * nunits);
+    size_t *displs = malloc(sizeof(size_t) * nunits);
+    if (counts == NULL || displs == NULL) {
+      DART_LOG_ERROR("dart_alltoall ! Failed to allocate counts for %zu "
+                     "units", nunits);
+      free(counts);
+      free(displs);
+      return DART_ERR_OTHER;
+    }
+    for (size_t u = 0; u < nunits; ++u) {
+      counts[u] = nelem;
+      displs[u] = u * nelem;
+    }
+    dart_ret_t ret = dart_alltoallv(sendbuf, counts, displs,
+                                    recvbuf, counts, displs,
+                                    dtype, teamid);
+    free(counts);
+    free(displs);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  int  nunits   = team_data->size;
+  bool in_place = (sendbuf == recvbuf || NULL == sendbuf);
+  if (in_place) {
+    nsendelem  = nrecvelem;
+    senddispls = recvdispls;
+  }
+
+  int *isendcounts = malloc(sizeof(int) * nunits);
+  int *isenddispls = malloc(sizeof(int) * nunits);
+  int *irecvcounts = malloc(sizeof(int) * nunits);
+  int *irecvdispls = malloc(sizeof(int) * nunits);
+
+  // Exchange method agreed on by all units: chunked exchange if counts or
+  // displacements exceed INT_MAX at any unit, no exchange if allocation
+  // failed at any unit
+  enum {
+    ALLTOALLV_FAILED  = 0,
+    ALLTOALLV_CHUNKED = 1,
+    ALLTOALLV_MPI     = 2
+  };
+  int method = ALLTOALLV_MPI;
+  if (isendcounts == NULL || isenddispls == NULL ||
+      irecvcounts == NULL || irecvdispls == NULL) {
+    method = ALLTOALLV_FAILED;
+  }
+  for (int i = 0; i < nunits && method == ALLTOALLV_MPI; i++) {
+    if (nsendelem[i]  > MAX_CONTIG_ELEMENTS ||
+        senddispls[i] > MAX_CONTIG_ELEMENTS ||
+        nrecvelem[i]  > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i] > MAX_CONTIG_ELEMENTS) {
+      method = ALLTOALLV_CHUNKED;
+    }
+  }
+  int ret = MPI_Allreduce(MPI_IN_PLACE, &method, 1, MPI_INT, MPI_MIN,
+                          team_data->comm);
+  if (ret != MPI_SUCCESS || method != ALLTOALLV_MPI) {
+    free(isendcounts);
+    free(isenddispls);
+    free(irecvcounts);
+    free(irecvdispls);
+  }
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d MPI_Allreduce failed", teamid);
+    return DART_ERR_OTHER;
+  }
+  if (method == ALLTOALLV_FAILED) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d Failed to allocate counts",
+                   teamid);
+    return DART_ERR_OTHER;
+  }
+  if (method == ALLTOALLV_CHUNKED) {
+    DART_LOG_DEBUG("dart_alltoallv: counts exceed INT_MAX, "
+                   "exchanging in chunks");
+    return dart__mpi__alltoallv_chunked(
+             in_place ? NULL : sendbuf, nsendelem, senddispls,
+             recvbuf, nrecvelem, recvdispls,
+             dtype, team_data);
+  }
+
+  for (int i = 0; i < nunits; i++) {
+    isendcounts[i] = nsendelem[i];
+    isenddispls[i] = senddispls[i];
+    irecvcounts[i] = nrecvelem[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  ret = MPI_Alltoallv(
+          in_place ? MPI_IN_PLACE : sendbuf,
+          isendcounts,
+          isenddispls,
+          mpi_dtype,
+          recvbuf,
+          irecvcounts,
+          irecvdispls,
+          mpi_dtype,
+          team_data->comm);
+  free(isendcounts);
+  free(isenddispls);
+  free(irecvcounts);
+  free(irecvdispls);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d MPI_Alltoallv failed", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  if (dart__unlikely(mpi_dtype == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! operation not defined on given type", __FUNCTION__);
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
     DART_LOG_ERROR("dart_allreduce ! failed: nelem (%zu) > INT_MAX", nelem);
     return DART_ERR_INVAL;
   }
@@ -1960,7 +3031,11 @@ dart_ret_t dart_reduce(
   MPI_Comm     comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Op       mpi_op    = dart__mpi__op(op);
-  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  if (dart__unlikely(mpi_dtype == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! operation not defined on given type", __FUNCTION__);
+    return DART_ERR_INVAL;
+  }
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
@@ -1991,6 +3066,307 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+dart_ret_t dart_scan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  if (dart__unlikely(mpi_dtype == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! operation not defined on given type", __FUNCTION__);
+    return DART_ERR_INVAL;
+  }
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_scan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_scan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Scan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Scan");
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  if (dart__unlikely(mpi_dtype == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! operation not defined on given type", __FUNCTION__);
+    return DART_ERR_INVAL;
+  }
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Exscan");
+  return DART_OK;
+}
+
+/**
+ * Allocates a handle for a non-blocking collective operation.
+ * The handle does not refer to a window and requires no flush, it is
+ * completed by \c dart_wait and the like as any other handle.
+ *
+ * \return  The handle or \c DART_HANDLE_NULL if allocation failed.
+ */
+static dart_handle_t dart__mpi__collective_handle()
+{
+  return dart__mpi__handle_alloc();
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_ret_t ret = dart__mpi__aggregation_issue_all(team_data, true);
+  if (dart__unlikely(ret != DART_OK)) {
+    return ret;
+  }
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Ibarrier(team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > handle(%p)", (void*)(handle));
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, using one request per chunk
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (nchunks > 0) {
+    if (MPI_Ibcast(src_ptr, nchunks,
+                   dart__mpi__datatype_maxtype(dtype),
+                   root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      dart__mpi__handle_free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS *
+               dart__mpi__datatype_sizeof(dtype);
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    if (MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      MPI_Waitall(handle->num_reqs, handle->reqs, MPI_STATUSES_IGNORE);
+      dart__mpi__handle_free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > handle(%p) requests:%d",
+                 (void*)(handle), handle->num_reqs);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        teamid,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  if (dart__unlikely(mpi_dtype == MPI_DATATYPE_NULL)) {
+    DART_LOG_ERROR("%s ! operation not defined on given type", __FUNCTION__);
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Iallreduce(sendbuf, recvbuf, nelem, mpi_dtype, mpi_op,
+                     team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > handle(%p)", (void*)(handle));
+  return DART_OK;
+}
+
+dart_ret_t dart_iallgather(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_team_t        teamid,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype  mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  dart_handle_t handle    = dart__mpi__collective_handle();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Iallgather(sendbuf, nelem, mpi_dtype,
+                     recvbuf, nelem, mpi_dtype,
+                     team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgather ! MPI_Iallgather failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallgather > handle(%p)", (void*)(handle));
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -2,7 +2,20 @@
 #include <dash/dart/if/dart_config.h>
 #include <dash/dart/if/dart_types.h>
 
-dart_config_t dart_config_ = { 1 };
+#include <dash/dart/mpi/dart_team_heap.h>
+#include <dash/dart/mpi/dart_aggregation.h>
+#include <dash/dart/mpi/dart_progress.h>
+#include <dash/dart/mpi/dart_mem.h>
+
+dart_config_t dart_config_ = { 1,
+                               DART_TEAM_HEAP_DEFAULT_SIZE,
+                               DART_AGGREGATION_DEFAULT_BUFFER_SIZE,
+                               0,
+                               0,
+                               DART_PROGRESS_DEFAULT_INTERVAL,
+                               -1,
+                               DART_LOCAL_ALLOC_DEFAULT_SIZE,
+                               0 };
 
 void dart_config(
   dart_config_t ** config_out)
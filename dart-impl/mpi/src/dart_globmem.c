@@ -18,8 +18,10 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_slab.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_team_heap.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 
 #include <stdio.h>
@@ -134,10 +136,15 @@ dart_ret_t dart_memalloc(
   gptr->flags   = 0;
   gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+  if (dart_localpool_buddy != NULL) {
+    gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool_buddy,
+                                                 nbytes);
+  } else {
+    gptr->addr_or_offs.offset = dart_slab_alloc(dart_localpool, nbytes);
+  }
+  if (gptr->addr_or_offs.offset == DART_SLAB_ALLOC_FAILED) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                   "(%zu bytes): global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
@@ -155,7 +162,10 @@ dart_ret_t dart_memfree (dart_gptr_t gptr)
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  int ret = (dart_localpool_buddy != NULL)
+            ? dart_buddy_free(dart_localpool_buddy, gptr.addr_or_offs.offset)
+            : dart_slab_free(dart_localpool, gptr.addr_or_offs.offset);
+  if (ret == -1) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -440,14 +450,13 @@ dart_team_memalloc_aligned_full(
   return DART_OK;
 }
 
-dart_ret_t
-dart_team_memalloc_aligned(
+static dart_ret_t
+dart_team_memalloc_aligned_window(
   dart_team_t       teamid,
   size_t            nelem,
   dart_datatype_t   dtype,
   dart_gptr_t     * gptr)
 {
-  CHECK_IS_BASICTYPE(dtype);
 #ifdef DART_MPI_ENABLE_DYNAMIC_WINDOWS
   return dart_team_memalloc_aligned_dynamic(teamid, nelem, dtype, gptr);
 #else
@@ -455,6 +464,147 @@ dart_team_memalloc_aligned(
 #endif
 }
 
+/**
+ * Serves a collective allocation from the symmetric heap of the team.
+ * The heap memory is allocated in a single window segment on first use,
+ * allocations in the heap are registered as separate segments referring
+ * to the heap's window at the same offset on every unit.
+ */
+static dart_ret_t
+dart_team_memalloc_aligned_heap(
+  dart_team_data_t * team_data,
+  size_t             nbytes,
+  dart_gptr_t      * gptr)
+{
+  dart_team_heap_t *heap = &team_data->heap;
+
+  if (heap->segid == 0) {
+    dart_gptr_t heap_gptr;
+    if (dart_team_memalloc_aligned_window(
+          team_data->teamid, heap->size, DART_TYPE_BYTE, &heap_gptr)
+        != DART_OK) {
+      DART_LOG_ERROR("dart_team_memalloc_aligned_heap: "
+                     "allocation of team heap (%zu bytes) failed, "
+                     "disabling heap of team %d",
+                     heap->size, team_data->teamid);
+      dart_team_heap_fini(heap);
+      heap->size = 0;
+      return DART_ERR_OTHER;
+    }
+    heap->segid = heap_gptr.segid;
+    DART_LOG_DEBUG("dart_team_memalloc_aligned_heap: "
+                   "allocated team heap of %zu bytes in segment %d",
+                   heap->size, heap->segid);
+  }
+
+  size_t offset;
+  if (dart_team_heap_alloc(heap, nbytes, &offset) != DART_OK) {
+    return DART_ERR_NOTFOUND;
+  }
+
+  // Allocation through a window synchronizes the team, callers rely on
+  // allocations being completed on all units on return:
+  if (MPI_Barrier(team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned_heap: MPI_Barrier failed");
+    dart_team_heap_free(heap, offset, nbytes);
+    return DART_ERR_OTHER;
+  }
+
+  dart_segment_info_t *heapseg = dart_segment_get_info(
+                                   &team_data->segdata, heap->segid);
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                   &team_data->segdata, DART_SEGMENT_ALLOC);
+
+  // re-use previously allocated memory
+  if (segment->disp == NULL) {
+    segment->disp = malloc(team_data->size * sizeof(MPI_Aint));
+  }
+  for (int u = 0; u < team_data->size; ++u) {
+    segment->disp[u] = dart_segment_disp(heapseg, DART_TEAM_UNIT_ID(u))
+                       + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (heapseg->baseptr != NULL) {
+    if (segment->baseptr == NULL) {
+      segment->baseptr = calloc(team_data->sharedmem_nodesize,
+                                sizeof(char *));
+    }
+    for (int i = 0; i < team_data->sharedmem_nodesize; ++i) {
+      segment->baseptr[i] = heapseg->baseptr[i] + offset;
+    }
+  } else if (segment->baseptr != NULL) {
+    free(segment->baseptr);
+    segment->baseptr = NULL;
+  }
+#endif
+  segment->size        = nbytes;
+  segment->flags       = 0;
+  segment->shmwin      = heapseg->shmwin;
+  segment->win         = heapseg->win;
+  segment->selfbaseptr = heapseg->selfbaseptr + offset;
+  segment->is_dynamic  = heapseg->is_dynamic;
+  segment->is_pooled   = true;
+
+  gptr->segid  = segment->segid;
+  gptr->unitid = 0;
+  gptr->teamid = team_data->teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  heap->num_pooled++;
+
+  DART_LOG_DEBUG("dart_team_memalloc_aligned_heap: bytes:%zu offset:%zu "
+                 "segid:%i across team %d",
+                 nbytes, offset, segment->segid, team_data->teamid);
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart_team_memalloc_aligned(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t     * gptr)
+{
+  CHECK_IS_BASICTYPE(dtype);
+
+  *gptr = DART_GPTR_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned ! Unknown team %i", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // All units allocate the same size in the same order, the decision
+  // whether to use the heap is consistent across the team:
+  size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+  if (dart_team_heap_accepts(&team_data->heap, nbytes) &&
+      dart_team_memalloc_aligned_heap(team_data, nbytes, gptr) == DART_OK) {
+    return DART_OK;
+  }
+  team_data->heap.num_windows++;
+  return dart_team_memalloc_aligned_window(teamid, nelem, dtype, gptr);
+}
+
+void
+dart__mpi__team_heap_release(dart_team_data_t *team_data)
+{
+  dart_team_heap_t *heap = &team_data->heap;
+  DART_LOG_INFO("dart__mpi__team_heap_release: team %d: "
+                "%zu allocations from team heap, %zu window allocations",
+                team_data->teamid, heap->num_pooled, heap->num_windows);
+  if (heap->segid != 0) {
+    dart_gptr_t heap_gptr = DART_GPTR_NULL;
+    heap_gptr.segid  = heap->segid;
+    heap_gptr.teamid = team_data->teamid;
+    heap_gptr.unitid = 0;
+    dart_team_memfree(heap_gptr);
+  }
+  dart_team_heap_fini(heap);
+}
+
 dart_ret_t dart_team_memfree(
   dart_gptr_t gptr)
 {
@@ -481,7 +631,32 @@ dart_ret_t dart_team_memfree(
     return DART_ERR_INVAL;
   }
 
-  if (seginfo->is_dynamic) {
+  // buffered operations may target the segment
+  dart_ret_t ret = dart__mpi__aggregation_issue_all(team_data, true);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_team_memfree ! "
+                   "Failed to flush aggregated operations on segment %i",
+                   segid);
+    return ret;
+  }
+
+  if (seginfo->is_pooled) {
+    // The range can be handed out again by the next allocation, which
+    // synchronizes the team. Pending operations of this unit on the
+    // segment must complete first, as freeing a window completes them
+    // for full allocations.
+    if (MPI_Win_flush_all(seginfo->win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_team_memfree: MPI_Win_flush_all failed");
+      return DART_ERR_OTHER;
+    }
+    // return the allocation to the team heap
+    dart_segment_info_t *heapseg = dart_segment_get_info(
+                                     &team_data->segdata,
+                                     team_data->heap.segid);
+    dart_team_heap_free(&team_data->heap,
+                        seginfo->selfbaseptr - heapseg->selfbaseptr,
+                        seginfo->size);
+  } else if (seginfo->is_dynamic) {
     MPI_Win win = team_data->window;
     if (dart_segment_get_selfbaseptr(
           &team_data->segdata, segid, &sub_mem) != DART_OK) {
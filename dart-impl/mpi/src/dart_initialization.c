@@ -11,6 +11,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/if/dart_config.h>
 
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
@@ -19,8 +20,8 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
-
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
+#include <dash/dart/mpi/dart_progress.h>
+#include <dash/dart/mpi/dart_slab.h>
 
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
@@ -29,7 +30,30 @@ static int _dart_initialized = 0;
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  dart_config_t *config;
+  dart_config(&config);
+  size_t local_alloc_size = config->local_alloc_size;
+  if (config->local_alloc_buddy) {
+    // the buddy allocator requires a power of two
+    size_t pow2 = 1;
+    while (pow2 < local_alloc_size) {
+      pow2 <<= 1;
+    }
+    local_alloc_size     = pow2;
+    dart_localpool_buddy = dart_buddy_new(local_alloc_size);
+    if (dart_localpool_buddy == NULL) {
+      return DART_ERR_OTHER;
+    }
+  } else {
+    dart_localpool = dart_slab_new(true);
+    if (dart_localpool == NULL ||
+        dart_slab_add_region(dart_localpool, 0, local_alloc_size)
+          != DART_OK) {
+      DART_LOG_ERROR("dart_init: failed to create local allocator "
+                     "for %zu bytes", local_alloc_size);
+      return DART_ERR_OTHER;
+    }
+  }
   MPI_Win dart_sharedmem_win_local_alloc;
   char* *dart_sharedmem_local_baseptr_set = NULL;
 
@@ -40,15 +64,15 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   local_alloc_size);
     MPI_Info win_info;
     MPI_Info_create(&win_info);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                local_alloc_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -92,7 +116,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   }
 #else
   MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     MPI_INFO_NULL,
     &dart_mempool_localalloc);
 #endif
@@ -103,7 +127,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     sizeof(char),
     MPI_INFO_NULL,
     DART_COMM_WORLD,
@@ -121,7 +145,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
                                 &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC);
   segment->flags       = 1;
   segment->segid       = 0;
-  segment->size        = DART_LOCAL_ALLOC_SIZE;
+  segment->size        = local_alloc_size;
   segment->baseptr     = dart_sharedmem_local_baseptr_set;
   segment->win         = dart_win_local_alloc;
   segment->shmwin      = dart_sharedmem_win_local_alloc;
@@ -133,9 +157,103 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   return DART_OK;
 }
 
+/**
+ * Reads a size in bytes from environment variable \c name, accepts
+ * suffixes K, M and G. Returns false if the variable is not set.
+ */
+static
+bool read_size_env(const char *name, size_t *size_out)
+{
+  const char *envstr = getenv(name);
+  if (envstr == NULL) {
+    return false;
+  }
+  char   *suffix;
+  size_t  size = strtoull(envstr, &suffix, 10);
+  switch (*suffix) {
+    case 'g':
+    case 'G': size *= 1024;
+    /* fall through */
+    case 'm':
+    case 'M': size *= 1024;
+    /* fall through */
+    case 'k':
+    case 'K': size *= 1024;
+    /* fall through */
+    default : break;
+  }
+  *size_out = size;
+  return true;
+}
+
+/**
+ * Reads an integer from environment variable \c name.
+ * Returns false if the variable is not set.
+ */
+static
+bool read_int_env(const char *name, int *value_out)
+{
+  const char *envstr = getenv(name);
+  if (envstr == NULL) {
+    return false;
+  }
+  *value_out = atoi(envstr);
+  return true;
+}
+
+/**
+ * Reads the size of team heaps from environment variable
+ * \c DART_TEAM_HEAP_SIZE, the size of aggregation buffers from
+ * \c DART_AGGREGATION_BUFFER_SIZE, whether processor atomics are used
+ * on node-local memory from \c DART_LOCAL_ATOMICS and the settings of the
+ * progress thread from \c DART_PROGRESS_THREAD, \c DART_PROGRESS_INTERVAL
+ * and \c DART_PROGRESS_CPU and the local allocation pool from
+ * \c DART_LOCAL_ALLOC_SIZE and \c DART_LOCAL_ALLOC_BUDDY.
+ */
+static
+void init_config()
+{
+  dart_config_t *config;
+  dart_config(&config);
+  if (read_size_env("DART_TEAM_HEAP_SIZE", &config->team_heap_size)) {
+    DART_LOG_DEBUG("dart_init: team heap size: %zu bytes",
+                   config->team_heap_size);
+  }
+  if (read_size_env("DART_AGGREGATION_BUFFER_SIZE",
+                    &config->aggregation_buffer_size)) {
+    DART_LOG_DEBUG("dart_init: aggregation buffer size: %zu bytes",
+                   config->aggregation_buffer_size);
+  }
+  if (read_int_env("DART_LOCAL_ATOMICS", &config->local_atomics)) {
+    DART_LOG_DEBUG("dart_init: local atomics: %d", config->local_atomics);
+  }
+  if (read_int_env("DART_PROGRESS_THREAD", &config->progress_thread)) {
+    DART_LOG_DEBUG("dart_init: progress thread: %d",
+                   config->progress_thread);
+  }
+  if (read_int_env("DART_PROGRESS_INTERVAL", &config->progress_interval)) {
+    DART_LOG_DEBUG("dart_init: progress interval: %d us",
+                   config->progress_interval);
+  }
+  if (read_int_env("DART_PROGRESS_CPU", &config->progress_cpu)) {
+    DART_LOG_DEBUG("dart_init: progress thread CPU: %d",
+                   config->progress_cpu);
+  }
+  if (read_size_env("DART_LOCAL_ALLOC_SIZE", &config->local_alloc_size)) {
+    DART_LOG_DEBUG("dart_init: local allocation pool size: %zu bytes",
+                   config->local_alloc_size);
+  }
+  if (read_int_env("DART_LOCAL_ALLOC_BUDDY", &config->local_alloc_buddy)) {
+    DART_LOG_DEBUG("dart_init: local buddy allocator: %d",
+                   config->local_alloc_buddy);
+  }
+}
+
 static
 dart_ret_t do_init()
 {
+  init_config();
+
   /* Initialize the teamlist. */
   dart_adapt_teamlist_init();
 
@@ -186,12 +304,22 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  ret = dart__mpi__notify_init(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
 
   dart__mpi__locality_init();
 
+  ret = dart__mpi__progress_init();
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   _dart_initialized = 2;
 
   DART_LOG_DEBUG("dart_init > initialization finished");
@@ -277,6 +405,8 @@ dart_ret_t dart_exit()
   dart_global_unit_t unitid;
   dart_myid(&unitid);
 
+  dart__mpi__progress_fini();
+
   dart__mpi__locality_finalize();
 
   _dart_initialized = 0;
@@ -289,6 +419,11 @@ dart_ret_t dart_exit()
     return DART_ERR_OTHER;
   }
 
+  dart__mpi__aggregation_issue_all(team_data, true);
+
+  dart__mpi__team_heap_release(team_data);
+  dart__mpi__notify_fini(team_data);
+
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
@@ -316,7 +451,13 @@ dart_ret_t dart_exit()
   MPI_Win_free(&team_data->window);
 
   dart_segment_fini(&team_data->segdata);
-  dart_buddy_delete(dart_localpool);
+  if (dart_localpool_buddy != NULL) {
+    dart_buddy_delete(dart_localpool_buddy);
+    dart_localpool_buddy = NULL;
+  } else {
+    dart_slab_delete(dart_localpool);
+    dart_localpool = NULL;
+  }
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
 //  free(dart_sharedmem_local_baseptr_set);
@@ -326,6 +467,8 @@ dart_ret_t dart_exit()
 
   MPI_Comm_free(&dart_comm_world);
 
+  dart__mpi__handle_pool_fini();
+
   dart__mpi__datatype_fini();
 
   if (_init_by_dart) {
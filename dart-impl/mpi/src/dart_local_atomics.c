@@ -0,0 +1,243 @@
+/**
+ * \file dart_local_atomics.c
+ *
+ * Atomic operations on node-local memory using processor atomics.
+ */
+
+#include <dash/dart/if/dart_types.h>
+
+#include <dash/dart/mpi/dart_local_atomics.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#define DART_LOCAL_ATOMICS_ORDER __ATOMIC_SEQ_CST
+
+/**
+ * Stores the result of the arithmetic or logical operation \c _op on
+ * \c _a and \c _b in \c _res, evaluates to false for bitwise operations.
+ */
+#define DART_LOCAL_ATOMICS_APPLY(_op, _a, _b, _res)                 \
+  ({                                                                 \
+    bool __valid = true;                                             \
+    switch (_op) {                                                   \
+      case DART_OP_MIN:  _res = ((_a) < (_b)) ? (_a) : (_b); break;  \
+      case DART_OP_MAX:  _res = ((_a) > (_b)) ? (_a) : (_b); break;  \
+      case DART_OP_SUM:  _res = (_a) + (_b);                 break;  \
+      case DART_OP_PROD: _res = (_a) * (_b);                 break;  \
+      case DART_OP_LAND: _res = (_a) && (_b);                break;  \
+      case DART_OP_LOR:  _res = (_a) || (_b);                break;  \
+      case DART_OP_LXOR: _res = !(_a) != !(_b);              break;  \
+      default:           __valid = false;                    break;  \
+    }                                                                \
+    __valid;                                                         \
+  })
+
+/**
+ * Defines the fetch-and-op of an integral type, arithmetic and logical
+ * operations are only defined if \c _arith is true.
+ */
+#define DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(_name, _type, _arith)            \
+static bool fetch_and_op_##_name(                                           \
+  void * addr, const void * value, void * result, dart_operation_t op)     \
+{                                                                           \
+  _type * ptr = (_type *)addr;                                              \
+  _type   val;                                                              \
+  _type   prev;                                                             \
+  memcpy(&val, value, sizeof(_type));                                       \
+  switch (op) {                                                             \
+    case DART_OP_BAND:                                                      \
+      prev = __atomic_fetch_and(ptr, val, DART_LOCAL_ATOMICS_ORDER);        \
+      break;                                                                \
+    case DART_OP_BOR:                                                       \
+      prev = __atomic_fetch_or(ptr, val, DART_LOCAL_ATOMICS_ORDER);         \
+      break;                                                                \
+    case DART_OP_BXOR:                                                      \
+      prev = __atomic_fetch_xor(ptr, val, DART_LOCAL_ATOMICS_ORDER);        \
+      break;                                                                \
+    case DART_OP_REPLACE:                                                   \
+      prev = __atomic_exchange_n(ptr, val, DART_LOCAL_ATOMICS_ORDER);       \
+      break;                                                                \
+    case DART_OP_NO_OP:                                                     \
+      prev = __atomic_load_n(ptr, DART_LOCAL_ATOMICS_ORDER);                \
+      break;                                                                \
+    case DART_OP_SUM:                                                       \
+      if (!(_arith)) return false;                                          \
+      prev = __atomic_fetch_add(ptr, val, DART_LOCAL_ATOMICS_ORDER);        \
+      break;                                                                \
+    default: {                                                              \
+      _type next = 0;                                                       \
+      prev = __atomic_load_n(ptr, __ATOMIC_RELAXED);                        \
+      if (!(_arith) || !DART_LOCAL_ATOMICS_APPLY(op, prev, val, next)) {    \
+        return false;                                                       \
+      }                                                                     \
+      while (!__atomic_compare_exchange_n(                                  \
+                ptr, &prev, next, true,                                     \
+                DART_LOCAL_ATOMICS_ORDER, __ATOMIC_RELAXED)) {              \
+        (void)DART_LOCAL_ATOMICS_APPLY(op, prev, val, next);                \
+      }                                                                     \
+      break;                                                                \
+    }                                                                       \
+  }                                                                         \
+  if (result != NULL) {                                                     \
+    memcpy(result, &prev, sizeof(_type));                                   \
+  }                                                                         \
+  return true;                                                              \
+}                                                                           \
+                                                                            \
+static bool compare_and_swap_##_name(                                       \
+  void * addr, const void * value, const void * compare, void * result)    \
+{                                                                           \
+  _type val;                                                                \
+  _type prev;                                                               \
+  memcpy(&val,  value,   sizeof(_type));                                    \
+  memcpy(&prev, compare, sizeof(_type));                                    \
+  __atomic_compare_exchange_n(                                              \
+    (_type *)addr, &prev, val, false,                                       \
+    DART_LOCAL_ATOMICS_ORDER, DART_LOCAL_ATOMICS_ORDER);                    \
+  memcpy(result, &prev, sizeof(_type));                                     \
+  return true;                                                              \
+}
+
+/**
+ * Defines the fetch-and-op of a floating point type, the value is
+ * updated through its representation as unsigned integer \c _utype.
+ */
+#define DART_LOCAL_ATOMICS_DEFINE_FLOATING(_name, _type, _utype)            \
+static bool fetch_and_op_##_name(                                           \
+  void * addr, const void * value, void * result, dart_operation_t op)     \
+{                                                                           \
+  _utype * ptr = (_utype *)addr;                                            \
+  _utype   uprev;                                                           \
+  _utype   unext;                                                           \
+  _type    val;                                                             \
+  _type    prev;                                                            \
+  _type    next = 0;                                                        \
+  memcpy(&val, value, sizeof(_type));                                       \
+  switch (op) {                                                             \
+    case DART_OP_REPLACE:                                                   \
+      memcpy(&unext, &val, sizeof(_type));                                  \
+      uprev = __atomic_exchange_n(ptr, unext, DART_LOCAL_ATOMICS_ORDER);    \
+      break;                                                                \
+    case DART_OP_NO_OP:                                                     \
+      uprev = __atomic_load_n(ptr, DART_LOCAL_ATOMICS_ORDER);               \
+      break;                                                                \
+    case DART_OP_MIN:                                                       \
+    case DART_OP_MAX:                                                       \
+    case DART_OP_SUM:                                                       \
+    case DART_OP_PROD:                                                      \
+      uprev = __atomic_load_n(ptr, __ATOMIC_RELAXED);                       \
+      do {                                                                  \
+        memcpy(&prev, &uprev, sizeof(_type));                               \
+        (void)DART_LOCAL_ATOMICS_APPLY(op, prev, val, next);                \
+        memcpy(&unext, &next, sizeof(_type));                               \
+      } while (!__atomic_compare_exchange_n(                                \
+                  ptr, &uprev, unext, true,                                 \
+                  DART_LOCAL_ATOMICS_ORDER, __ATOMIC_RELAXED));             \
+      break;                                                                \
+    default:                                                                \
+      return false;                                                         \
+  }                                                                         \
+  if (result != NULL) {                                                     \
+    memcpy(result, &uprev, sizeof(_type));                                  \
+  }                                                                         \
+  return true;                                                              \
+}
+
+// MPI_BYTE only supports bitwise operations
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(byte,     unsigned char,      false)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(short,    short,              true)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(int,      int,                true)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(uint,     unsigned int,       true)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(long,     long,               true)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(ulong,    unsigned long,      true)
+DART_LOCAL_ATOMICS_DEFINE_INTEGRAL(longlong, long long,          true)
+DART_LOCAL_ATOMICS_DEFINE_FLOATING(float,    float,              uint32_t)
+DART_LOCAL_ATOMICS_DEFINE_FLOATING(double,   double,             uint64_t)
+
+typedef bool (*fetch_and_op_fn)(
+  void *, const void *, void *, dart_operation_t);
+
+static fetch_and_op_fn
+fetch_and_op_impl(dart_datatype_t dtype)
+{
+  switch (dtype) {
+    case DART_TYPE_BYTE:     return &fetch_and_op_byte;
+    case DART_TYPE_SHORT:    return &fetch_and_op_short;
+    case DART_TYPE_INT:      return &fetch_and_op_int;
+    case DART_TYPE_UINT:     return &fetch_and_op_uint;
+    case DART_TYPE_LONG:     return &fetch_and_op_long;
+    case DART_TYPE_ULONG:    return &fetch_and_op_ulong;
+    case DART_TYPE_LONGLONG: return &fetch_and_op_longlong;
+    case DART_TYPE_FLOAT:    return &fetch_and_op_float;
+    case DART_TYPE_DOUBLE:   return &fetch_and_op_double;
+    default:                 return NULL;
+  }
+}
+
+bool
+dart__mpi__local_fetch_and_op(
+  void             * addr,
+  const void       * value,
+  void             * result,
+  dart_datatype_t    dtype,
+  dart_operation_t   op)
+{
+  fetch_and_op_fn impl = fetch_and_op_impl(dtype);
+  return (impl != NULL && impl(addr, value, result, op));
+}
+
+bool
+dart__mpi__local_accumulate(
+  void             * addr,
+  const void       * values,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op)
+{
+  fetch_and_op_fn impl = fetch_and_op_impl(dtype);
+  if (impl == NULL) {
+    return false;
+  }
+  size_t       type_size = dart__mpi__datatype_sizeof(dtype);
+  char       * dst       = (char *)addr;
+  const char * src       = (const char *)values;
+  for (size_t i = 0; i < nelem; ++i) {
+    // validity only depends on the type and operation
+    if (!impl(dst, src, NULL, op)) {
+      return false;
+    }
+    dst += type_size;
+    src += type_size;
+  }
+  return true;
+}
+
+bool
+dart__mpi__local_compare_and_swap(
+  void             * addr,
+  const void       * value,
+  const void       * compare,
+  void             * result,
+  dart_datatype_t    dtype)
+{
+  switch (dtype) {
+    case DART_TYPE_BYTE:
+      return compare_and_swap_byte(addr, value, compare, result);
+    case DART_TYPE_SHORT:
+      return compare_and_swap_short(addr, value, compare, result);
+    case DART_TYPE_INT:
+      return compare_and_swap_int(addr, value, compare, result);
+    case DART_TYPE_UINT:
+      return compare_and_swap_uint(addr, value, compare, result);
+    case DART_TYPE_LONG:
+      return compare_and_swap_long(addr, value, compare, result);
+    case DART_TYPE_ULONG:
+      return compare_and_swap_ulong(addr, value, compare, result);
+    case DART_TYPE_LONGLONG:
+      return compare_and_swap_longlong(addr, value, compare, result);
+    default:
+      return false;
+  }
+}
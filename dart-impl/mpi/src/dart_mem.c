@@ -37,7 +37,8 @@ struct dart_buddy {
 
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
-struct dart_buddy  *  dart_localpool;
+struct dart_slab   *  dart_localpool;
+struct dart_buddy  *  dart_localpool_buddy;
 
 static inline int
 num_level(size_t size)
@@ -119,8 +120,8 @@ _mark_parent(struct dart_buddy * self, int index) {
 size_t
 dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   int size;
-  // honor the alignment
-  s >>= DART_MEM_ALIGN_BITS;
+  // honor the alignment, partial blocks occupy a full block
+  s = (s + DART_MEM_ALIGN_BYTES - 1) >> DART_MEM_ALIGN_BITS;
 	if (s == 0) {
 		size = 1;
 	}
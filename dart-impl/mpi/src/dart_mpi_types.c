@@ -3,7 +3,8 @@
  *
  * Provide functionality for creating derived data types in DART.
  *
- * Currently implemented: strided types based on basic types.
+ * Currently implemented: strided and indexed types based on basic types,
+ * contiguous custom types and user-defined reduction operations.
  */
 
 #include <dash/dart/if/dart_types.h>
@@ -34,6 +35,9 @@ static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
 
 dart_datatype_struct_t __dart_base_types[DART_TYPE_LAST];
 
+/// Attribute key of MPI types that refer to a user-defined operation
+static int dart__mpi__op_keyval = MPI_KEYVAL_INVALID;
+
 static
 MPI_Datatype
 create_max_datatype(MPI_Datatype mpi_type)
@@ -99,6 +103,14 @@ dart__mpi__datatype_init()
   init_basic_datatype(DART_TYPE_FLOAT, MPI_FLOAT);
   init_basic_datatype(DART_TYPE_DOUBLE, MPI_DOUBLE);
 
+  if (MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN,
+                             MPI_TYPE_NULL_DELETE_FN,
+                             &dart__mpi__op_keyval,
+                             NULL) != MPI_SUCCESS) {
+    DART_LOG_ERROR("Failed to create attribute key for DART operations!");
+    return DART_ERR_OTHER;
+  }
+
   return DART_OK;
 }
 
@@ -121,6 +133,9 @@ char* dart__mpi__datatype_name(dart_datatype_t dart_type)
       snprintf(buf, DART_TYPE_NAMELEN, "STRIDED(%zu:%i:%s)",
                 dts->num_elem, dts->strided.stride, base_name);
       free(base_name);
+    } else if (dts->kind == DART_KIND_BASIC){
+      buf = malloc(DART_TYPE_NAMELEN);
+      snprintf(buf, DART_TYPE_NAMELEN, "CUSTOM(%zu)", dts->basic.size);
     } else {
       DART_LOG_ERROR("INVALID data type detected!");
     }
@@ -164,6 +179,10 @@ dart_type_create_strided(
   new_struct->kind             = DART_KIND_STRIDED;
   new_struct->num_elem         = blocklen;
   new_struct->strided.stride   = stride;
+  new_struct->strided.cache          = NULL;
+  new_struct->strided.cache_size     = 0;
+  new_struct->strided.cache_capacity = 0;
+  dart__base__mutex_init(&new_struct->strided.cache_mutex);
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -174,26 +193,65 @@ dart_type_create_strided(
 
 
 MPI_Datatype
-dart__mpi__create_strided_mpi(
+dart__mpi__strided_mpi_type(
   dart_datatype_t dart_type,
   size_t          num_blocks)
 {
-  MPI_Datatype new_mpi_dtype;
   dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
-  MPI_Type_vector(
-    num_blocks,             // the number of blocks
-    dts->num_elem,          // the number of elements per block
-    dts->strided.stride,    // the number of elements between start of each block
-    dart__mpi__datatype_struct(dts->base_type)->basic.mpi_type,
-    &new_mpi_dtype);
-  MPI_Type_commit(&new_mpi_dtype);
-  return new_mpi_dtype;
-}
+  MPI_Datatype mpi_type = MPI_DATATYPE_NULL;
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
-{
-  MPI_Type_free(mpi_type);
+  dart__base__mutex_lock(&dts->strided.cache_mutex);
+  for (int i = 0; i < dts->strided.cache_size; ++i) {
+    if (dts->strided.cache[i].num_blocks == num_blocks) {
+      mpi_type = dts->strided.cache[i].mpi_type;
+      break;
+    }
+  }
+  if (mpi_type == MPI_DATATYPE_NULL) {
+    int ret = MPI_Type_vector(
+      num_blocks,             // the number of blocks
+      dts->num_elem,          // the number of elements per block
+      dts->strided.stride,    // the number of elements between start of each block
+      dart__mpi__datatype_struct(dts->base_type)->basic.mpi_type,
+      &mpi_type);
+    if (ret != MPI_SUCCESS) {
+      DART_LOG_ERROR("Failed to create MPI type of %zu blocks of strided "
+                     "type %p", num_blocks, dts);
+      dart__base__mutex_unlock(&dts->strided.cache_mutex);
+      return MPI_DATATYPE_NULL;
+    }
+    ret = MPI_Type_commit(&mpi_type);
+    if (ret != MPI_SUCCESS) {
+      DART_LOG_ERROR("Failed to commit MPI type of %zu blocks of strided "
+                     "type %p", num_blocks, dts);
+      MPI_Type_free(&mpi_type);
+      dart__base__mutex_unlock(&dts->strided.cache_mutex);
+      return MPI_DATATYPE_NULL;
+    }
+    DART_LOG_TRACE("Created MPI type of %zu blocks of strided type %p",
+                   num_blocks, dts);
+    if (dts->strided.cache_size == dts->strided.cache_capacity) {
+      int capacity = (dts->strided.cache_capacity > 0)
+                       ? 2 * dts->strided.cache_capacity
+                       : 4;
+      void *cache  = realloc(dts->strided.cache,
+                             capacity * sizeof(*dts->strided.cache));
+      if (cache == NULL) {
+        DART_LOG_ERROR("Failed to grow the MPI type cache of strided "
+                       "type %p", dts);
+        MPI_Type_free(&mpi_type);
+        dart__base__mutex_unlock(&dts->strided.cache_mutex);
+        return MPI_DATATYPE_NULL;
+      }
+      dts->strided.cache          = cache;
+      dts->strided.cache_capacity = capacity;
+    }
+    dts->strided.cache[dts->strided.cache_size].num_blocks = num_blocks;
+    dts->strided.cache[dts->strided.cache_size].mpi_type   = mpi_type;
+    dts->strided.cache_size++;
+  }
+  dart__base__mutex_unlock(&dts->strided.cache_mutex);
+  return mpi_type;
 }
 
 dart_ret_t
@@ -274,6 +332,49 @@ dart_type_create_indexed(
   return DART_OK;
 }
 
+dart_ret_t
+dart_type_create_custom(
+  size_t            num_bytes,
+  dart_datatype_t * newtype)
+{
+  if (newtype == NULL) {
+    DART_LOG_ERROR("newtype pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *newtype = DART_TYPE_UNDEFINED;
+
+  if (num_bytes == 0 || num_bytes > INT_MAX) {
+    DART_LOG_ERROR("dart_type_create_custom: invalid size %zu", num_bytes);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype new_mpi_dtype;
+  if (MPI_Type_contiguous(num_bytes, MPI_BYTE, &new_mpi_dtype)
+        != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_type_create_custom: MPI_Type_contiguous failed");
+    return DART_ERR_OTHER;
+  }
+  MPI_Type_commit(&new_mpi_dtype);
+
+  // custom types are handled like basic types in all operations
+  dart_datatype_struct_t *new_struct;
+  new_struct = malloc(sizeof(struct dart_datatype_struct));
+  new_struct->base_type      = (dart_datatype_t)new_struct;
+  new_struct->kind           = DART_KIND_BASIC;
+  new_struct->num_elem       = 1;
+  new_struct->basic.size     = num_bytes;
+  new_struct->basic.mpi_type = new_mpi_dtype;
+  new_struct->basic.max_type = create_max_datatype(new_mpi_dtype);
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new custom data type %p (mpi_type %p) of %zu bytes",
+                 new_struct, new_mpi_dtype, num_bytes);
+
+  return DART_OK;
+}
+
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type_ptr)
 {
@@ -283,11 +384,26 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
 
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(*dart_type_ptr);
 
-  if (dart_type->kind == DART_KIND_BASIC) {
+  if (*dart_type_ptr < DART_TYPE_LAST) {
     DART_LOG_ERROR("dart_type_destroy: Cannot destroy basic type!");
     return DART_ERR_INVAL;
   }
 
+  if (dart_type->kind == DART_KIND_BASIC) {
+    // custom contiguous type
+    MPI_Type_free(&dart_type->basic.max_type);
+    MPI_Type_free(&dart_type->basic.mpi_type);
+  }
+
+  if (dart_type->kind == DART_KIND_STRIDED) {
+    for (int i = 0; i < dart_type->strided.cache_size; ++i) {
+      MPI_Type_free(&dart_type->strided.cache[i].mpi_type);
+    }
+    free(dart_type->strided.cache);
+    dart_type->strided.cache = NULL;
+    dart__base__mutex_destroy(&dart_type->strided.cache_mutex);
+  }
+
   if (dart_type->kind == DART_KIND_INDEXED) {
     free(dart_type->indexed.blocklens);
     dart_type->indexed.blocklens = NULL;
@@ -302,6 +418,98 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
   return DART_OK;
 }
 
+/**
+ * Invokes the user-defined operator of the operation that is attached as
+ * attribute to the MPI type of the operands.
+ */
+static void
+dart__mpi__op_apply(
+  void         * invec,
+  void         * inoutvec,
+  int          * len,
+  MPI_Datatype * mpi_type)
+{
+  dart_operation_struct_t *dart_op;
+  int flag = 0;
+  MPI_Type_get_attr(*mpi_type, dart__mpi__op_keyval, &dart_op, &flag);
+  if (dart__unlikely(!flag)) {
+    DART_LOG_ERROR("dart__mpi__op_apply: operation not found in MPI type!");
+    dart_abort(-1);
+  }
+  dart_op->op(invec, inoutvec, *len, dart_op->userdata);
+}
+
+dart_ret_t
+dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op)
+{
+  if (new_op == NULL) {
+    DART_LOG_ERROR("new_op pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *new_op = DART_OP_UNDEFINED;
+
+  if (op == NULL) {
+    DART_LOG_ERROR("dart_op_create: operator may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_operation_struct_t *new_struct;
+  new_struct = malloc(sizeof(struct dart_operation_struct));
+  new_struct->dtype    = dtype;
+  new_struct->op       = op;
+  new_struct->userdata = userdata;
+
+  // The MPI operator only receives the MPI type of the operands, the DART
+  // operation is attached to a duplicate of the type:
+  if (MPI_Type_dup(dart__mpi__datatype_struct(dtype)->basic.mpi_type,
+                   &new_struct->mpi_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_op_create: MPI_Type_dup failed");
+    free(new_struct);
+    return DART_ERR_OTHER;
+  }
+  MPI_Type_set_attr(new_struct->mpi_type, dart__mpi__op_keyval, new_struct);
+
+  if (MPI_Op_create(&dart__mpi__op_apply, commute, &new_struct->mpi_op)
+        != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_op_create: MPI_Op_create failed");
+    MPI_Type_free(&new_struct->mpi_type);
+    free(new_struct);
+    return DART_ERR_OTHER;
+  }
+
+  *new_op = (dart_operation_t)new_struct;
+
+  DART_LOG_TRACE("Created new operation %p on data type %p",
+                 new_struct, (void*)dtype);
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart_op_destroy(dart_operation_t *op_ptr)
+{
+  if (op_ptr == NULL || dart__mpi__op_isbasic(*op_ptr)) {
+    DART_LOG_ERROR("dart_op_destroy: Cannot destroy predefined operation!");
+    return DART_ERR_INVAL;
+  }
+
+  dart_operation_struct_t *dart_op = (dart_operation_struct_t *)*op_ptr;
+  MPI_Op_free(&dart_op->mpi_op);
+  MPI_Type_free(&dart_op->mpi_type);
+  free(dart_op);
+  *op_ptr = DART_OP_UNDEFINED;
+
+  return DART_OK;
+}
+
 static void destroy_basic_type(dart_datatype_t dart_type_id)
 {
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(dart_type_id);
@@ -322,5 +530,7 @@ dart__mpi__datatype_fini()
   destroy_basic_type(DART_TYPE_FLOAT);
   destroy_basic_type(DART_TYPE_DOUBLE);
 
+  MPI_Type_free_keyval(&dart__mpi__op_keyval);
+
   return DART_OK;
 }
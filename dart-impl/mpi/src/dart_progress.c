@@ -0,0 +1,136 @@
+/**
+ * \file dart_progress.c
+ *
+ * Progress thread polling MPI while the application computes.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_config.h>
+
+#include <dash/dart/mpi/dart_progress.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/atomic.h>
+
+#include <mpi.h>
+
+#ifdef DART_HAVE_PTHREADS
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/// communicator only used for polling, never carries messages
+static MPI_Comm  progress_comm    = MPI_COMM_NULL;
+static pthread_t progress_thread;
+static int32_t   progress_running = 0;
+static int32_t   progress_stop    = 0;
+
+/**
+ * Pins the calling thread to \c cpu or the last CPU available to the
+ * process if \c cpu is negative.
+ */
+static void pin_thread(int cpu)
+{
+  cpu_set_t cpuset;
+  if (cpu < 0) {
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) != 0) {
+      DART_LOG_WARN("dart_progress: failed to query CPU affinity");
+      return;
+    }
+    for (int i = CPU_SETSIZE - 1; i >= 0; --i) {
+      if (CPU_ISSET(i, &cpuset)) {
+        cpu = i;
+        break;
+      }
+    }
+  }
+  CPU_ZERO(&cpuset);
+  CPU_SET(cpu, &cpuset);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                             &cpuset) != 0) {
+    DART_LOG_WARN("dart_progress: failed to pin progress thread to CPU %d",
+                  cpu);
+    return;
+  }
+  DART_LOG_DEBUG("dart_progress: progress thread pinned to CPU %d", cpu);
+}
+
+static void * progress_loop(void *arg)
+{
+  const dart_config_t *config = (const dart_config_t *)arg;
+  pin_thread(config->progress_cpu);
+
+  struct timespec interval;
+  interval.tv_sec  = config->progress_interval / 1000000;
+  interval.tv_nsec = (config->progress_interval % 1000000) * 1000;
+
+  while (!DART_FETCH32(&progress_stop)) {
+    // polling drives the progress engine of MPI, advancing all
+    // outstanding requests and RMA operations of the process
+    int flag;
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, progress_comm, &flag,
+               MPI_STATUS_IGNORE);
+    if (config->progress_interval > 0) {
+      nanosleep(&interval, NULL);
+    }
+  }
+  return NULL;
+}
+#endif // DART_HAVE_PTHREADS
+
+dart_ret_t dart__mpi__progress_init()
+{
+  dart_config_t *config;
+  dart_config(&config);
+  if (!config->progress_thread) {
+    return DART_OK;
+  }
+
+#ifdef DART_HAVE_PTHREADS
+  int thread_level;
+  MPI_Query_thread(&thread_level);
+  if (thread_level != MPI_THREAD_MULTIPLE) {
+    DART_LOG_WARN("dart_progress: progress thread requires "
+                  "MPI_THREAD_MULTIPLE, use dart_init_thread");
+    return DART_OK;
+  }
+
+  if (MPI_Comm_dup(DART_COMM_WORLD, &progress_comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_progress: MPI_Comm_dup failed");
+    return DART_ERR_OTHER;
+  }
+  progress_stop = 0;
+  if (pthread_create(&progress_thread, NULL, &progress_loop, config) != 0) {
+    DART_LOG_ERROR("dart_progress: failed to create progress thread");
+    MPI_Comm_free(&progress_comm);
+    return DART_ERR_OTHER;
+  }
+  progress_running = 1;
+  DART_LOG_DEBUG("dart_progress: progress thread started, interval %d us",
+                 config->progress_interval);
+#else
+  DART_LOG_WARN("dart_progress: progress thread requires DART to be built "
+                "with thread support");
+#endif // DART_HAVE_PTHREADS
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__progress_fini()
+{
+#ifdef DART_HAVE_PTHREADS
+  if (!progress_running) {
+    return DART_OK;
+  }
+  DART_FETCH_AND_INC32(&progress_stop);
+  pthread_join(progress_thread, NULL);
+  progress_running = 0;
+  MPI_Comm_free(&progress_comm);
+  DART_LOG_DEBUG("dart_progress: progress thread stopped");
+#endif // DART_HAVE_PTHREADS
+  return DART_OK;
+}
@@ -1,5 +1,6 @@
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <inttypes.h>
 
 #include <dash/dart/base/logging.h>
@@ -10,69 +11,83 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
+  dart_segment_elem_t *next;
   dart_segment_info_t  data;
 };
 
+static inline dart_segment_elem_t * segment_elem(dart_segment_info_t *seginfo)
+{
+  return (dart_segment_elem_t *)
+           ((char *)seginfo - offsetof(dart_segment_elem_t, data));
+}
 
-static inline int hash_segid(dart_segid_t segid)
+/**
+ * Returns the table slot of the segment ID, grows the table if necessary.
+ */
+static dart_segment_info_t ** segment_slot(
+    dart_segmentdata_t *segdata,
+    dart_segid_t        segid)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  dart_segment_info_t ***table;
+  int                  *capacity;
+  int                   idx;
+  if (segid >= 0) {
+    table    = &segdata->mem_segments;
+    capacity = &segdata->mem_capacity;
+    idx      = segid;
+  } else {
+    table    = &segdata->reg_segments;
+    capacity = &segdata->reg_capacity;
+    idx      = -segid;
+  }
+  if (idx >= *capacity) {
+    int new_capacity = (*capacity > 0) ? *capacity : DART_SEGMENT_TABLE_SIZE;
+    while (new_capacity <= idx) {
+      new_capacity *= 2;
+    }
+    dart_segment_info_t **new_table = realloc(
+                          *table, new_capacity * sizeof(dart_segment_info_t*));
+    DART_ASSERT(new_table != NULL);
+    memset(new_table + *capacity, 0,
+           (new_capacity - *capacity) * sizeof(dart_segment_info_t*));
+    *table    = new_table;
+    *capacity = new_capacity;
+  }
+  return &(*table)[idx];
 }
 
 static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
 {
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
+  elem->next = NULL;
+  *segment_slot(segdata, elem->data.segid) = &elem->data;
 }
 
 static dart_segment_info_t * get_segment(
     dart_segmentdata_t *segdata,
     dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
+  dart_segment_info_t *seginfo = dart_segment_get_info(segdata, segid);
 
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
-  }
-
-  if (elem == NULL) {
+  if (seginfo == NULL) {
     DART_LOG_ERROR("dart_segment__get_segment : "
                    "Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
-    return NULL;
   }
 
-  return &(elem->data);
-}
-
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid)
-{
-  return get_segment(segdata, segid);
+  return seginfo;
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->mem_segments = NULL;
+  segdata->reg_segments = NULL;
+  segdata->mem_capacity = 0;
+  segdata->reg_capacity = 0;
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
@@ -95,11 +110,11 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem = calloc(1, sizeof(dart_segment_elem_t));
     elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
@@ -114,7 +129,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -131,7 +146,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -141,6 +156,9 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
 
   register_segment(segdata, elem);
 
+  // segments are served from the team heap explicitly
+  elem->data.is_pooled = false;
+
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
   return &(elem->data);
@@ -297,50 +315,34 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  dart_segment_info_t *seginfo = dart_segment_get_info(segdata, segid);
+  if (seginfo == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
-
-  // element not found
-  return DART_ERR_INVAL;
+  *segment_slot(segdata, segid) = NULL;
+
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  dart_segment_elem_t *elem = segment_elem(seginfo);
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0){
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     // segment info should have been cleared in dart_segment_fini
@@ -351,8 +353,20 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
   }
 }
 
+static void clear_segdata_table(
+  dart_segment_info_t ** table,
+  int                    capacity)
+{
+  for (int i = 0; i < capacity; i++) {
+    if (table[i] != NULL) {
+      clear_segdata_list(segment_elem(table[i]));
+    }
+  }
+  free(table);
+}
+
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
@@ -365,11 +379,15 @@ dart_ret_t dart_segment_fini(
     free_segment_info(seg);
   }
 
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
-  }
+  // clear the remaining segments
+  clear_segdata_table(segdata->mem_segments, segdata->mem_capacity);
+  segdata->mem_segments = NULL;
+  segdata->mem_capacity = 0;
+
+  clear_segdata_table(segdata->reg_segments, segdata->reg_capacity);
+  segdata->reg_segments = NULL;
+  segdata->reg_capacity = 0;
+
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
@@ -0,0 +1,842 @@
+/**
+ * \file dart_slab.c
+ *
+ * Size-class allocator managing offsets in externally allocated memory
+ * regions.
+ *
+ * Every region is divided into pages. Contiguous runs of pages (spans)
+ * are either free, serve a single large allocation or form a slab of
+ * equally sized blocks of one size class. A page map per region resolves
+ * offsets to their span. For free and large spans, only the entries of
+ * the first and last page are maintained, which suffices to coalesce
+ * neighboring free spans. For slabs, all entries are maintained so that
+ * blocks can be resolved on free.
+ */
+
+#include <dash/dart/mpi/dart_slab.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define DART_SLAB_PAGE_BITS    12
+#define DART_SLAB_PAGE_SIZE    (((size_t)1) << DART_SLAB_PAGE_BITS)
+#define DART_SLAB_ALIGN_BITS   3
+#define DART_SLAB_MAX_REGIONS  64
+/** Size classes up to 64 bytes in 8 byte steps, then 4 per power of 2 */
+#define DART_SLAB_NUM_CLASSES  44
+/** Minimum number of blocks in a slab */
+#define DART_SLAB_MIN_BLOCKS   8
+/** Maximum number of blocks per size class in a thread cache */
+#define DART_SLAB_CACHE_SIZE   32
+/** Maximum number of bytes per size class in a thread cache */
+#define DART_SLAB_CACHE_BYTES  (64 * 1024)
+/** Number of span descriptors allocated at once */
+#define DART_SLAB_SPAN_CHUNK   64
+
+#ifdef DART_ENABLE_THREADSUPPORT
+#define DART_SLAB_THREAD_LOCAL __thread
+#else
+#define DART_SLAB_THREAD_LOCAL
+#endif
+
+typedef enum {
+  SPAN_UNUSED = 0,
+  SPAN_FREE,
+  SPAN_LARGE,
+  SPAN_SLAB
+} dart_slab_span_state_t;
+
+typedef struct dart_slab_span dart_slab_span_t;
+
+struct dart_slab_span {
+  /** Offset of the first page */
+  uint64_t           offset;
+  size_t             npages;
+  int                region;
+  int                state;
+  /** Size class of a slab */
+  int                sclass;
+  /** Number of free blocks of a slab */
+  uint32_t           nfree;
+  /** Number of blocks of a slab */
+  uint32_t           capacity;
+  /** Stack of indices of the free blocks of a slab */
+  uint16_t         * free_idx;
+  /** Neighbors in the list of free spans or partial slabs */
+  dart_slab_span_t * prev;
+  dart_slab_span_t * next;
+};
+
+typedef struct {
+  uint64_t           offset;
+  size_t             npages;
+  dart_slab_span_t ** pagemap;
+} dart_slab_region_t;
+
+typedef struct dart_slab_span_chunk {
+  struct dart_slab_span_chunk * next;
+  dart_slab_span_t              spans[DART_SLAB_SPAN_CHUNK];
+} dart_slab_span_chunk_t;
+
+struct dart_slab {
+  dart_mutex_t             mutex;
+  bool                     thread_cache;
+  int                      nregions;
+  dart_slab_region_t       regions[DART_SLAB_MAX_REGIONS];
+  /** Free spans, unordered */
+  dart_slab_span_t       * free_spans;
+  /** Slabs with free blocks per size class */
+  dart_slab_span_t       * partial[DART_SLAB_NUM_CLASSES];
+  /** Unused span descriptors */
+  dart_slab_span_t       * spare_spans;
+  dart_slab_span_chunk_t * span_chunks;
+  uint32_t                 class_size[DART_SLAB_NUM_CLASSES];
+  uint32_t                 class_pages[DART_SLAB_NUM_CLASSES];
+  /** Number of blocks per size class a thread cache holds at most */
+  uint32_t                 class_cache[DART_SLAB_NUM_CLASSES];
+  uint8_t                  class_lookup[
+                             (DART_SLAB_MAX_SMALL >> DART_SLAB_ALIGN_BITS)
+                             + 1];
+};
+
+typedef struct dart_slab_cache dart_slab_cache_t;
+
+/**
+ * Blocks cached by a single thread. The owning thread and threads
+ * reclaiming cached blocks access the blocks under \c mutex. The
+ * allocator is only changed while also holding
+ * \c dart_slab_caches_mutex.
+ */
+struct dart_slab_cache {
+  dart_mutex_t        mutex;
+  /** Allocator the blocks belong to, \c NULL if unassigned */
+  struct dart_slab  * pool;
+  /** Neighbors in the list of caches of all threads */
+  dart_slab_cache_t * prev;
+  dart_slab_cache_t * next;
+  uint32_t            count[DART_SLAB_NUM_CLASSES];
+  uint64_t            blocks[DART_SLAB_NUM_CLASSES][DART_SLAB_CACHE_SIZE];
+};
+
+static DART_SLAB_THREAD_LOCAL dart_slab_cache_t * dart_slab_tcache = NULL;
+
+/** Caches of all threads, protected by \c dart_slab_caches_mutex */
+static dart_slab_cache_t * dart_slab_caches = NULL;
+static dart_mutex_t        dart_slab_caches_mutex = DART_MUTEX_INITIALIZER;
+
+#ifdef DART_HAVE_PTHREADS
+/** Key used to return the cached blocks of exiting threads */
+static pthread_key_t  dart_slab_cache_key;
+static pthread_once_t dart_slab_cache_key_once = PTHREAD_ONCE_INIT;
+static bool           dart_slab_cache_key_valid = false;
+#endif
+
+static void
+init_size_classes(struct dart_slab * self)
+{
+  int c = 0;
+  for (uint32_t size = 8; size <= 64; size += 8) {
+    self->class_size[c++] = size;
+  }
+  for (uint32_t pow = 64; pow < DART_SLAB_MAX_SMALL; pow *= 2) {
+    for (uint32_t step = 1; step <= 4; ++step) {
+      self->class_size[c++] = pow + step * (pow / 4);
+    }
+  }
+  DART_ASSERT(c == DART_SLAB_NUM_CLASSES);
+
+  int sclass = 0;
+  for (size_t i = 0; i <= (DART_SLAB_MAX_SMALL >> DART_SLAB_ALIGN_BITS);
+       ++i) {
+    size_t size = i << DART_SLAB_ALIGN_BITS;
+    while (self->class_size[sclass] < size) {
+      ++sclass;
+    }
+    self->class_lookup[i] = (uint8_t)sclass;
+  }
+
+  for (c = 0; c < DART_SLAB_NUM_CLASSES; ++c) {
+    size_t bytes = (size_t)self->class_size[c] * DART_SLAB_MIN_BLOCKS;
+    self->class_pages[c] = (uint32_t)
+      ((bytes + DART_SLAB_PAGE_SIZE - 1) >> DART_SLAB_PAGE_BITS);
+    uint32_t ncache = DART_SLAB_CACHE_BYTES / self->class_size[c];
+    self->class_cache[c] = (ncache < 2) ? 2 :
+                           (ncache > DART_SLAB_CACHE_SIZE)
+                             ? DART_SLAB_CACHE_SIZE : ncache;
+  }
+}
+
+static inline int
+size_class(const struct dart_slab * self, size_t size)
+{
+  return self->class_lookup[
+           (size + (1 << DART_SLAB_ALIGN_BITS) - 1) >> DART_SLAB_ALIGN_BITS];
+}
+
+static dart_slab_span_t *
+span_new(struct dart_slab * self)
+{
+  if (self->spare_spans == NULL) {
+    dart_slab_span_chunk_t * chunk = calloc(1, sizeof(*chunk));
+    if (chunk == NULL) {
+      return NULL;
+    }
+    chunk->next       = self->span_chunks;
+    self->span_chunks = chunk;
+    for (int i = 0; i < DART_SLAB_SPAN_CHUNK; ++i) {
+      chunk->spans[i].next = self->spare_spans;
+      self->spare_spans    = &chunk->spans[i];
+    }
+  }
+  dart_slab_span_t * span = self->spare_spans;
+  self->spare_spans = span->next;
+  memset(span, 0, sizeof(*span));
+  return span;
+}
+
+/**
+ * Span descriptors are never returned to the system while the allocator
+ * exists, so stale page map entries always refer to a valid descriptor.
+ */
+static void
+span_release(struct dart_slab * self, dart_slab_span_t * span)
+{
+  span->state       = SPAN_UNUSED;
+  span->next        = self->spare_spans;
+  self->spare_spans = span;
+}
+
+static inline void
+list_push(dart_slab_span_t ** head, dart_slab_span_t * span)
+{
+  span->prev = NULL;
+  span->next = *head;
+  if (*head != NULL) {
+    (*head)->prev = span;
+  }
+  *head = span;
+}
+
+static inline void
+list_remove(dart_slab_span_t ** head, dart_slab_span_t * span)
+{
+  if (span->prev != NULL) {
+    span->prev->next = span->next;
+  } else {
+    *head = span->next;
+  }
+  if (span->next != NULL) {
+    span->next->prev = span->prev;
+  }
+  span->prev = NULL;
+  span->next = NULL;
+}
+
+static inline size_t
+span_first_page(const struct dart_slab * self, const dart_slab_span_t * span)
+{
+  return (span->offset - self->regions[span->region].offset)
+           >> DART_SLAB_PAGE_BITS;
+}
+
+static inline void
+span_map_bounds(struct dart_slab * self, dart_slab_span_t * span)
+{
+  dart_slab_span_t ** pagemap = self->regions[span->region].pagemap;
+  size_t first = span_first_page(self, span);
+  pagemap[first]                    = span;
+  pagemap[first + span->npages - 1] = span;
+}
+
+/**
+ * Returns the span containing \c offset or \c NULL. Requires the mutex
+ * of the allocator.
+ */
+static dart_slab_span_t *
+span_lookup(const struct dart_slab * self, uint64_t offset)
+{
+  for (int r = 0; r < self->nregions; ++r) {
+    const dart_slab_region_t * region = &self->regions[r];
+    if (offset >= region->offset &&
+        offset <  region->offset +
+                    (region->npages << DART_SLAB_PAGE_BITS)) {
+      dart_slab_span_t * span = region->pagemap[
+                                  (offset - region->offset)
+                                    >> DART_SLAB_PAGE_BITS];
+      if (span != NULL && span->state != SPAN_UNUSED &&
+          span->region == r && offset >= span->offset &&
+          offset < span->offset + (span->npages << DART_SLAB_PAGE_BITS)) {
+        return span;
+      }
+      return NULL;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Returns the span to the free spans, coalescing it with free neighbors.
+ */
+static void
+span_free(struct dart_slab * self, dart_slab_span_t * span)
+{
+  dart_slab_region_t * region  = &self->regions[span->region];
+  size_t               first   = span_first_page(self, span);
+  span->state = SPAN_FREE;
+
+  if (first > 0) {
+    dart_slab_span_t * prev = region->pagemap[first - 1];
+    if (prev != NULL && prev->state == SPAN_FREE) {
+      list_remove(&self->free_spans, prev);
+      prev->npages += span->npages;
+      span_release(self, span);
+      span  = prev;
+      first = span_first_page(self, span);
+    }
+  }
+  if (first + span->npages < region->npages) {
+    dart_slab_span_t * next = region->pagemap[first + span->npages];
+    if (next != NULL && next->state == SPAN_FREE) {
+      list_remove(&self->free_spans, next);
+      span->npages += next->npages;
+      span_release(self, next);
+    }
+  }
+  span_map_bounds(self, span);
+  list_push(&self->free_spans, span);
+}
+
+/**
+ * Returns the smallest free span of at least \c npages pages, split to
+ * the requested size.
+ */
+static dart_slab_span_t *
+span_alloc(struct dart_slab * self, size_t npages)
+{
+  dart_slab_span_t * best = NULL;
+  for (dart_slab_span_t * span = self->free_spans; span != NULL;
+       span = span->next) {
+    if (span->npages >= npages &&
+        (best == NULL || span->npages < best->npages)) {
+      best = span;
+      if (span->npages == npages) {
+        break;
+      }
+    }
+  }
+  if (best == NULL) {
+    return NULL;
+  }
+  if (best->npages > npages) {
+    dart_slab_span_t * rest = span_new(self);
+    if (rest == NULL) {
+      return NULL;
+    }
+    rest->region = best->region;
+    rest->offset = best->offset + (npages << DART_SLAB_PAGE_BITS);
+    rest->npages = best->npages - npages;
+    rest->state  = SPAN_FREE;
+    span_map_bounds(self, rest);
+    list_push(&self->free_spans, rest);
+    best->npages = npages;
+  }
+  list_remove(&self->free_spans, best);
+  span_map_bounds(self, best);
+  return best;
+}
+
+static void
+slab_release(struct dart_slab * self, dart_slab_span_t * slab)
+{
+  list_remove(&self->partial[slab->sclass], slab);
+  free(slab->free_idx);
+  slab->free_idx = NULL;
+  span_free(self, slab);
+}
+
+/**
+ * Releases slabs without allocated blocks, which are retained to avoid
+ * repeated creation of slabs.
+ */
+static bool
+release_empty_slabs(struct dart_slab * self)
+{
+  bool released = false;
+  for (int c = 0; c < DART_SLAB_NUM_CLASSES; ++c) {
+    dart_slab_span_t * slab = self->partial[c];
+    while (slab != NULL) {
+      dart_slab_span_t * next = slab->next;
+      if (slab->nfree == slab->capacity) {
+        slab_release(self, slab);
+        released = true;
+      }
+      slab = next;
+    }
+  }
+  return released;
+}
+
+static dart_slab_span_t *
+span_alloc_or_reclaim(struct dart_slab * self, size_t npages)
+{
+  dart_slab_span_t * span = span_alloc(self, npages);
+  if (span == NULL && release_empty_slabs(self)) {
+    span = span_alloc(self, npages);
+  }
+  return span;
+}
+
+static dart_slab_span_t *
+slab_new(struct dart_slab * self, int sclass)
+{
+  dart_slab_span_t * slab = span_alloc_or_reclaim(
+                              self, self->class_pages[sclass]);
+  if (slab == NULL) {
+    return NULL;
+  }
+  uint32_t capacity = (uint32_t)((slab->npages << DART_SLAB_PAGE_BITS) /
+                                 self->class_size[sclass]);
+  slab->free_idx = malloc(capacity * sizeof(uint16_t));
+  if (slab->free_idx == NULL) {
+    span_free(self, slab);
+    return NULL;
+  }
+  // lowest offsets are handed out first
+  for (uint32_t i = 0; i < capacity; ++i) {
+    slab->free_idx[i] = (uint16_t)(capacity - 1 - i);
+  }
+  slab->state    = SPAN_SLAB;
+  slab->sclass   = sclass;
+  slab->capacity = capacity;
+  slab->nfree    = capacity;
+  dart_slab_span_t ** pagemap = self->regions[slab->region].pagemap;
+  size_t first = span_first_page(self, slab);
+  for (size_t p = 0; p < slab->npages; ++p) {
+    pagemap[first + p] = slab;
+  }
+  list_push(&self->partial[sclass], slab);
+  return slab;
+}
+
+static uint64_t
+slab_alloc_block(struct dart_slab * self, int sclass)
+{
+  dart_slab_span_t * slab = self->partial[sclass];
+  if (slab == NULL) {
+    slab = slab_new(self, sclass);
+    if (slab == NULL) {
+      return DART_SLAB_ALLOC_FAILED;
+    }
+  }
+  uint16_t idx = slab->free_idx[--slab->nfree];
+  if (slab->nfree == 0) {
+    list_remove(&self->partial[sclass], slab);
+  }
+  return slab->offset + (uint64_t)idx * self->class_size[sclass];
+}
+
+static int
+slab_free_block(
+  struct dart_slab * self,
+  dart_slab_span_t * slab,
+  uint64_t           offset)
+{
+  uint32_t size = self->class_size[slab->sclass];
+  uint64_t rel  = offset - slab->offset;
+  if (rel % size != 0 || rel / size >= slab->capacity ||
+      slab->nfree == slab->capacity) {
+    return -1;
+  }
+  slab->free_idx[slab->nfree++] = (uint16_t)(rel / size);
+  if (slab->nfree == 1) {
+    list_push(&self->partial[slab->sclass], slab);
+  } else if (slab->nfree == slab->capacity &&
+             (slab->prev != NULL || slab->next != NULL)) {
+    // keep the last slab of the class for reuse
+    slab_release(self, slab);
+  }
+  return 0;
+}
+
+/**
+ * Returns the blocks of a size class in the cache exceeding \c keep
+ * blocks to the allocator. Requires the mutexes of the cache and the
+ * allocator.
+ */
+static void
+cache_drain_class(
+  struct dart_slab  * self,
+  dart_slab_cache_t * cache,
+  int                 sclass,
+  uint32_t            keep)
+{
+  while (cache->count[sclass] > keep) {
+    uint64_t           block = cache->blocks[sclass][--cache->count[sclass]];
+    dart_slab_span_t * slab  = span_lookup(self, block);
+    if (slab == NULL || slab->state != SPAN_SLAB ||
+        slab_free_block(self, slab, block) != 0) {
+      DART_LOG_ERROR("dart_slab: invalid cached block %"PRIu64, block);
+    }
+  }
+}
+
+/**
+ * Returns all blocks in the cache to the allocator they belong to and
+ * assigns the cache to \c pool. Requires \c dart_slab_caches_mutex.
+ */
+static void
+cache_assign(dart_slab_cache_t * cache, struct dart_slab * pool)
+{
+  dart__base__mutex_lock(&cache->mutex);
+  struct dart_slab * prev_pool = cache->pool;
+  if (prev_pool != NULL) {
+    dart__base__mutex_lock(&prev_pool->mutex);
+    for (int c = 0; c < DART_SLAB_NUM_CLASSES; ++c) {
+      cache_drain_class(prev_pool, cache, c, 0);
+    }
+    dart__base__mutex_unlock(&prev_pool->mutex);
+  }
+  cache->pool = pool;
+  dart__base__mutex_unlock(&cache->mutex);
+}
+
+#ifdef DART_HAVE_PTHREADS
+/**
+ * Destructor of the cache of an exiting thread.
+ */
+static void
+cache_destroy(void * arg)
+{
+  dart_slab_cache_t * cache = arg;
+  dart__base__mutex_lock(&dart_slab_caches_mutex);
+  cache_assign(cache, NULL);
+  if (cache->prev != NULL) {
+    cache->prev->next = cache->next;
+  } else {
+    dart_slab_caches = cache->next;
+  }
+  if (cache->next != NULL) {
+    cache->next->prev = cache->prev;
+  }
+  dart__base__mutex_unlock(&dart_slab_caches_mutex);
+  dart__base__mutex_destroy(&cache->mutex);
+  free(cache);
+  dart_slab_tcache = NULL;
+}
+
+static void
+cache_key_create(void)
+{
+  if (pthread_key_create(&dart_slab_cache_key, &cache_destroy) == 0) {
+    dart_slab_cache_key_valid = true;
+  } else {
+    DART_LOG_WARN("dart_slab: failed to create thread cache key, blocks "
+                  "cached by exiting threads are only reclaimed on demand");
+  }
+}
+#endif
+
+/**
+ * Returns the locked cache of the calling thread assigned to the
+ * allocator or \c NULL if no cache could be created.
+ */
+static dart_slab_cache_t *
+thread_cache_lock(struct dart_slab * self)
+{
+  dart_slab_cache_t * cache = dart_slab_tcache;
+  if (dart__unlikely(cache == NULL)) {
+    cache = calloc(1, sizeof(dart_slab_cache_t));
+    if (cache == NULL) {
+      return NULL;
+    }
+    dart__base__mutex_init(&cache->mutex);
+#ifdef DART_HAVE_PTHREADS
+    pthread_once(&dart_slab_cache_key_once, &cache_key_create);
+    if (dart_slab_cache_key_valid) {
+      pthread_setspecific(dart_slab_cache_key, cache);
+    }
+#endif
+    dart__base__mutex_lock(&dart_slab_caches_mutex);
+    cache->next = dart_slab_caches;
+    if (dart_slab_caches != NULL) {
+      dart_slab_caches->prev = cache;
+    }
+    dart_slab_caches = cache;
+    dart__base__mutex_unlock(&dart_slab_caches_mutex);
+    dart_slab_tcache = cache;
+  }
+  dart__base__mutex_lock(&cache->mutex);
+  if (dart__unlikely(cache->pool != self)) {
+    dart__base__mutex_unlock(&cache->mutex);
+    dart__base__mutex_lock(&dart_slab_caches_mutex);
+    cache_assign(cache, self);
+    dart__base__mutex_unlock(&dart_slab_caches_mutex);
+    dart__base__mutex_lock(&cache->mutex);
+  }
+  return cache;
+}
+
+/**
+ * Returns the blocks cached by all threads to the allocator.
+ *
+ * \return Whether any block has been returned.
+ */
+static bool
+reclaim_cached_blocks(struct dart_slab * self)
+{
+  bool reclaimed = false;
+  dart__base__mutex_lock(&dart_slab_caches_mutex);
+  for (dart_slab_cache_t * cache = dart_slab_caches; cache != NULL;
+       cache = cache->next) {
+    if (cache->pool != self) {
+      continue;
+    }
+    dart__base__mutex_lock(&cache->mutex);
+    dart__base__mutex_lock(&self->mutex);
+    for (int c = 0; c < DART_SLAB_NUM_CLASSES; ++c) {
+      reclaimed = reclaimed || (cache->count[c] > 0);
+      cache_drain_class(self, cache, c, 0);
+    }
+    dart__base__mutex_unlock(&self->mutex);
+    dart__base__mutex_unlock(&cache->mutex);
+  }
+  dart__base__mutex_unlock(&dart_slab_caches_mutex);
+  return reclaimed;
+}
+
+struct dart_slab *
+dart_slab_new(bool thread_cache)
+{
+  struct dart_slab * self = calloc(1, sizeof(struct dart_slab));
+  if (self == NULL) {
+    return NULL;
+  }
+  self->thread_cache = thread_cache;
+  init_size_classes(self);
+  dart__base__mutex_init(&self->mutex);
+  return self;
+}
+
+dart_ret_t
+dart_slab_add_region(
+  struct dart_slab * self,
+  uint64_t           offset,
+  size_t             size)
+{
+  size_t npages = size >> DART_SLAB_PAGE_BITS;
+  if (npages == 0) {
+    DART_LOG_ERROR("dart_slab_add_region: region of %zu bytes is smaller "
+                   "than a page", size);
+    return DART_ERR_INVAL;
+  }
+  dart__base__mutex_lock(&self->mutex);
+  if (self->nregions == DART_SLAB_MAX_REGIONS) {
+    dart__base__mutex_unlock(&self->mutex);
+    DART_LOG_ERROR("dart_slab_add_region: maximum number of regions (%d) "
+                   "exceeded", DART_SLAB_MAX_REGIONS);
+    return DART_ERR_OTHER;
+  }
+  int                  r      = self->nregions;
+  dart_slab_region_t * region = &self->regions[r];
+  dart_slab_span_t   * span   = span_new(self);
+  region->pagemap = calloc(npages, sizeof(dart_slab_span_t *));
+  if (span == NULL || region->pagemap == NULL) {
+    free(region->pagemap);
+    region->pagemap = NULL;
+    dart__base__mutex_unlock(&self->mutex);
+    return DART_ERR_OTHER;
+  }
+  region->offset = offset;
+  region->npages = npages;
+  span->region   = r;
+  span->offset   = offset;
+  span->npages   = npages;
+  span->state    = SPAN_FREE;
+  self->nregions = r + 1;
+  span_map_bounds(self, span);
+  list_push(&self->free_spans, span);
+  dart__base__mutex_unlock(&self->mutex);
+  DART_LOG_DEBUG("dart_slab_add_region: offset:%"PRIu64" pages:%zu",
+                 offset, npages);
+  return DART_OK;
+}
+
+void
+dart_slab_delete(struct dart_slab * self)
+{
+  // cached blocks are discarded, the caches are reused by their threads
+  dart__base__mutex_lock(&dart_slab_caches_mutex);
+  for (dart_slab_cache_t * cache = dart_slab_caches; cache != NULL;
+       cache = cache->next) {
+    if (cache->pool == self) {
+      dart__base__mutex_lock(&cache->mutex);
+      memset(cache->count, 0, sizeof(cache->count));
+      cache->pool = NULL;
+      dart__base__mutex_unlock(&cache->mutex);
+    }
+  }
+  dart__base__mutex_unlock(&dart_slab_caches_mutex);
+  for (int c = 0; c < DART_SLAB_NUM_CLASSES; ++c) {
+    for (dart_slab_span_t * slab = self->partial[c]; slab != NULL;
+         slab = slab->next) {
+      free(slab->free_idx);
+    }
+  }
+  // full slabs are only referenced from the page maps
+  for (int r = 0; r < self->nregions; ++r) {
+    dart_slab_region_t * region = &self->regions[r];
+    for (size_t p = 0; p < region->npages; ++p) {
+      dart_slab_span_t * span = region->pagemap[p];
+      if (span != NULL && span->state == SPAN_SLAB && span->nfree == 0 &&
+          span_first_page(self, span) == p) {
+        free(span->free_idx);
+      }
+    }
+    free(region->pagemap);
+  }
+  while (self->span_chunks != NULL) {
+    dart_slab_span_chunk_t * next = self->span_chunks->next;
+    free(self->span_chunks);
+    self->span_chunks = next;
+  }
+  dart__base__mutex_destroy(&self->mutex);
+  free(self);
+}
+
+static uint64_t
+slab_alloc(struct dart_slab * self, size_t size)
+{
+  uint64_t offset;
+  if (size > DART_SLAB_MAX_SMALL) {
+    size_t npages = (size + DART_SLAB_PAGE_SIZE - 1) >> DART_SLAB_PAGE_BITS;
+    dart__base__mutex_lock(&self->mutex);
+    dart_slab_span_t * span = span_alloc_or_reclaim(self, npages);
+    if (span != NULL) {
+      span->state = SPAN_LARGE;
+    }
+    dart__base__mutex_unlock(&self->mutex);
+    return (span != NULL) ? span->offset : DART_SLAB_ALLOC_FAILED;
+  }
+
+  int sclass = size_class(self, size);
+  if (!self->thread_cache) {
+    dart__base__mutex_lock(&self->mutex);
+    offset = slab_alloc_block(self, sclass);
+    dart__base__mutex_unlock(&self->mutex);
+    return offset;
+  }
+
+  dart_slab_cache_t * cache = thread_cache_lock(self);
+  if (cache == NULL) {
+    dart__base__mutex_lock(&self->mutex);
+    offset = slab_alloc_block(self, sclass);
+    dart__base__mutex_unlock(&self->mutex);
+    return offset;
+  }
+  if (cache->count[sclass] > 0) {
+    offset = cache->blocks[sclass][--cache->count[sclass]];
+    dart__base__mutex_unlock(&cache->mutex);
+    return offset;
+  }
+  // refill half of the cache, without creating slabs for the cache only
+  dart__base__mutex_lock(&self->mutex);
+  offset = slab_alloc_block(self, sclass);
+  if (offset != DART_SLAB_ALLOC_FAILED) {
+    while (cache->count[sclass] < self->class_cache[sclass] / 2 &&
+           self->partial[sclass] != NULL) {
+      uint64_t block = slab_alloc_block(self, sclass);
+      if (block == DART_SLAB_ALLOC_FAILED) {
+        break;
+      }
+      cache->blocks[sclass][cache->count[sclass]++] = block;
+    }
+  }
+  dart__base__mutex_unlock(&self->mutex);
+  dart__base__mutex_unlock(&cache->mutex);
+  return offset;
+}
+
+uint64_t
+dart_slab_alloc(struct dart_slab * self, size_t size)
+{
+  if (size == 0) {
+    size = 1;
+  }
+  uint64_t offset = slab_alloc(self, size);
+  // free blocks may be held in the caches of other or exited threads
+  if (offset == DART_SLAB_ALLOC_FAILED && self->thread_cache &&
+      reclaim_cached_blocks(self)) {
+    offset = slab_alloc(self, size);
+  }
+  return offset;
+}
+
+/**
+ * Adds a block of a slab to the cache. Requires the mutexes of the cache
+ * and the allocator.
+ */
+static int
+cache_free_block(
+  struct dart_slab  * self,
+  dart_slab_cache_t * cache,
+  dart_slab_span_t  * slab,
+  uint64_t            offset)
+{
+  int sclass = slab->sclass;
+  // reject offsets inside blocks and blocks already in the cache of
+  // this thread, as slab_free_block does
+  uint32_t size = self->class_size[sclass];
+  uint64_t rel  = offset - slab->offset;
+  if (rel % size != 0 || rel / size >= slab->capacity) {
+    return -1;
+  }
+  for (uint32_t i = 0; i < cache->count[sclass]; ++i) {
+    if (cache->blocks[sclass][i] == offset) {
+      return -1;
+    }
+  }
+  if (cache->count[sclass] == self->class_cache[sclass]) {
+    // return half of the cache
+    cache_drain_class(self, cache, sclass, self->class_cache[sclass] / 2);
+  }
+  cache->blocks[sclass][cache->count[sclass]++] = offset;
+  return 0;
+}
+
+int
+dart_slab_free(struct dart_slab * self, uint64_t offset)
+{
+  int ret = 0;
+  dart_slab_cache_t * cache = NULL;
+  if (self->thread_cache) {
+    cache = thread_cache_lock(self);
+  }
+  // spans are split and coalesced by other threads, the span is looked
+  // up under the mutex of the allocator
+  dart__base__mutex_lock(&self->mutex);
+  dart_slab_span_t * span = span_lookup(self, offset);
+  if (span == NULL) {
+    ret = -1;
+  } else if (span->state == SPAN_SLAB && cache != NULL) {
+    ret = cache_free_block(self, cache, span, offset);
+  } else if (span->state == SPAN_SLAB) {
+    ret = slab_free_block(self, span, offset);
+  } else if (span->state == SPAN_LARGE && span->offset == offset) {
+    span_free(self, span);
+  } else {
+    ret = -1;
+  }
+  dart__base__mutex_unlock(&self->mutex);
+  if (cache != NULL) {
+    dart__base__mutex_unlock(&cache->mutex);
+  }
+  if (ret != 0) {
+    DART_LOG_ERROR("dart_slab_free: invalid offset %"PRIu64, offset);
+  }
+  return ret;
+}
@@ -23,12 +23,73 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <malloc.h>
+#include <string.h>
+#include <stdbool.h>
 
 
+/**
+ * The lock is a cohort lock: units on the same node first acquire a
+ * node-local ticket lock in shared memory, the holder of the node-local
+ * lock then acquires the global MCS queue lock on behalf of the node.
+ * On release, the global lock is passed to the next unit on the node if
+ * there are local waiters, so the global lock only migrates between nodes
+ * after at most DART_LOCK_MAX_LOCAL_PASSES local hand-overs.
+ *
+ * In shared mode, the first reader on a node registers the node at the
+ * global reader counter, a writer holding the global lock waits until the
+ * counter drops to zero after announcing itself in the global writer flag.
+ * The flag only keeps further nodes from registering, readers on a node
+ * that is already registered do not check it.
+ */
+
+/**
+ * Maximum number of consecutive hand-overs of the global lock between
+ * units on the same node.
+ */
+#define DART_LOCK_MAX_LOCAL_PASSES 64
+
+#define DART_LOCK_ATOMIC_ORDER     __ATOMIC_SEQ_CST
+
+/** Mode the lock is held in by this unit. */
+enum {
+  DART_LOCK_NOT_ACQUIRED = 0,
+  DART_LOCK_EXCLUSIVE,
+  DART_LOCK_SHARED
+};
+
+/** Fields of the global lock state stored at team-unit 0. */
+enum {
+  DART_LOCK_GLOBAL_TAIL = 0,
+  DART_LOCK_GLOBAL_WRITER,
+  DART_LOCK_GLOBAL_READERS,
+  DART_LOCK_GLOBAL_NUM_FIELDS
+};
+
+/**
+ * Lock state shared by the units of a node.
+ */
+struct dart_lock_node_state
+{
+  /** Next ticket of the node-local ticket lock. */
+  uint32_t ticket_next;
+  /** Ticket currently holding the node-local lock. */
+  uint32_t ticket_owner;
+  /** Whether the node holds the global lock in exclusive mode. */
+  int32_t  global_owned;
+  /** Unit that enqueued in the global lock on behalf of the node. */
+  int32_t  global_holder;
+  /** Number of consecutive local hand-overs of the global lock. */
+  int32_t  passes;
+  /** Number of units on the node holding the lock in shared mode. */
+  int32_t  readers;
+};
+
 struct dart_lock_struct
 {
   /**
-   * Global memory storing the unit at the tail of lock queue.
+   * Global memory storing the unit at the tail of lock queue, followed by
+   * the writer flag and the number of nodes holding the lock in shared
+   * mode.
    * Stored in team-unit 0 by default.
    */
   dart_gptr_t  gptr_tail;
@@ -37,12 +98,31 @@ struct dart_lock_struct
    * to which we send a release message.
    */
   dart_gptr_t  gptr_list;
+  /**
+   * Duplicate of the team communicator used for release messages, which
+   * may be sent by any unit on the node of the predecessor.
+   */
+  MPI_Comm     comm;
+  /**
+   * Communicator of the units in the team sharing the node, only valid
+   * if \c node_win is not \c MPI_WIN_NULL.
+   */
+  MPI_Comm     node_comm;
+  /**
+   * Shared memory window holding the node-local lock state or
+   * \c MPI_WIN_NULL if the state is private to this unit.
+   */
+  MPI_Win      node_win;
+  /**
+   * Node-local lock state in shared memory.
+   */
+  struct dart_lock_node_state * node;
   /**
    * Local mutex to ensure mutual exclusion between threads.
    */
   dart_mutex_t mutex;
   dart_team_t teamid;
-  /** Whether this unit has acquired the lock. */
+  /** Mode in which this unit has acquired the lock. */
   int32_t is_acquired;
 };
 
@@ -67,7 +147,8 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   /* Unit 0 is the process holding the gptr_tail by default. */
   if (unitid.id == 0) {
     int32_t *tail_ptr;
-    ret = dart_memalloc(1, DART_TYPE_INT, &gptr_tail);
+    ret = dart_memalloc(
+            DART_LOCK_GLOBAL_NUM_FIELDS, DART_TYPE_INT, &gptr_tail);
     if (ret != DART_OK) {
       DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
       return ret;
@@ -77,7 +158,9 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
       DART_OK);
 
     /* Local store is safe and effective followed by the sync call. */
-    *tail_ptr = -1;
+    tail_ptr[DART_LOCK_GLOBAL_TAIL]    = -1;
+    tail_ptr[DART_LOCK_GLOBAL_WRITER]  = 0;
+    tail_ptr[DART_LOCK_GLOBAL_READERS] = 0;
     MPI_Win_sync(dart_win_local_alloc);
   }
 
@@ -100,6 +183,56 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *list_ptr = -1;
   MPI_Win_sync(win);
 
+  /* The node-local lock state is allocated in shared memory of the
+   * first unit on the node. If shared memory windows are disabled or not
+   * supported, every unit forms a node on its own. */
+  MPI_Comm node_comm  = MPI_COMM_NULL;
+  MPI_Win  node_win   = MPI_WIN_NULL;
+  struct dart_lock_node_state * node_state = NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  int      node_rank;
+  void   * node_base;
+  MPI_Aint node_size;
+  int      node_disp_unit;
+  if (MPI_Comm_split_type(
+        team_data->comm, MPI_COMM_TYPE_SHARED, unitid.id,
+        MPI_INFO_NULL, &node_comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: Failed to create node communicator!", __FUNCTION__);
+    return DART_ERR_OTHER;
+  }
+  MPI_Comm_set_errhandler(node_comm, MPI_ERRORS_RETURN);
+  MPI_Comm_rank(node_comm, &node_rank);
+  if (MPI_Win_allocate_shared(
+        (node_rank == 0) ? sizeof(struct dart_lock_node_state) : 0,
+        1, MPI_INFO_NULL, node_comm, &node_base, &node_win)
+      == MPI_SUCCESS) {
+    MPI_Win_shared_query(
+      node_win, 0, &node_size, &node_disp_unit, &node_state);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, node_win);
+    if (node_rank == 0) {
+      memset(node_state, 0, sizeof(struct dart_lock_node_state));
+    }
+    MPI_Win_sync(node_win);
+    MPI_Barrier(node_comm);
+    MPI_Win_sync(node_win);
+  } else {
+    DART_LOG_DEBUG("%s: shared memory window not available, "
+                   "lock is not node-aware", __FUNCTION__);
+    node_win   = MPI_WIN_NULL;
+    MPI_Comm_free(&node_comm);
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (node_win == MPI_WIN_NULL) {
+    node_state = calloc(1, sizeof(struct dart_lock_node_state));
+    if (node_state == NULL) {
+      DART_LOG_ERROR("%s: Failed to allocate lock state!", __FUNCTION__);
+      return DART_ERR_OTHER;
+    }
+  }
+
+  MPI_Comm lock_comm;
+  MPI_Comm_dup(team_data->comm, &lock_comm);
+
   // communicate tail pointer
   ret = dart_bcast(
     &gptr_tail,
@@ -116,8 +249,12 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
+  (*lock)->comm        = lock_comm;
+  (*lock)->node_comm   = node_comm;
+  (*lock)->node_win    = node_win;
+  (*lock)->node        = node_state;
   (*lock)->teamid      = teamid;
-  (*lock)->is_acquired = 0;
+  (*lock)->is_acquired = DART_LOCK_NOT_ACQUIRED;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
@@ -127,26 +264,88 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   return DART_OK;
 }
 
-dart_ret_t dart_lock_acquire(dart_lock_t lock)
+static inline void
+lock_progress(dart_team_data_t * team_data)
 {
-  /* lock the local mutex and keep it until the global lock is released */
-  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+  int flag;
+  MPI_Iprobe(
+    MPI_ANY_SOURCE, MPI_ANY_TAG,
+    team_data->comm, &flag, MPI_STATUS_IGNORE);
+}
 
-  if (lock->is_acquired == 1)
-  {
-    DART_LOG_ERROR("dart_lock_acquire: LOCK has already been acquired\n");
-    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-    return DART_ERR_INVAL;
-  }
+/**
+ * Applies \c op with \c value to a field of the global lock state and
+ * returns its previous value.
+ */
+static int32_t
+global_fetch_and_op(dart_lock_t lock, int field, int32_t value, MPI_Op op)
+{
+  int32_t     result;
+  dart_unit_t tail_unit = lock->gptr_tail.unitid;
+  MPI_Aint    disp      = lock->gptr_tail.addr_or_offs.offset +
+                          field * sizeof(int32_t);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value,
+      &result,
+      MPI_INT32_T,
+      tail_unit,
+      disp,
+      op,
+      dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(tail_unit, dart_win_local_alloc),
+    MPI_SUCCESS);
+  return result;
+}
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
-  if (team_data == NULL) {
-    DART_LOG_ERROR("dart_lock_acquire ! failed: Unknown team %i!",
-                   lock->teamid);
-    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-    return DART_ERR_INVAL;
+static void
+node_lock_acquire(dart_lock_t lock, dart_team_data_t * team_data)
+{
+  uint32_t ticket = __atomic_fetch_add(
+                      &lock->node->ticket_next, 1, DART_LOCK_ATOMIC_ORDER);
+  while (__atomic_load_n(&lock->node->ticket_owner, DART_LOCK_ATOMIC_ORDER)
+         != ticket) {
+    // other units on the node may wait for passive target progress
+    lock_progress(team_data);
   }
+}
+
+static bool
+node_lock_try_acquire(dart_lock_t lock)
+{
+  uint32_t owner = __atomic_load_n(
+                     &lock->node->ticket_owner, DART_LOCK_ATOMIC_ORDER);
+  uint32_t next  = owner;
+  return __atomic_compare_exchange_n(
+           &lock->node->ticket_next, &next, owner + 1, false,
+           DART_LOCK_ATOMIC_ORDER, DART_LOCK_ATOMIC_ORDER);
+}
+
+static bool
+node_lock_has_waiters(dart_lock_t lock)
+{
+  uint32_t next  = __atomic_load_n(
+                     &lock->node->ticket_next, DART_LOCK_ATOMIC_ORDER);
+  uint32_t owner = __atomic_load_n(
+                     &lock->node->ticket_owner, DART_LOCK_ATOMIC_ORDER);
+  return (next - owner) > 1;
+}
 
+static void
+node_lock_release(dart_lock_t lock)
+{
+  __atomic_fetch_add(&lock->node->ticket_owner, 1, DART_LOCK_ATOMIC_ORDER);
+}
+
+/**
+ * Enqueues the calling unit in the global MCS queue and blocks until it
+ * reaches the head of the queue.
+ */
+static dart_ret_t
+global_acquire(dart_lock_t lock, dart_team_data_t * team_data)
+{
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
@@ -186,7 +385,6 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
   if (predecessor != -1) {
     int32_t    result;
     MPI_Status status;
-    int16_t    seg_id = gptr_list.segid;
 
     dart_segment_info_t *list_seginfo = dart_segment_get_info(
                                       &(team_data->segdata), gptr_list.segid);
@@ -210,44 +408,31 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
       MPI_Win_flush(predecessor, win),
       DART_OK);
 
-    /* Waiting for notification from its predecessor*/
+    /* Waiting for notification from its predecessor or any other unit
+     * on its node */
     DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
                    "%d in team %d",
                    predecessor, lock->teamid);
 
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
+    MPI_Recv(NULL, 0, MPI_INT, MPI_ANY_SOURCE, 0, lock->comm,
         &status);
   }
-
-  DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
-  lock->is_acquired = 1;
+  lock->node->global_holder = unitid.id;
   return DART_OK;
 }
 
-dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
+/**
+ * Claims the global MCS lock if the queue is empty.
+ */
+static bool
+global_try_acquire(dart_lock_t lock)
 {
-  if (dart__base__mutex_trylock(&lock->mutex) != DART_OK) {
-    *is_acquired = 0;
-    DART_LOG_DEBUG("dart_lock_try_acquire: LOCK held in another thread\n");
-    return DART_OK;
-  }
-
-  if (lock->is_acquired == 1)
-  {
-    DART_LOG_ERROR("dart_lock_try_acquire: LOCK has already been acquired\n");
-    *is_acquired = 1;
-    /* we are using a recursive lock so give up this recursion */
-    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-    return DART_ERR_INVAL;
-  }
-
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
   int32_t result;
   int32_t compare = -1;
 
-
   dart_gptr_t gptr_tail   = lock->gptr_tail;
   dart_unit_t tail_unit   = gptr_tail.unitid;
   uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
@@ -267,55 +452,43 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     MPI_Win_flush (tail_unit, dart_win_local_alloc),
     MPI_SUCCESS);
 
-  /* If the old predecessor was -1, we have claimed the lock,
-   * otherwise, do nothing. */
-  if (result == -1)
-  {
-    lock->is_acquired = 1;
-    *is_acquired = 1;
-  } else {
-    *is_acquired = 0;
-    /* unlock the local mutex if we have not acqcuired the global lock */
-    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  /* If the old predecessor was -1, we have claimed the lock. */
+  if (result == -1) {
+    lock->node->global_holder = unitid.id;
+    return true;
   }
-
-  DART_LOG_DEBUG("dart_lock_try_acquire: trylock %s in team %d",
-                 (*is_acquired) ? "succeeded" : "failed",
-                 lock->teamid);
-  return DART_OK;
+  return false;
 }
 
-dart_ret_t dart_lock_release(dart_lock_t lock)
+/**
+ * Removes the unit that enqueued on behalf of the node from the head of
+ * the global MCS queue and notifies its successor, if any.
+ * The global lock can be released by any unit on the node it has been
+ * passed on to.
+ */
+static dart_ret_t
+global_release(dart_lock_t lock, dart_team_data_t * team_data)
 {
-  if (lock->is_acquired == 0) {
-    DART_LOG_ERROR("dart_lock_release: LOCK has not been acquired before\n");
-    return DART_ERR_INVAL;
-  }
-
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
-  DART_ASSERT(team_data != NULL);
-
   uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
   dart_unit_t   tail        = gptr_tail.unitid;
-  int32_t     * addr;
-  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
 
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
+  dart_team_unit_t holder = DART_TEAM_UNIT_ID(lock->node->global_holder);
 
   int32_t result;
   int32_t reset = -1;
 
-  /* Check if we are at the tail of this lock queue and reset the tail pointer
-   * if we are. If that is the case we are done.
+  /* Check if the holder is at the tail of this lock queue and reset the
+   * tail pointer if it is. If that is the case we are done.
    * Otherwise, the reset fails and we need to send notification. */
   DART_ASSERT_RETURNS(
     MPI_Compare_and_swap(
       &reset,
-      &unitid.id,
+      &holder.id,
       &result,
       MPI_INT32_T,
       tail,
@@ -326,8 +499,8 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     MPI_Win_flush(tail, dart_win_local_alloc),
     MPI_SUCCESS);
 
-  if (result != unitid.id) {
-    /* We are not at the tail of this lock queue. */
+  if (result != holder.id) {
+    /* The holder is not at the tail of this lock queue. */
     int32_t  next;
     DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
                    "(tail = %d) in team %d",
@@ -336,27 +509,24 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     dart_segment_info_t *list_seginfo = dart_segment_get_info(
                                       &(team_data->segdata), gptr_list.segid);
     MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
+    MPI_Aint disp_list = dart_segment_disp(list_seginfo, holder);
 
-    /* Wait for the update of our next pointer. */
+    /* Wait for the update of the holder's next pointer. */
     do {
       // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
+      lock_progress(team_data);
       DART_ASSERT_RETURNS(
         MPI_Fetch_and_op(
           NULL,
           &next,
           MPI_INT,
-          unitid.id,
+          holder.id,
           disp_list,
           MPI_NO_OP,
           win),
         MPI_SUCCESS);
       DART_ASSERT_RETURNS(
-        MPI_Win_flush(unitid.id, win),
+        MPI_Win_flush(holder.id, win),
         MPI_SUCCESS);
     } while (next == -1);
 
@@ -364,17 +534,335 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
                    (lock->teamid));
 
     /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
-    MPI_Win_sync(win);
+    MPI_Send(NULL, 0, MPI_INT, next, 0, lock->comm);
+    if (holder.id == unitid.id) {
+      int32_t * addr;
+      DART_ASSERT_RETURNS(
+        dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
+      *addr = -1;
+      MPI_Win_sync(win);
+    } else {
+      DART_ASSERT_RETURNS(
+        MPI_Fetch_and_op(
+          &reset,
+          &result,
+          MPI_INT32_T,
+          holder.id,
+          disp_list,
+          MPI_REPLACE,
+          win),
+        MPI_SUCCESS);
+      DART_ASSERT_RETURNS(
+        MPI_Win_flush(holder.id, win),
+        MPI_SUCCESS);
+    }
+  }
+  return DART_OK;
+}
+
+/**
+ * Blocks until no node holds the lock in shared mode, the global lock
+ * has to be held.
+ */
+static void
+global_wait_for_readers(dart_lock_t lock, dart_team_data_t * team_data)
+{
+  global_fetch_and_op(lock, DART_LOCK_GLOBAL_WRITER, 1, MPI_REPLACE);
+  while (global_fetch_and_op(lock, DART_LOCK_GLOBAL_READERS, 0, MPI_NO_OP)
+         != 0) {
+    lock_progress(team_data);
+  }
+}
+
+/**
+ * Releases the global lock held by the node in exclusive mode, the
+ * node-local lock has to be held.
+ */
+static dart_ret_t
+global_release_exclusive(dart_lock_t lock, dart_team_data_t * team_data)
+{
+  global_fetch_and_op(lock, DART_LOCK_GLOBAL_WRITER, 0, MPI_REPLACE);
+  lock->node->global_owned = 0;
+  lock->node->passes       = 0;
+  return global_release(lock, team_data);
+}
+
+/**
+ * Registers the node as reader at the global lock, backing off while a
+ * writer holds or waits for the global lock.
+ * Returns false if \c blocking is false and a writer is present.
+ */
+static bool
+global_register_reader(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data,
+  bool               blocking)
+{
+  while (1) {
+    global_fetch_and_op(lock, DART_LOCK_GLOBAL_READERS, 1, MPI_SUM);
+    if (global_fetch_and_op(lock, DART_LOCK_GLOBAL_WRITER, 0, MPI_NO_OP)
+        == 0) {
+      return true;
+    }
+    global_fetch_and_op(lock, DART_LOCK_GLOBAL_READERS, -1, MPI_SUM);
+    if (!blocking) {
+      return false;
+    }
+    while (global_fetch_and_op(lock, DART_LOCK_GLOBAL_WRITER, 0, MPI_NO_OP)
+           != 0) {
+      lock_progress(team_data);
+    }
   }
-  lock->is_acquired = 0;
+}
+
+/**
+ * Locks the thread-local mutex and checks that the lock has not been
+ * acquired by this unit before.
+ */
+static dart_ret_t
+lock_enter(dart_lock_t lock, const char * func, dart_team_data_t ** team_data)
+{
+  /* lock the local mutex and keep it until the global lock is released */
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+
+  if (lock->is_acquired != DART_LOCK_NOT_ACQUIRED)
+  {
+    DART_LOG_ERROR("%s: LOCK has already been acquired\n", func);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (*team_data == NULL) {
+    DART_LOG_ERROR("%s ! failed: Unknown team %i!", func, lock->teamid);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_acquire(dart_lock_t lock)
+{
+  dart_team_data_t * team_data;
+  dart_ret_t ret = lock_enter(lock, __func__, &team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  node_lock_acquire(lock, team_data);
+
+  /* The global lock may have been passed on by a unit on the same node */
+  if (!lock->node->global_owned) {
+    ret = global_acquire(lock, team_data);
+    if (ret != DART_OK) {
+      node_lock_release(lock);
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+      return ret;
+    }
+    global_wait_for_readers(lock, team_data);
+    lock->node->global_owned = 1;
+  }
+
+  DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
+  lock->is_acquired = DART_LOCK_EXCLUSIVE;
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
+{
+  if (dart__base__mutex_trylock(&lock->mutex) != DART_OK) {
+    *is_acquired = 0;
+    DART_LOG_DEBUG("dart_lock_try_acquire: LOCK held in another thread\n");
+    return DART_OK;
+  }
+
+  if (lock->is_acquired != DART_LOCK_NOT_ACQUIRED)
+  {
+    DART_LOG_ERROR("dart_lock_try_acquire: LOCK has already been acquired\n");
+    *is_acquired = 1;
+    /* we are using a recursive lock so give up this recursion */
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  *is_acquired = 0;
+  if (node_lock_try_acquire(lock)) {
+    if (lock->node->global_owned) {
+      *is_acquired = 1;
+    } else if (global_try_acquire(lock)) {
+      global_fetch_and_op(lock, DART_LOCK_GLOBAL_WRITER, 1, MPI_REPLACE);
+      if (global_fetch_and_op(lock, DART_LOCK_GLOBAL_READERS, 0, MPI_NO_OP)
+          == 0) {
+        lock->node->global_owned = 1;
+        *is_acquired = 1;
+      } else {
+        /* the lock is held in shared mode, back off */
+        global_release_exclusive(lock, team_data);
+      }
+    }
+    if (!(*is_acquired)) {
+      node_lock_release(lock);
+    }
+  } else {
+    /* callers typically retry, other units may wait for progress */
+    lock_progress(team_data);
+  }
+
+  if (*is_acquired) {
+    lock->is_acquired = DART_LOCK_EXCLUSIVE;
+  } else {
+    /* unlock the local mutex if we have not acqcuired the global lock */
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  }
+
+  DART_LOG_DEBUG("dart_lock_try_acquire: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_release(dart_lock_t lock)
+{
+  if (lock->is_acquired != DART_LOCK_EXCLUSIVE) {
+    DART_LOG_ERROR("dart_lock_release: LOCK has not been acquired before\n");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  if (node_lock_has_waiters(lock) &&
+      lock->node->passes < DART_LOCK_MAX_LOCAL_PASSES) {
+    /* Pass the global lock on to the next unit on the node */
+    lock->node->passes++;
+    DART_LOG_DEBUG("dart_lock_release: passing lock within node (%d)",
+                   lock->node->passes);
+  } else {
+    dart_ret_t ret = global_release_exclusive(lock, team_data);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  node_lock_release(lock);
+
+  lock->is_acquired = DART_LOCK_NOT_ACQUIRED;
   DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
                  (lock -> teamid));
   return DART_OK;
 }
 
+/**
+ * Enters shared mode after the node-local lock has been acquired,
+ * releases the node-local lock before returning.
+ */
+static bool
+lock_enter_shared(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data,
+  bool               blocking)
+{
+  bool acquired = true;
+  if (lock->node->global_owned) {
+    /* The global lock has been passed on to us in exclusive mode */
+    global_release_exclusive(lock, team_data);
+  }
+  if (__atomic_fetch_add(&lock->node->readers, 1, DART_LOCK_ATOMIC_ORDER)
+      == 0) {
+    /* First reader on the node, no other reader can be active */
+    acquired = global_register_reader(lock, team_data, blocking);
+    if (!acquired) {
+      __atomic_fetch_sub(&lock->node->readers, 1, DART_LOCK_ATOMIC_ORDER);
+    }
+  }
+  node_lock_release(lock);
+  return acquired;
+}
+
+dart_ret_t dart_lock_acquire_shared(dart_lock_t lock)
+{
+  dart_team_data_t * team_data;
+  dart_ret_t ret = lock_enter(lock, __func__, &team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  node_lock_acquire(lock, team_data);
+  lock_enter_shared(lock, team_data, true);
+
+  DART_LOG_DEBUG("dart_lock_acquire_shared: lock acquired in team %d",
+                 lock->teamid);
+  lock->is_acquired = DART_LOCK_SHARED;
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_try_acquire_shared(
+  dart_lock_t   lock,
+  int32_t     * is_acquired)
+{
+  if (dart__base__mutex_trylock(&lock->mutex) != DART_OK) {
+    *is_acquired = 0;
+    DART_LOG_DEBUG("dart_lock_try_acquire_shared: "
+                   "LOCK held in another thread\n");
+    return DART_OK;
+  }
+
+  if (lock->is_acquired != DART_LOCK_NOT_ACQUIRED)
+  {
+    DART_LOG_ERROR("dart_lock_try_acquire_shared: "
+                   "LOCK has already been acquired\n");
+    *is_acquired = 1;
+    /* we are using a recursive lock so give up this recursion */
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  if (node_lock_try_acquire(lock)) {
+    *is_acquired = lock_enter_shared(lock, team_data, false);
+  } else {
+    lock_progress(team_data);
+    *is_acquired = 0;
+  }
+
+  if (*is_acquired) {
+    lock->is_acquired = DART_LOCK_SHARED;
+  } else {
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  }
+
+  DART_LOG_DEBUG("dart_lock_try_acquire_shared: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_release_shared(dart_lock_t lock)
+{
+  if (lock->is_acquired != DART_LOCK_SHARED) {
+    DART_LOG_ERROR("dart_lock_release_shared: "
+                   "LOCK has not been acquired in shared mode before\n");
+    return DART_ERR_INVAL;
+  }
+
+  /* The last reader on the node deregisters the node */
+  if (__atomic_fetch_sub(&lock->node->readers, 1, DART_LOCK_ATOMIC_ORDER)
+      == 1) {
+    global_fetch_and_op(lock, DART_LOCK_GLOBAL_READERS, -1, MPI_SUM);
+  }
+
+  lock->is_acquired = DART_LOCK_NOT_ACQUIRED;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  DART_LOG_DEBUG("dart_lock_release_shared: release lock in team %d",
+                 (lock -> teamid));
+  return DART_OK;
+}
+
 dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 {
   dart_ret_t ret;
@@ -399,8 +887,17 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
     DART_LOG_ERROR("Failed to free global mmeory");
     return ret;
   }
+  MPI_Comm_free(&(*lock)->comm);
+  if ((*lock)->node_win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all((*lock)->node_win);
+    MPI_Win_free(&(*lock)->node_win);
+    MPI_Comm_free(&(*lock)->node_comm);
+  } else {
+    free((*lock)->node);
+  }
   (*lock)->gptr_tail = DART_GPTR_NULL;
   (*lock)->gptr_list = DART_GPTR_NULL;
+  (*lock)->node      = NULL;
   (*lock)->teamid    = DART_TEAM_NULL;
   dart__base__mutex_destroy(&(*lock)->mutex);
   DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
@@ -408,7 +905,3 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   *lock = NULL;
   return DART_OK;
 }
-
-
-
-
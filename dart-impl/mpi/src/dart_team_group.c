@@ -18,6 +18,8 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
+#include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <limits.h>
 
@@ -638,6 +640,9 @@ dart_ret_t dart_team_create(
     dart_allocate_shared_comm(team_data);
 #endif
     MPI_Win_lock_all(0, win);
+    if (dart__mpi__notify_init(team_data) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
     DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d",
                    *newteam, teamid);
     DART_LOG_TRACE("TEAMCREATE - team:%d comm:%p win:%p subcomm:%p",
@@ -666,12 +671,17 @@ dart_ret_t dart_team_destroy(
 
   comm = team_data->comm;
 
+  dart__mpi__aggregation_issue_all(team_data, true);
+
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
+  dart__mpi__team_heap_release(team_data);
+  dart__mpi__notify_fini(team_data);
+
   win = team_data->window;
   MPI_Win_unlock_all(win);
   MPI_Win_free(&win);
@@ -0,0 +1,124 @@
+/**
+ * \file dart_team_heap.c
+ *
+ * First-fit free-list allocator of the symmetric heap of a team.
+ */
+
+#include <dash/dart/mpi/dart_team_heap.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <stdlib.h>
+
+struct dart_team_heap_block {
+  size_t                   offset;
+  size_t                   size;
+  dart_team_heap_block_t * next;
+};
+
+static inline size_t
+heap_block_size(size_t nbytes)
+{
+  // zero-size allocations still obtain a distinct block
+  if (nbytes == 0) {
+    return DART_TEAM_HEAP_ALIGN;
+  }
+  return ((nbytes + DART_TEAM_HEAP_ALIGN - 1) / DART_TEAM_HEAP_ALIGN)
+         * DART_TEAM_HEAP_ALIGN;
+}
+
+void
+dart_team_heap_init(
+  dart_team_heap_t * heap,
+  size_t             size)
+{
+  heap->size        = (size / DART_TEAM_HEAP_ALIGN) * DART_TEAM_HEAP_ALIGN;
+  heap->segid       = 0;
+  heap->freelist    = NULL;
+  heap->num_pooled  = 0;
+  heap->num_windows = 0;
+  if (heap->size > 0) {
+    heap->freelist         = malloc(sizeof(dart_team_heap_block_t));
+    heap->freelist->offset = 0;
+    heap->freelist->size   = heap->size;
+    heap->freelist->next   = NULL;
+  }
+}
+
+dart_ret_t
+dart_team_heap_alloc(
+  dart_team_heap_t * heap,
+  size_t             nbytes,
+  size_t           * offset)
+{
+  size_t                    size = heap_block_size(nbytes);
+  dart_team_heap_block_t ** pred = &heap->freelist;
+  dart_team_heap_block_t  * elem = heap->freelist;
+  while (elem != NULL && elem->size < size) {
+    pred = &elem->next;
+    elem = elem->next;
+  }
+  if (elem == NULL) {
+    DART_LOG_DEBUG("dart_team_heap_alloc: no free block of %zu bytes", size);
+    return DART_ERR_NOTFOUND;
+  }
+  *offset       = elem->offset;
+  elem->offset += size;
+  elem->size   -= size;
+  if (elem->size == 0) {
+    *pred = elem->next;
+    free(elem);
+  }
+  return DART_OK;
+}
+
+void
+dart_team_heap_free(
+  dart_team_heap_t * heap,
+  size_t             offset,
+  size_t             nbytes)
+{
+  size_t                    size = heap_block_size(nbytes);
+  dart_team_heap_block_t ** pred = &heap->freelist;
+  dart_team_heap_block_t  * prev = NULL;
+  dart_team_heap_block_t  * elem = heap->freelist;
+  while (elem != NULL && elem->offset < offset) {
+    prev = elem;
+    pred = &elem->next;
+    elem = elem->next;
+  }
+  // merge with the preceding and following free blocks
+  if (prev != NULL && prev->offset + prev->size == offset) {
+    prev->size += size;
+    if (elem != NULL && prev->offset + prev->size == elem->offset) {
+      prev->size += elem->size;
+      prev->next  = elem->next;
+      free(elem);
+    }
+    return;
+  }
+  if (elem != NULL && offset + size == elem->offset) {
+    elem->offset  = offset;
+    elem->size   += size;
+    return;
+  }
+  dart_team_heap_block_t * block = malloc(sizeof(dart_team_heap_block_t));
+  block->offset = offset;
+  block->size   = size;
+  block->next   = elem;
+  *pred         = block;
+}
+
+void
+dart_team_heap_fini(
+  dart_team_heap_t * heap)
+{
+  dart_team_heap_block_t * elem = heap->freelist;
+  while (elem != NULL) {
+    dart_team_heap_block_t * tmp = elem;
+    elem = elem->next;
+    free(tmp);
+  }
+  heap->freelist = NULL;
+  heap->segid    = 0;
+}
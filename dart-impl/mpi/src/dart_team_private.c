@@ -5,21 +5,14 @@
 #include <stdio.h>
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/if/dart_config.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-#define DART_TEAM_HASH_SIZE (256)
-
 dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
-static dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
-
-static int
-dart_adapt_teamlist_hash(dart_team_t teamid)
-{
-  return (teamid % DART_TEAM_HASH_SIZE);
-}
+dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
 
 #if 0
 
@@ -186,18 +179,6 @@ dart_adapt_teamlist_init()
   return DART_OK;
 }
 
-dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid)
-{
-  int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  while (res != NULL && res->teamid != teamid) {
-    res = res->next;
-  }
-
-  return res;
-}
-
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
@@ -222,6 +203,7 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid)
   }
 
   res->next = NULL;
+  dart__mpi__aggregation_fini(&res->aggregation);
   free(res);
   return DART_OK;
 }
@@ -233,9 +215,14 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
   dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
+  res->notify_win = MPI_WIN_NULL;
   res->next = dart_team_data[slot];
   dart_team_data[slot] = res;
   dart_segment_init(&(res->segdata), teamid);
+  dart_config_t *config;
+  dart_config(&config);
+  dart_team_heap_init(&(res->heap), config->team_heap_size);
+  res->local_atomics = (config->local_atomics != 0);
   return DART_OK;
 }
 
@@ -248,6 +235,7 @@ dart_ret_t dart_adapt_teamlist_destroy()
       dart_team_data_t *tmp = elem;
       elem = tmp->next;
       tmp->next = NULL;
+      dart__mpi__aggregation_fini(&tmp->aggregation);
       free(tmp);
     }
     dart_team_data[i] = NULL;
@@ -45,6 +45,7 @@ typedef struct benchmark_params_t {
   size_t num_updates;
   size_t rep_base;
   bool   verify;
+  bool   aggregate;
 } benchmark_params;
 
 using std::cout;
@@ -96,12 +97,38 @@ uint64_t starts(int64_t n)
   return ran;
 }
 
+/**
+ * Updates are applied as XOR-accumulates buffered per target unit.
+ * The accumulates are atomic, the verification does not report errors.
+ */
+void RandomAccessUpdateAggregated(const benchmark_params & params)
+{
+  uint64_t i;
+  uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
+  auto     table_size = params.size_base;
+
+  dash::AggregationScope aggregate;
+  for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
+    ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+    int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(Table[g_idx].dart_gptr(), &ran, 1,
+                      dash::dart_datatype<value_t>::value, DART_OP_BXOR),
+      DART_OK);
+  }
+}
+
 void RandomAccessUpdate(const benchmark_params & params)
 {
   uint64_t i;
   uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
   auto     table_size = params.size_base;
 
+  if (params.aggregate) {
+    RandomAccessUpdateAggregated(params);
+    return;
+  }
+
   for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
     ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
     int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
@@ -283,6 +310,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.num_updates = NUPDATE;
   params.rep_base    = 1;
   params.verify      = false;
+  params.aggregate   = false;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -293,6 +321,9 @@ benchmark_params parse_args(int argc, char * argv[])
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
+    } else if (flag == "-agg") {
+      params.aggregate = true;
+      --i;
     }
   }
   return params;
@@ -310,6 +341,7 @@ void print_params(
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
   bench_cfg.print_param("-verify", "verification", params.verify);
+  bench_cfg.print_param("-agg",    "aggregation",  params.aggregate);
   bench_cfg.print_section_end();
 }
 
@@ -0,0 +1,184 @@
+/*
+ * Key lookup benchmark for dash::UnorderedMap, compares lookups in the
+ * distributed hash index (dash::UnorderedMap::find) to a linear search
+ * in the global element range.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int    key_t;
+typedef double mapped_t;
+
+template<typename Key>
+struct HashCyclic
+{
+  HashCyclic(dash::Team & team)
+  : _nunits(team.size())
+  { }
+
+  dash::team_unit_t operator()(const Key & key) const {
+    return dash::team_unit_t(key % _nunits);
+  }
+
+private:
+  size_t _nunits;
+};
+
+typedef dash::UnorderedMap<key_t, mapped_t, HashCyclic<key_t>> map_t;
+
+double test_index_find(map_t & map, unsigned, unsigned);
+double test_linear_find(map_t & map, unsigned, unsigned);
+
+void perform_test(unsigned ELEM_PER_UNIT, unsigned NLOOKUPS);
+
+double mlookups(
+  /// Duration in microseconds
+  double   useconds,
+  /// Number of lookups
+  unsigned NLOOKUPS)
+{
+  return static_cast<double>(NLOOKUPS) / useconds;
+}
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0          ,    0}); // this prints the header
+  tests.push_back({16         , 1000});
+  tests.push_back({256        , 1000});
+  tests.push_back({4096       ,  200});
+  tests.push_back({16 * 4096  ,   20});
+  tests.push_back({64 * 4096  ,   10});
+
+  for (auto test : tests) {
+    perform_test(test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  unsigned ELEM_PER_UNIT,
+  unsigned NLOOKUPS)
+{
+  auto num_units = dash::size();
+  if (ELEM_PER_UNIT == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "elem/unit"
+           << ", "
+           << std::setw(10) << "lookups"
+           << ", "
+           << std::setw(12) << "index.Ml/s"
+           << ", "
+           << std::setw(12) << "linear.Ml/s"
+           << ", "
+           << std::setw(11) << "speedup"
+           << endl;
+    }
+    return;
+  }
+
+  map_t map(ELEM_PER_UNIT * num_units);
+  int   myid = dash::myid().id;
+  for (unsigned li = 0; li < ELEM_PER_UNIT; ++li) {
+    key_t key = (num_units * li) + myid;
+    map.local.insert(std::make_pair(key, static_cast<mapped_t>(key)));
+  }
+  map.barrier();
+
+  double t_index  = test_index_find(map, ELEM_PER_UNIT, NLOOKUPS);
+  double t_linear = test_linear_find(map, ELEM_PER_UNIT, NLOOKUPS);
+
+  if (dash::myid() == 0) {
+    double ml_index  = mlookups(t_index,  NLOOKUPS);
+    double ml_linear = mlookups(t_linear, NLOOKUPS);
+    cout << std::setw(10) << num_units
+         << ", "
+         << std::setw(10) << ELEM_PER_UNIT
+         << ", "
+         << std::setw(10) << NLOOKUPS
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << ml_index
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << ml_linear
+         << ", "
+         << std::setw(11) << std::fixed << std::setprecision(2)
+         << ml_index / ml_linear
+         << endl;
+  }
+}
+
+/**
+ * Key at the given lookup step, referencing elements at the last unit in
+ * the team so lookups are remote for most units.
+ */
+inline key_t lookup_key(unsigned step, unsigned ELEM_PER_UNIT)
+{
+  auto num_units = dash::size();
+  return (num_units * ((step * 7919) % ELEM_PER_UNIT)) + (num_units - 1);
+}
+
+double test_index_find(
+  map_t    & map,
+  unsigned   ELEM_PER_UNIT,
+  unsigned   NLOOKUPS)
+{
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned l = 0; l < NLOOKUPS; ++l) {
+    auto found = map.find(lookup_key(l, ELEM_PER_UNIT));
+    if (found == map.end()) {
+      throw std::runtime_error("key not found in hash index");
+    }
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+  return elapsed;
+}
+
+double test_linear_find(
+  map_t    & map,
+  unsigned   ELEM_PER_UNIT,
+  unsigned   NLOOKUPS)
+{
+  typedef typename map_t::value_type value_t;
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned l = 0; l < NLOOKUPS; ++l) {
+    key_t key   = lookup_key(l, ELEM_PER_UNIT);
+    auto  found = std::find_if(
+                    map.begin(), map.end(),
+                    [&](const value_t & v) {
+                      return v.first == key;
+                    });
+    if (found == map.end()) {
+      throw std::runtime_error("key not found in linear search");
+    }
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+  return elapsed;
+}
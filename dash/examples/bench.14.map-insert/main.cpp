@@ -0,0 +1,167 @@
+/*
+ * Insertion benchmark for dash::UnorderedMap, compares element-wise
+ * insertion (dash::UnorderedMap::insert) to collective insertion of
+ * value ranges (dash::UnorderedMap::bulk_insert).
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int    key_t;
+typedef double mapped_t;
+
+template<typename Key>
+struct HashCyclic
+{
+  HashCyclic(dash::Team & team)
+  : _nunits(team.size())
+  { }
+
+  dash::team_unit_t operator()(const Key & key) const {
+    return dash::team_unit_t(key % _nunits);
+  }
+
+private:
+  size_t _nunits;
+};
+
+typedef dash::UnorderedMap<key_t, mapped_t, HashCyclic<key_t>> map_t;
+typedef typename map_t::value_type                             value_t;
+
+double test_elementwise_insert(const std::vector<value_t> &, unsigned);
+double test_bulk_insert(const std::vector<value_t> &, unsigned);
+
+void perform_test(unsigned ELEM_PER_UNIT, unsigned REPEAT);
+
+double minserts(
+  /// Duration in microseconds
+  double   useconds,
+  /// Number of inserted elements
+  unsigned NINSERTS)
+{
+  return static_cast<double>(NINSERTS) / useconds;
+}
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0          ,   0}); // this prints the header
+  tests.push_back({16         , 100});
+  tests.push_back({256        , 100});
+  tests.push_back({4096       ,  20});
+  tests.push_back({16 * 4096  ,   5});
+  tests.push_back({64 * 4096  ,   2});
+
+  for (auto test : tests) {
+    perform_test(test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  unsigned ELEM_PER_UNIT,
+  unsigned REPEAT)
+{
+  auto num_units = dash::size();
+  if (ELEM_PER_UNIT == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "elem/unit"
+           << ", "
+           << std::setw(10) << "repeats"
+           << ", "
+           << std::setw(12) << "elem.Mi/s"
+           << ", "
+           << std::setw(12) << "bulk.Mi/s"
+           << ", "
+           << std::setw(11) << "speedup"
+           << endl;
+    }
+    return;
+  }
+
+  // Keys of every unit are distributed to all units in the team:
+  int myid = dash::myid().id;
+  std::vector<value_t> values;
+  values.reserve(ELEM_PER_UNIT);
+  for (unsigned li = 0; li < ELEM_PER_UNIT; ++li) {
+    key_t key = (num_units * li) + ((myid + li) % num_units);
+    values.push_back(value_t(key, static_cast<mapped_t>(key)));
+  }
+
+  double t_elem = test_elementwise_insert(values, REPEAT);
+  double t_bulk = test_bulk_insert(values, REPEAT);
+
+  if (dash::myid() == 0) {
+    double mi_elem = minserts(t_elem, ELEM_PER_UNIT * REPEAT);
+    double mi_bulk = minserts(t_bulk, ELEM_PER_UNIT * REPEAT);
+    cout << std::setw(10) << num_units
+         << ", "
+         << std::setw(10) << ELEM_PER_UNIT
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << mi_elem
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << mi_bulk
+         << ", "
+         << std::setw(11) << std::fixed << std::setprecision(2)
+         << mi_bulk / mi_elem
+         << endl;
+  }
+}
+
+double test_elementwise_insert(
+  const std::vector<value_t> & values,
+  unsigned                     REPEAT)
+{
+  double elapsed = 0;
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    map_t map;
+    dash::barrier();
+    auto ts_start = Timer::Now();
+    for (const auto & value : values) {
+      map.insert(value);
+    }
+    map.barrier();
+    elapsed += Timer::ElapsedSince(ts_start);
+  }
+  return elapsed;
+}
+
+double test_bulk_insert(
+  const std::vector<value_t> & values,
+  unsigned                     REPEAT)
+{
+  double elapsed = 0;
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    map_t map;
+    dash::barrier();
+    auto ts_start = Timer::Now();
+    map.bulk_insert(values.begin(), values.end());
+    elapsed += Timer::ElapsedSince(ts_start);
+  }
+  return elapsed;
+}
@@ -0,0 +1,146 @@
+/*
+ * Scaling benchmark for dash::sort, compares the distributed sample sort
+ * of a dash::Array to std::sort of the local elements.
+ * Run with varying number of units for strong and weak scaling.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int                   key_t;
+typedef dash::Array<key_t>    array_t;
+
+double test_dash_sort(array_t & arr, unsigned);
+double test_local_sort(array_t & arr, unsigned);
+
+void perform_test(unsigned ELEM_PER_UNIT, unsigned REPEAT);
+
+double melem_per_s(
+  /// Duration in microseconds
+  double useconds,
+  /// Number of sorted elements
+  size_t NELEM)
+{
+  return static_cast<double>(NELEM) / useconds;
+}
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0                 ,  0}); // this prints the header
+  tests.push_back({1024              , 50});
+  tests.push_back({16 * 1024         , 20});
+  tests.push_back({256 * 1024        , 10});
+  tests.push_back({1024 * 1024       ,  5});
+  tests.push_back({4 * 1024 * 1024   ,  2});
+
+  for (auto test : tests) {
+    perform_test(test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  unsigned ELEM_PER_UNIT,
+  unsigned REPEAT)
+{
+  auto num_units = dash::size();
+  if (ELEM_PER_UNIT == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "elem/unit"
+           << ", "
+           << std::setw(10) << "repeats"
+           << ", "
+           << std::setw(12) << "sort.s"
+           << ", "
+           << std::setw(12) << "sort.Me/s"
+           << ", "
+           << std::setw(12) << "local.Me/s"
+           << endl;
+    }
+    return;
+  }
+
+  array_t arr(static_cast<size_t>(ELEM_PER_UNIT) * num_units);
+
+  double t_sort  = test_dash_sort(arr, REPEAT);
+  double t_local = test_local_sort(arr, REPEAT);
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << num_units
+         << ", "
+         << std::setw(10) << ELEM_PER_UNIT
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(6)
+         << (t_sort * 1.0e-6 / REPEAT)
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << melem_per_s(t_sort, arr.size() * REPEAT)
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << melem_per_s(t_local, arr.lsize() * REPEAT)
+         << endl;
+  }
+}
+
+void init_keys(array_t & arr, unsigned rep)
+{
+  std::mt19937 rng(dash::myid().id * 1000 + rep);
+  std::uniform_int_distribution<key_t> dist;
+  std::generate(arr.lbegin(), arr.lend(), [&]() { return dist(rng); });
+  arr.barrier();
+}
+
+double test_dash_sort(
+  array_t  & arr,
+  unsigned   REPEAT)
+{
+  double elapsed = 0;
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    init_keys(arr, r);
+    auto ts_start = Timer::Now();
+    dash::sort(arr.begin(), arr.end());
+    elapsed += Timer::ElapsedSince(ts_start);
+  }
+  return elapsed;
+}
+
+double test_local_sort(
+  array_t  & arr,
+  unsigned   REPEAT)
+{
+  double elapsed = 0;
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    init_keys(arr, r);
+    auto ts_start = Timer::Now();
+    std::sort(arr.lbegin(), arr.lend());
+    elapsed += Timer::ElapsedSince(ts_start);
+    arr.barrier();
+  }
+  return elapsed;
+}
@@ -0,0 +1,136 @@
+/*
+ * Benchmark of collective allocations, compares allocation and release of
+ * small dash::Array instances served from the team heap to allocations
+ * served by a dedicated window per array.
+ * The size of the team heap can be set with environment variable
+ * DART_TEAM_HEAP_SIZE.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef dash::Array<int> array_t;
+
+double test_alloc(dash::Team & team, unsigned, unsigned);
+
+void perform_test(
+  dash::Team & heap_team,
+  dash::Team & window_team,
+  unsigned     ELEM_PER_UNIT,
+  unsigned     REPEAT);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  // Team::All() has been created with the configured team heap, the
+  // heap is disabled for teams created afterwards:
+  dart_config_t * config;
+  dart_config(&config);
+  size_t heap_size       = config->team_heap_size;
+  config->team_heap_size = 0;
+  dash::Team & window_team = dash::Team::All().split(1);
+  config->team_heap_size = heap_size;
+
+  if (window_team.is_null()) {
+    if (dash::myid() == 0) {
+      cout << "Benchmark requires at least 2 units" << endl;
+    }
+    dash::finalize();
+    return 0;
+  }
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0          ,    0}); // this prints the header
+  tests.push_back({1          , 1000});
+  tests.push_back({16         , 1000});
+  tests.push_back({256        , 1000});
+  tests.push_back({4 * 1024   ,  500});
+  tests.push_back({64 * 1024  ,  100});
+
+  for (auto test : tests) {
+    perform_test(dash::Team::All(), window_team,
+                 test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  dash::Team & heap_team,
+  dash::Team & window_team,
+  unsigned     ELEM_PER_UNIT,
+  unsigned     REPEAT)
+{
+  if (ELEM_PER_UNIT == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "elem/unit"
+           << ", "
+           << std::setw(10) << "repeats"
+           << ", "
+           << std::setw(12) << "heap.us"
+           << ", "
+           << std::setw(12) << "window.us"
+           << ", "
+           << std::setw(12) << "saved.us"
+           << endl;
+    }
+    return;
+  }
+
+  double t_heap   = test_alloc(heap_team,   ELEM_PER_UNIT, REPEAT) / REPEAT;
+  double t_window = test_alloc(window_team, ELEM_PER_UNIT, REPEAT) / REPEAT;
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << heap_team.size()
+         << ", "
+         << std::setw(10) << ELEM_PER_UNIT
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << t_heap
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << t_window
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << (t_window - t_heap)
+         << endl;
+  }
+}
+
+/**
+ * Duration of allocating and releasing an array in microseconds, summed
+ * over all repetitions.
+ */
+double test_alloc(
+  dash::Team & team,
+  unsigned     ELEM_PER_UNIT,
+  unsigned     REPEAT)
+{
+  team.barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    array_t arr(static_cast<size_t>(ELEM_PER_UNIT) * team.size(), team);
+    *arr.lbegin() = r;
+  }
+  return Timer::ElapsedSince(ts_start);
+}
@@ -0,0 +1,166 @@
+/*
+ * Latency benchmark of 8-byte DART get operations.
+ * Segments are resolved on every RMA operation, the latency is measured
+ * with an increasing number of live segments in the team to show that
+ * resolution does not depend on the number of segments.
+ * Gets from the unit's own memory without resolving the segment are
+ * measured as reference.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int64_t value_t;
+
+double test_get(dart_gptr_t gptr, unsigned);
+double test_memcpy(dart_gptr_t gptr, unsigned);
+
+void perform_test(
+  std::vector<dart_gptr_t> & segments,
+  unsigned                   NUM_SEGMENTS,
+  unsigned                   REPEAT);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0          ,      0}); // this prints the header
+  tests.push_back({1          , 100000});
+  tests.push_back({256        , 100000});
+  tests.push_back({1024       , 100000});
+  tests.push_back({4096       , 100000});
+
+  std::vector<dart_gptr_t> segments;
+  for (auto test : tests) {
+    perform_test(segments, test.first, test.second);
+  }
+  for (auto gptr : segments) {
+    dart_team_memfree(gptr);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  std::vector<dart_gptr_t> & segments,
+  unsigned                   NUM_SEGMENTS,
+  unsigned                   REPEAT)
+{
+  if (NUM_SEGMENTS == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "segments"
+           << ", "
+           << std::setw(10) << "repeats"
+           << ", "
+           << std::setw(12) << "local.ns"
+           << ", "
+           << std::setw(12) << "remote.ns"
+           << ", "
+           << std::setw(12) << "memcpy.ns"
+           << endl;
+    }
+    return;
+  }
+
+  while (segments.size() < NUM_SEGMENTS) {
+    dart_gptr_t gptr;
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        DART_TEAM_ALL, 1, dash::dart_datatype<value_t>::value, &gptr),
+      DART_OK);
+    segments.push_back(gptr);
+  }
+
+  // access the segment allocated last
+  dart_gptr_t gptr = segments.back();
+  dart_gptr_t lgptr = gptr;
+  dart_gptr_t rgptr = gptr;
+  dart_team_unit_t myid = dash::Team::All().myid();
+  dart_gptr_setunit(&lgptr, myid);
+  dart_gptr_setunit(&rgptr,
+                    dart_team_unit_t { static_cast<dart_unit_t>(
+                                         (myid.id + 1) % dash::size()) });
+
+  double t_local  = test_get(lgptr, REPEAT);
+  double t_remote = test_get(rgptr, REPEAT);
+  double t_memcpy = test_memcpy(lgptr, REPEAT);
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(10) << NUM_SEGMENTS
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << (t_local * 1.0e3 / REPEAT)
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << (t_remote * 1.0e3 / REPEAT)
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << (t_memcpy * 1.0e3 / REPEAT)
+         << endl;
+  }
+}
+
+/**
+ * Duration of blocking 8-byte gets in microseconds, summed over all
+ * repetitions.
+ */
+double test_get(
+  dart_gptr_t gptr,
+  unsigned    REPEAT)
+{
+  value_t value;
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    dart_get_blocking(&value, gptr, 1,
+                      dash::dart_datatype<value_t>::value,
+                      dash::dart_datatype<value_t>::value);
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+  return elapsed;
+}
+
+/**
+ * Duration of 8-byte copies from the unit's own memory in microseconds,
+ * summed over all repetitions.
+ */
+double test_memcpy(
+  dart_gptr_t gptr,
+  unsigned    REPEAT)
+{
+  value_t   value;
+  value_t * addr;
+  dart_gptr_getaddr(gptr, reinterpret_cast<void **>(&addr));
+  volatile value_t * src = addr;
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    value = *src;
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  (void)value;
+  return elapsed;
+}
@@ -0,0 +1,157 @@
+/*
+ * Throughput benchmark of non-blocking DART operations, issues batches of
+ * 8-byte gets and puts with handles to the next unit and completes them
+ * with dart_waitall.
+ * Handles are reused from the handle pool of DART, the throughput should
+ * not depend on the batch size beyond the cost of the transfers.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int64_t value_t;
+
+double test_get_handles(dart_gptr_t gptr, unsigned, unsigned);
+double test_put_handles(dart_gptr_t gptr, unsigned, unsigned);
+
+void perform_test(
+  dart_gptr_t gptr,
+  unsigned    BATCH_SIZE,
+  unsigned    REPEAT);
+
+double mops(
+  /// Duration in microseconds
+  double   useconds,
+  /// Number of operations
+  size_t   NOPS)
+{
+  return static_cast<double>(NOPS) / useconds;
+}
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<int, int>> tests;
+
+  tests.push_back({0          ,     0}); // this prints the header
+  tests.push_back({1          , 20000});
+  tests.push_back({16         ,  2000});
+  tests.push_back({256        ,   200});
+  tests.push_back({4096       ,    20});
+
+  dash::Array<value_t> arr(4096 * dash::size());
+
+  for (auto test : tests) {
+    // target the local block of the next unit
+    dart_gptr_t gptr = arr.begin().dart_gptr();
+    dart_team_unit_t next = {
+      static_cast<dart_unit_t>((arr.team().myid() + 1) % arr.team().size())
+    };
+    dart_gptr_setunit(&gptr, next);
+    perform_test(gptr, test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  dart_gptr_t gptr,
+  unsigned    BATCH_SIZE,
+  unsigned    REPEAT)
+{
+  if (BATCH_SIZE == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "batch"
+           << ", "
+           << std::setw(10) << "repeats"
+           << ", "
+           << std::setw(12) << "get.Mop/s"
+           << ", "
+           << std::setw(12) << "put.Mop/s"
+           << endl;
+    }
+    return;
+  }
+
+  double t_get = test_get_handles(gptr, BATCH_SIZE, REPEAT);
+  double t_put = test_put_handles(gptr, BATCH_SIZE, REPEAT);
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(10) << BATCH_SIZE
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << mops(t_get, static_cast<size_t>(BATCH_SIZE) * REPEAT)
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(4)
+         << mops(t_put, static_cast<size_t>(BATCH_SIZE) * REPEAT)
+         << endl;
+  }
+}
+
+double test_get_handles(
+  dart_gptr_t gptr,
+  unsigned    BATCH_SIZE,
+  unsigned    REPEAT)
+{
+  std::vector<value_t>       values(BATCH_SIZE);
+  std::vector<dart_handle_t> handles(BATCH_SIZE);
+  auto dtype = dash::dart_datatype<value_t>::value;
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    dart_gptr_t g = gptr;
+    for (unsigned i = 0; i < BATCH_SIZE; ++i) {
+      dart_get_handle(&values[i], g, 1, dtype, dtype, &handles[i]);
+      g.addr_or_offs.offset += sizeof(value_t);
+    }
+    dart_waitall(handles.data(), BATCH_SIZE);
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+  return elapsed;
+}
+
+double test_put_handles(
+  dart_gptr_t gptr,
+  unsigned    BATCH_SIZE,
+  unsigned    REPEAT)
+{
+  std::vector<value_t>       values(BATCH_SIZE, dash::myid());
+  std::vector<dart_handle_t> handles(BATCH_SIZE);
+  auto dtype = dash::dart_datatype<value_t>::value;
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    dart_gptr_t g = gptr;
+    for (unsigned i = 0; i < BATCH_SIZE; ++i) {
+      dart_put_handle(g, &values[i], 1, dtype, dtype, &handles[i]);
+      g.addr_or_offs.offset += sizeof(value_t);
+    }
+    dart_waitall(handles.data(), BATCH_SIZE);
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+  return elapsed;
+}
@@ -0,0 +1,176 @@
+/*
+ * Latency benchmark of DART atomic operations, compares atomics issued
+ * through MPI to atomics applied using processor atomics on node-local
+ * memory (see dart_config_t::local_atomics).
+ * Processor atomics are only used if all units of the team share the node
+ * and shared memory windows are enabled, or if the team consists of a
+ * single unit.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int64_t value_t;
+
+enum class atomic_op {
+  fetch_add,
+  accumulate,
+  compare_swap
+};
+
+dart_team_t create_team(bool local_atomics);
+
+double test_atomic(dart_team_t team, atomic_op op, int dist, unsigned);
+
+void perform_test(
+  dart_team_t  mpi_team,
+  dart_team_t  local_team,
+  atomic_op    op,
+  const char * op_name,
+  int          dist,
+  unsigned     REPEAT);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dart_team_t mpi_team   = create_team(false);
+  dart_team_t local_team = create_team(true);
+
+  const unsigned REPEAT = 100000;
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << "units"
+         << ", "
+         << std::setw(12) << "op"
+         << ", "
+         << std::setw(8)  << "target"
+         << ", "
+         << std::setw(12) << "mpi.us"
+         << ", "
+         << std::setw(12) << "local.us"
+         << ", "
+         << std::setw(10) << "speedup"
+         << endl;
+  }
+  for (int dist = 0; dist < 2; ++dist) {
+    perform_test(mpi_team, local_team, atomic_op::fetch_add,
+                 "fetch_add", dist, REPEAT);
+    perform_test(mpi_team, local_team, atomic_op::accumulate,
+                 "accumulate", dist, REPEAT);
+    perform_test(mpi_team, local_team, atomic_op::compare_swap,
+                 "cas", dist, REPEAT);
+  }
+
+  dart_team_destroy(&local_team);
+  dart_team_destroy(&mpi_team);
+
+  dash::finalize();
+
+  return 0;
+}
+
+/**
+ * Creates a team of all units, the configuration applies to teams created
+ * afterwards.
+ */
+dart_team_t create_team(bool local_atomics)
+{
+  dart_config_t * config;
+  dart_config(&config);
+  int local_atomics_prev = config->local_atomics;
+  config->local_atomics  = local_atomics;
+
+  dart_group_t group;
+  dart_team_t  team;
+  dart_team_get_group(DART_TEAM_ALL, &group);
+  dart_team_create(DART_TEAM_ALL, group, &team);
+  dart_group_destroy(&group);
+
+  config->local_atomics = local_atomics_prev;
+  return team;
+}
+
+void perform_test(
+  dart_team_t  mpi_team,
+  dart_team_t  local_team,
+  atomic_op    op,
+  const char * op_name,
+  int          dist,
+  unsigned     REPEAT)
+{
+  double t_mpi   = test_atomic(mpi_team,   op, dist, REPEAT) / REPEAT;
+  double t_local = test_atomic(local_team, op, dist, REPEAT) / REPEAT;
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(12) << op_name
+         << ", "
+         << std::setw(8)  << (dist == 0 ? "self" : "right")
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(3)
+         << t_mpi
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(3)
+         << t_local
+         << ", "
+         << std::setw(10) << std::fixed << std::setprecision(2)
+         << (t_mpi / t_local)
+         << endl;
+  }
+}
+
+/**
+ * Duration of completed atomic operations on a counter of the unit at
+ * distance \c dist in microseconds, summed over all repetitions.
+ */
+double test_atomic(
+  dart_team_t team,
+  atomic_op   op,
+  int         dist,
+  unsigned    REPEAT)
+{
+  dart_gptr_t gptr;
+  dart_team_memalloc_aligned(team, 1, DART_TYPE_LONGLONG, &gptr);
+  dart_team_unit_t target;
+  target.id = (dash::myid() + dist) % dash::size();
+  dart_gptr_setunit(&gptr, target);
+
+  value_t one = 1;
+  value_t result;
+  value_t compare = 0;
+  dart_barrier(team);
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    switch (op) {
+      case atomic_op::fetch_add:
+        dart_fetch_and_op(gptr, &one, &result,
+                          DART_TYPE_LONGLONG, DART_OP_SUM);
+        break;
+      case atomic_op::accumulate:
+        dart_accumulate(gptr, &one, 1, DART_TYPE_LONGLONG, DART_OP_SUM);
+        break;
+      case atomic_op::compare_swap:
+        dart_compare_and_swap(gptr, &one, &compare, &result,
+                              DART_TYPE_LONGLONG);
+        break;
+    }
+    dart_flush(gptr);
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  dart_barrier(team);
+  dart_team_memfree(gptr);
+  return elapsed;
+}
@@ -0,0 +1,155 @@
+/*
+ * Benchmark of communication/computation overlap of non-blocking DART
+ * gets. Every unit starts a get from its right neighbor, computes without
+ * calling into MPI for as long as the transfer takes on its own and then
+ * waits for the transfer.
+ * Without asynchronous progress, large transfers only proceed in the final
+ * wait. Run with DART_PROGRESS_THREAD=1 (requires DART built with thread
+ * support) to poll MPI in a background thread.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <iostream>
+#include <iomanip>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+double test_transfer(dart_gptr_t gptr, char * buf, size_t, double, unsigned);
+
+void compute(double usecs);
+
+void perform_test(
+  size_t   NBYTES,
+  unsigned REPEAT);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<size_t, int>> tests;
+
+  tests.push_back({0                ,   0}); // this prints the header
+  tests.push_back({64   * 1024      , 100});
+  tests.push_back({1024 * 1024      ,  50});
+  tests.push_back({16   * 1024 * 1024,  10});
+
+  for (auto test : tests) {
+    perform_test(test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  size_t   NBYTES,
+  unsigned REPEAT)
+{
+  if (NBYTES == 0) {
+    if (dash::myid() == 0) {
+      dart_config_t * config;
+      dart_config(&config);
+      cout << "progress thread: "
+           << (config->progress_thread ? "enabled" : "disabled")
+           << endl;
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "size.kb"
+           << ", "
+           << std::setw(12) << "transfer.us"
+           << ", "
+           << std::setw(12) << "compute.us"
+           << ", "
+           << std::setw(12) << "total.us"
+           << ", "
+           << std::setw(10) << "overlap.%"
+           << endl;
+    }
+    return;
+  }
+
+  dart_gptr_t gptr;
+  DASH_ASSERT_RETURNS(
+    dart_team_memalloc_aligned(DART_TEAM_ALL, NBYTES, DART_TYPE_BYTE, &gptr),
+    DART_OK);
+  dart_team_unit_t right { static_cast<dart_unit_t>(
+                             (dash::myid() + 1) % dash::size()) };
+  dart_gptr_setunit(&gptr, right);
+  char * buf = new char[NBYTES];
+
+  // duration of the transfer without computation
+  double t_transfer = test_transfer(gptr, buf, NBYTES, 0, REPEAT) / REPEAT;
+  // computation as long as the transfer, overlapped with the transfer
+  double t_total    = test_transfer(gptr, buf, NBYTES, t_transfer, REPEAT)
+                      / REPEAT;
+  double overlap    = (t_transfer + t_transfer - t_total) / t_transfer;
+  overlap = std::max(0.0, std::min(1.0, overlap));
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(10) << NBYTES / 1024
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << t_transfer
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << t_transfer
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << t_total
+         << ", "
+         << std::setw(10) << std::fixed << std::setprecision(1)
+         << overlap * 100
+         << endl;
+  }
+
+  delete[] buf;
+  dart_gptr_setunit(&gptr, dart_team_unit_t { 0 });
+  dart_team_memfree(gptr);
+}
+
+/**
+ * Busy computation of \c usecs microseconds without calling into MPI.
+ */
+void compute(double usecs)
+{
+  auto ts_start = Timer::Now();
+  while (Timer::ElapsedSince(ts_start) < usecs) { }
+}
+
+/**
+ * Duration in microseconds of getting \c NBYTES from \c gptr while
+ * computing for \c t_compute microseconds, summed over all repetitions.
+ */
+double test_transfer(
+  dart_gptr_t gptr,
+  char      * buf,
+  size_t      NBYTES,
+  double      t_compute,
+  unsigned    REPEAT)
+{
+  double elapsed = 0;
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    dash::barrier();
+    auto ts_start = Timer::Now();
+    dart_handle_t handle;
+    dart_get_handle(buf, gptr, NBYTES, DART_TYPE_BYTE, DART_TYPE_BYTE,
+                    &handle);
+    compute(t_compute);
+    dart_wait(&handle);
+    elapsed += Timer::ElapsedSince(ts_start);
+  }
+  dash::barrier();
+  return elapsed;
+}
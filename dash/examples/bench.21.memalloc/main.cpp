@@ -0,0 +1,175 @@
+/*
+ * Benchmark of the allocator of dart_memalloc.
+ * Measures the throughput of allocations and deallocations of random
+ * sizes up to a maximum size with a fixed number of live allocations,
+ * and the utilization of the local allocation pool, i.e. the share of
+ * the pool that has been requested when the first allocation fails.
+ * Run with DART_LOCAL_ALLOC_BUDDY=1 to measure the buddy allocator.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+void perform_test(
+  size_t   MAX_SIZE,
+  unsigned REPEAT);
+
+double test_throughput(size_t MAX_SIZE, unsigned REPEAT);
+
+double test_utilization(size_t MAX_SIZE);
+
+/// Number of allocations alive at any time in the throughput test
+const size_t NUM_LIVE = 64;
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::pair<size_t, int>> tests;
+
+  tests.push_back({0          ,      0}); // this prints the header
+  tests.push_back({64         , 100000});
+  tests.push_back({1024       , 100000});
+  tests.push_back({32 * 1024  ,  50000});
+  tests.push_back({256 * 1024 ,  10000});
+
+  for (auto test : tests) {
+    perform_test(test.first, test.second);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  size_t   MAX_SIZE,
+  unsigned REPEAT)
+{
+  if (MAX_SIZE == 0) {
+    if (dash::myid() == 0) {
+      dart_config_t * config;
+      dart_config(&config);
+      cout << "allocator: "
+           << (config->local_alloc_buddy ? "buddy" : "size-class")
+           << ", pool size: " << config->local_alloc_size / 1024 << " KiB"
+           << endl;
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "max.bytes"
+           << ", "
+           << std::setw(10) << "repeat"
+           << ", "
+           << std::setw(12) << "mops/s"
+           << ", "
+           << std::setw(14) << "utilization.%"
+           << endl;
+    }
+    return;
+  }
+
+  dash::barrier();
+  double mops        = test_throughput(MAX_SIZE, REPEAT);
+  double utilization = test_utilization(MAX_SIZE);
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(10) << MAX_SIZE
+         << ", "
+         << std::setw(10) << REPEAT
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << mops
+         << ", "
+         << std::setw(14) << std::fixed << std::setprecision(1)
+         << utilization * 100
+         << endl;
+  }
+}
+
+/**
+ * Million allocations and deallocations per second, replacing a random
+ * one of \c NUM_LIVE allocations by an allocation of random size in
+ * every repetition.
+ */
+double test_throughput(size_t MAX_SIZE, unsigned REPEAT)
+{
+  std::mt19937 rng(dash::myid());
+  std::uniform_int_distribution<size_t> size_dist(1, MAX_SIZE);
+  std::uniform_int_distribution<size_t> slot_dist(0, NUM_LIVE - 1);
+
+  std::vector<size_t> sizes(REPEAT);
+  std::vector<size_t> slots(REPEAT);
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    sizes[r] = size_dist(rng);
+    slots[r] = slot_dist(rng);
+  }
+
+  std::vector<dart_gptr_t> live(NUM_LIVE);
+  for (auto & gptr : live) {
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(size_dist(rng), DART_TYPE_BYTE, &gptr),
+      DART_OK);
+  }
+
+  auto ts_start = Timer::Now();
+  for (unsigned r = 0; r < REPEAT; ++r) {
+    dart_gptr_t & gptr = live[slots[r]];
+    DASH_ASSERT_RETURNS(dart_memfree(gptr), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(sizes[r], DART_TYPE_BYTE, &gptr),
+      DART_OK);
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+
+  for (auto & gptr : live) {
+    DASH_ASSERT_RETURNS(dart_memfree(gptr), DART_OK);
+  }
+  return (2.0 * REPEAT) / elapsed;
+}
+
+/**
+ * Share of the local allocation pool requested by allocations of random
+ * size before the first allocation fails.
+ */
+double test_utilization(size_t MAX_SIZE)
+{
+  dart_config_t * config;
+  dart_config(&config);
+
+  std::mt19937 rng(dash::myid());
+  std::uniform_int_distribution<size_t> size_dist(1, MAX_SIZE);
+
+  std::vector<dart_gptr_t> gptrs;
+  size_t requested = 0;
+  while (true) {
+    size_t      nbytes = size_dist(rng);
+    dart_gptr_t gptr;
+    if (requested + nbytes > config->local_alloc_size ||
+        dart_memalloc(nbytes, DART_TYPE_BYTE, &gptr) != DART_OK) {
+      break;
+    }
+    gptrs.push_back(gptr);
+    requested += nbytes;
+  }
+  for (auto & gptr : gptrs) {
+    DASH_ASSERT_RETURNS(dart_memfree(gptr), DART_OK);
+  }
+  return static_cast<double>(requested) / config->local_alloc_size;
+}
@@ -0,0 +1,194 @@
+/*
+ * Benchmark of deep halos in a 2D heat equation with a 5-point stencil.
+ * Halo regions of depth k are exchanged once every k iterations, halo
+ * elements within the remaining valid depth are computed redundantly in
+ * between. Measures the time per iteration for small blocks per unit,
+ * where halo exchanges dominate, with increasing halo depth.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <deque>
+#include <iostream>
+#include <iomanip>
+#include <tuple>
+#include <utility>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+using pattern_t    = dash::Pattern<2>;
+using index_t      = typename pattern_t::index_type;
+using matrix_t     = dash::Matrix<double, 2, index_t, pattern_t>;
+using StencilSpecT = dash::StencilSpec<2,4>;
+using StencilT     = dash::Stencil<2>;
+using HaloMatrixWrapperT = dash::HaloMatrixWrapper<matrix_t, StencilSpecT>;
+
+void perform_test(
+  size_t   BLOCK_EXT,
+  size_t   DEPTH,
+  unsigned ITERATIONS);
+
+double test_heat(
+  HaloMatrixWrapperT & halo_1,
+  HaloMatrixWrapperT & halo_2,
+  unsigned             ITERATIONS);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::tuple<size_t, size_t, unsigned>> tests;
+
+  tests.push_back(std::make_tuple(0   , 0,    0)); // this prints the header
+  for (size_t block_ext : { 16, 64, 256 }) {
+    for (size_t depth : { 1, 2, 4, 8 }) {
+      tests.push_back(std::make_tuple(block_ext, depth,
+                                      block_ext > 64 ? 100 : 1000));
+    }
+  }
+
+  for (auto test : tests) {
+    perform_test(std::get<0>(test), std::get<1>(test), std::get<2>(test));
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(
+  size_t   BLOCK_EXT,
+  size_t   DEPTH,
+  unsigned ITERATIONS)
+{
+  if (BLOCK_EXT == 0) {
+    if (dash::myid() == 0) {
+      cout << std::setw(10) << "units"
+           << ", "
+           << std::setw(10) << "block.ext"
+           << ", "
+           << std::setw(10) << "depth"
+           << ", "
+           << std::setw(10) << "exchange"
+           << ", "
+           << std::setw(10) << "iterations"
+           << ", "
+           << std::setw(12) << "us/iter"
+           << endl;
+    }
+    return;
+  }
+
+  dash::TeamSpec<2> team_spec;
+  team_spec.balance_extents();
+  pattern_t pattern(
+    dash::SizeSpec<2>(BLOCK_EXT * team_spec.extent(0),
+                      BLOCK_EXT * team_spec.extent(1)),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+    team_spec);
+
+  matrix_t matrix_1(pattern);
+  matrix_t matrix_2(pattern);
+  std::fill(matrix_1.lbegin(), matrix_1.lend(), dash::myid() == 0 ? 1.0 : 0.0);
+  std::fill(matrix_2.lbegin(), matrix_2.lend(), 0.0);
+
+  StencilSpecT stencil_spec({ StencilT(-1, 0), StencilT(1, 0),
+                              StencilT( 0,-1), StencilT(0, 1) });
+  dash::CycleSpec<2> cycle_spec(dash::Cycle::CYCLIC, dash::Cycle::CYCLIC);
+
+  HaloMatrixWrapperT halo_1(matrix_1, stencil_spec, cycle_spec,
+                            dash::HaloExchange::AUTO, DEPTH);
+  HaloMatrixWrapperT halo_2(matrix_2, stencil_spec, cycle_spec,
+                            dash::HaloExchange::AUTO, DEPTH);
+
+  dash::barrier();
+  double usecs = test_heat(halo_1, halo_2, ITERATIONS);
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(10) << BLOCK_EXT
+         << ", "
+         << std::setw(10) << DEPTH
+         << ", "
+         << std::setw(10)
+         << (halo_1.exchange() == dash::HaloExchange::PUSH ? "push" : "get")
+         << ", "
+         << std::setw(10) << ITERATIONS
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << usecs / ITERATIONS
+         << endl;
+  }
+}
+
+/**
+ * Microseconds for the given number of iterations, alternating between the
+ * two matrices.
+ */
+double test_heat(
+  HaloMatrixWrapperT & halo_1,
+  HaloMatrixWrapperT & halo_2,
+  unsigned             ITERATIONS)
+{
+  const double dt = 0.05;
+
+  auto heat = [dt](double core, double n0, double n1, double n2, double n3) {
+    return core + dt * (n0 + n1 + n2 + n3 - 4 * core);
+  };
+
+  auto * current = &halo_1;
+  auto * next    = &halo_2;
+  bool   get     = halo_1.exchange() == dash::HaloExchange::GET ||
+                   halo_2.exchange() == dash::HaloExchange::GET;
+
+  auto ts_start = Timer::Now();
+  for (unsigned i = 0; i < ITERATIONS; ++i) {
+    bool exchange = current->valid_depth() == 0;
+    if (exchange) {
+      current->update_async();
+    }
+
+    auto * next_local = next->matrix().lbegin();
+    auto   it_iend    = current->iend();
+    for (auto it = current->ibegin(); it != it_iend; ++it) {
+      next_local[it.lpos()] = heat(*it, it.value_at(0), it.value_at(1),
+                                   it.value_at(2), it.value_at(3));
+    }
+
+    if (exchange) {
+      current->wait();
+    }
+
+    auto it_bend = current->bend();
+    for (auto it = current->bbegin(); it != it_bend; ++it) {
+      next_local[it.lpos()] = heat(*it, it.value_at(0), it.value_at(1),
+                                   it.value_at(2), it.value_at(3));
+    }
+
+    // halo elements still valid in the next iteration
+    auto * next_halo = next->halo_memory().pos_start();
+    auto   it_hend   = current->hend();
+    for (auto it = current->hbegin(); it != it_hend; ++it) {
+      next_halo[it.hpos()] = heat(*it, it.value_at(0), it.value_at(1),
+                                  it.value_at(2), it.value_at(3));
+    }
+    next->set_valid_depth(current->valid_depth() - 1);
+
+    std::swap(current, next);
+    // gets read the matrix of the neighbors: it must not be modified
+    // before the halo exchange and before the neighbors completed it
+    if (get && (exchange || current->valid_depth() == 0)) {
+      current->matrix().barrier();
+    }
+  }
+  return Timer::ElapsedSince(ts_start);
+}
@@ -0,0 +1,265 @@
+/*
+ * Benchmark of the stencil operator of halo matrix wrappers on the inner
+ * elements of the local block, compared to the halo matrix iterator.
+ * Measures a 5-point stencil in 2D and a 7-point stencil in 3D with
+ * increasing block extents per unit:
+ *
+ * - iterator:  inner elements via HaloMatrixWrapper::ibegin and value_at
+ * - op.seq:    StencilOperator::apply, sequential
+ * - op.par:    StencilOperator::apply, threads of the unit
+ * - op.tb:     StencilOperator::apply with temporal blocking of
+ *              \c SWEEPS iterations
+ *
+ * Results in million lattice updates per second and unit.
+ */
+#include "../bench.h"
+#include <libdash.h>
+
+#include <array>
+#include <deque>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+const std::size_t SWEEPS = 4;
+
+template <dash::dim_t NumDimensions>
+struct StencilBench;
+
+template <>
+struct StencilBench<2> {
+  using pattern_t    = dash::Pattern<2>;
+  using index_t      = typename pattern_t::index_type;
+  using matrix_t     = dash::Matrix<double, 2, index_t, pattern_t>;
+  using StencilSpecT = dash::StencilSpec<2,4>;
+  using StencilT     = dash::Stencil<2>;
+
+  static StencilSpecT stencil_spec() {
+    return StencilSpecT({ StencilT(-1, 0), StencilT(1, 0),
+                          StencilT( 0,-1), StencilT(0, 1) });
+  }
+
+  static pattern_t pattern(size_t block_ext) {
+    dash::TeamSpec<2> team_spec;
+    team_spec.balance_extents();
+    return pattern_t(dash::SizeSpec<2>(block_ext * team_spec.extent(0),
+                                       block_ext * team_spec.extent(1)),
+                     dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                     team_spec);
+  }
+};
+
+template <>
+struct StencilBench<3> {
+  using pattern_t    = dash::Pattern<3>;
+  using index_t      = typename pattern_t::index_type;
+  using matrix_t     = dash::Matrix<double, 3, index_t, pattern_t>;
+  using StencilSpecT = dash::StencilSpec<3,6>;
+  using StencilT     = dash::Stencil<3>;
+
+  static StencilSpecT stencil_spec() {
+    return StencilSpecT({ StencilT(-1, 0, 0), StencilT(1, 0, 0),
+                          StencilT( 0,-1, 0), StencilT(0, 1, 0),
+                          StencilT( 0, 0,-1), StencilT(0, 0, 1) });
+  }
+
+  static pattern_t pattern(size_t block_ext) {
+    dash::TeamSpec<3> team_spec;
+    team_spec.balance_extents();
+    return pattern_t(dash::SizeSpec<3>(block_ext * team_spec.extent(0),
+                                       block_ext * team_spec.extent(1),
+                                       block_ext * team_spec.extent(2)),
+                     dash::DistributionSpec<3>(dash::BLOCKED, dash::BLOCKED,
+                                               dash::BLOCKED),
+                     team_spec);
+  }
+};
+
+template <dash::dim_t NumDimensions>
+void perform_test(
+  size_t   BLOCK_EXT,
+  unsigned ITERATIONS);
+
+void print_header();
+
+void print_result(
+  dash::dim_t              ndim,
+  size_t             block_ext,
+  const std::string& method,
+  size_t             updates,
+  double             usecs);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  std::deque<std::tuple<dash::dim_t, size_t, unsigned>> tests;
+
+  tests.push_back(std::make_tuple(0, 0, 0)); // this prints the header
+  for (size_t block_ext : { 64, 256, 1024 }) {
+    tests.push_back(std::make_tuple(2, block_ext,
+                                    block_ext > 256 ? 8 : 40));
+  }
+  for (size_t block_ext : { 16, 64, 128 }) {
+    tests.push_back(std::make_tuple(3, block_ext,
+                                    block_ext > 64 ? 8 : 40));
+  }
+
+  for (auto test : tests) {
+    if (std::get<0>(test) == 0) {
+      print_header();
+    } else if (std::get<0>(test) == 2) {
+      perform_test<2>(std::get<1>(test), std::get<2>(test));
+    } else {
+      perform_test<3>(std::get<1>(test), std::get<2>(test));
+    }
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+template <dash::dim_t NumDimensions>
+void perform_test(
+  size_t   BLOCK_EXT,
+  unsigned ITERATIONS)
+{
+  using Bench_t      = StencilBench<NumDimensions>;
+  using matrix_t     = typename Bench_t::matrix_t;
+  using StencilSpecT = typename Bench_t::StencilSpecT;
+  using HaloMatrixWrapperT = dash::HaloMatrixWrapper<matrix_t, StencilSpecT>;
+  using Values_t     = std::array<double, StencilSpecT::num_stencil_points()>;
+
+  const double dt    = 0.05;
+  const double ncoef = 2.0 * NumDimensions;
+
+  auto heat = [dt, ncoef](double core, const Values_t& values) {
+    double sum = 0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      sum += values[i];
+    }
+    return core + dt * (sum - ncoef * core);
+  };
+
+  auto pattern = Bench_t::pattern(BLOCK_EXT);
+  matrix_t matrix(pattern);
+  std::fill(matrix.lbegin(), matrix.lend(), dash::myid() == 0 ? 1.0 : 0.0);
+
+  auto stencil_spec = Bench_t::stencil_spec();
+  HaloMatrixWrapperT halo(matrix, stencil_spec, dash::CycleSpec<NumDimensions>(),
+                          dash::HaloExchange::GET);
+  const auto & stencil_op = halo.stencil_operator();
+  const auto & view_inner = halo.view_inner_local();
+  size_t       updates    = view_inner.size() * ITERATIONS;
+
+  std::vector<double> buf_0(matrix.lbegin(), matrix.lend());
+  std::vector<double> buf_1(buf_0);
+
+  dash::barrier();
+
+  // iterator
+  auto ts_start = Timer::Now();
+  for (unsigned i = 0; i < ITERATIONS; ++i) {
+    auto it_iend = halo.iend();
+    for (auto it = halo.ibegin(); it != it_iend; ++it) {
+      Values_t values;
+      for (std::size_t s = 0; s < values.size(); ++s) {
+        values[s] = it.value_at(s);
+      }
+      buf_1[it.lpos()] = heat(*it, values);
+    }
+  }
+  print_result(NumDimensions, BLOCK_EXT, "iterator", updates,
+               Timer::ElapsedSince(ts_start));
+
+  // operator, sequential and parallel
+  ts_start = Timer::Now();
+  for (unsigned i = 0; i < ITERATIONS; ++i) {
+    stencil_op.apply(dash::execution::seq, buf_0.data(), buf_1.data(),
+                     view_inner, heat);
+    std::swap(buf_0, buf_1);
+  }
+  print_result(NumDimensions, BLOCK_EXT, "op.seq", updates,
+               Timer::ElapsedSince(ts_start));
+
+  ts_start = Timer::Now();
+  for (unsigned i = 0; i < ITERATIONS; ++i) {
+    stencil_op.apply(dash::execution::par, buf_0.data(), buf_1.data(),
+                     view_inner, heat);
+    std::swap(buf_0, buf_1);
+  }
+  print_result(NumDimensions, BLOCK_EXT, "op.par", updates,
+               Timer::ElapsedSince(ts_start));
+
+  // temporal blocking, regions shrink in every sweep
+  size_t tb_updates = 0;
+  auto   region     = view_inner;
+  for (std::size_t t = 0; t < SWEEPS; ++t) {
+    tb_updates += region.size();
+    for (dash::dim_t d = 0; d < NumDimensions; ++d) {
+      region.resize_dim(d, region.offset(d) + 1,
+                        region.extent(d) > 2 ? region.extent(d) - 2 : 0);
+    }
+  }
+  unsigned tb_iterations = std::max<unsigned>(1, ITERATIONS / SWEEPS);
+  ts_start = Timer::Now();
+  for (unsigned i = 0; i < tb_iterations; ++i) {
+    stencil_op.apply(dash::execution::seq, buf_0.data(), buf_1.data(),
+                     view_inner, SWEEPS, heat);
+  }
+  print_result(NumDimensions, BLOCK_EXT, "op.tb", tb_updates * tb_iterations,
+               Timer::ElapsedSince(ts_start));
+
+  dash::barrier();
+}
+
+void print_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << "units"
+         << ", "
+         << std::setw(5)  << "ndim"
+         << ", "
+         << std::setw(10) << "block.ext"
+         << ", "
+         << std::setw(10) << "method"
+         << ", "
+         << std::setw(12) << "MLUP/s"
+         << endl;
+  }
+}
+
+void print_result(
+  dash::dim_t              ndim,
+  size_t             block_ext,
+  const std::string& method,
+  size_t             updates,
+  double             usecs)
+{
+  if (dash::myid() == 0) {
+    cout << std::setw(10) << dash::size()
+         << ", "
+         << std::setw(5)  << ndim
+         << ", "
+         << std::setw(10) << block_ext
+         << ", "
+         << std::setw(10) << method
+         << ", "
+         << std::setw(12) << std::fixed << std::setprecision(2)
+         << updates / usecs
+         << endl;
+  }
+}
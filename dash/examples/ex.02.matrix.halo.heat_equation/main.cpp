@@ -90,8 +90,12 @@ int main(int argc, char *argv[])
 
   CycleSpecT cycle{Cycle::CYCLIC, Cycle::CYCLIC};
 
-  HaloMatrixWrapperT halomat(matrix, stencil_spec, cycle);
-  HaloMatrixWrapperT halomat2(matrix2, stencil_spec, cycle);
+  // All units update the halo regions in the same order, select the faster
+  // halo exchange method at runtime:
+  HaloMatrixWrapperT halomat(matrix, stencil_spec, cycle,
+                             dash::HaloExchange::AUTO);
+  HaloMatrixWrapperT halomat2(matrix2, stencil_spec, cycle,
+                              dash::HaloExchange::AUTO);
 
   HaloMatrixWrapperT* current_halo = &halomat;
   HaloMatrixWrapperT* new_halo = &halomat2;
@@ -105,65 +109,19 @@ int main(int argc, char *argv[])
   array_t energy(ranks);
   double initEnergy = calcEnergy(current_halo->matrix(), energy);
 
-  const auto &lview = halomat.view_local();
-  auto offset = lview.extent(1);
-  long inner_start = offset + 1;
-  long inner_end = lview.extent(0) * (offset - 1) - 1;
-
   current_halo->matrix().barrier();
 
-  for (auto d = 0; d < iterations; ++d) {
+  auto heat = [&](double core, const std::array<double, 4>& values) {
+    double dtheta = (values[0] + values[1] - 2 * core) / (dx * dx) +
+                    (values[2] + values[3] - 2 * core) / (dy * dy);
+    return core + k * dtheta * dt;
+  };
 
-    auto& current_matrix = current_halo->matrix();
-    auto& new_matrix = new_halo->matrix();
-
-    // Update Halos asynchroniously
-    current_halo->update_async();
-
-    // optimized calculation of inner matrix elements
-    auto* current_begin = current_matrix.lbegin();
-    auto* new_begin = new_matrix.lbegin();
-#if 0
-    for (auto i = inner_start; i < inner_end; i += offset) {
-      auto* center = current_begin + i;
-      auto* center_y_plus = center + offset;
-      auto* center_y_minus = center - offset;
-      for (auto j = 0; j < offset - 2;
-           ++j, ++center, ++center_y_plus, ++center_y_minus) {
-        /*auto dtheta =
-            (*(center - 1) + *(center + 1) - 2 * (*center)) / (dx * dx) +
-            (*(center_y_minus) + *(center_y_plus) - 2 * (*center)) / (dy * dy);
-        *(new_begin + i + j) = *center + k * dtheta * dt;*/
-        *(new_begin + i + j) = calc(center, center_y_minus, center_y_plus, center - 1, center + 1);
-      }
-    }
-#endif
-    // slow version
-    auto it_end = current_halo->iend();
-    for(auto it = current_halo->ibegin(); it != it_end; ++it)
-    {
-      auto core = *it;
-      auto dtheta = (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
-                    (it.value_at(2) + it.value_at(3) - 2 * core) /(dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
-
-    // Wait until all Halo updates ready
-    current_halo->wait();
-
-    // Calculation of boundary Halo elements
-    auto it_bend = current_halo->bend();
-    for (auto it = current_halo->bbegin(); it != it_bend; ++it) {
-      auto core = *it;
-      double dtheta =
-          (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
-          (it.value_at(2) + it.value_at(3) - 2 * core) / (dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
-
-    // swap current matrix and current halo matrix
-    std::swap(current_halo, new_halo);
-    current_matrix.barrier();
+  for (auto d = 0; d < iterations; ++d) {
+    // Updates halos, computes inner elements while halos are exchanged
+    // and boundary elements as their halos arrive, then swaps both halo
+    // matrices
+    dash::compute_overlapped(current_halo, new_halo, heat);
   }
   // final total energy
   double endEnergy = calcEnergy(current_halo->matrix(), energy);
@@ -182,6 +140,9 @@ int main(int argc, char *argv[])
     cout << "DiffEnergy=" << endEnergy - initEnergy << endl;
     cout << "Matrixspec: " << matrix_ext << " x " << matrix_ext << endl;
     cout << "Iterations: " << iterations << endl;
+    cout << "Halo exchange: "
+         << (halomat.exchange() == dash::HaloExchange::PUSH ? "push" : "get")
+         << endl;
     cout.flush();
   }
 
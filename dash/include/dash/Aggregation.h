@@ -0,0 +1,55 @@
+#ifndef DASH__AGGREGATION_H__INCLUDED
+#define DASH__AGGREGATION_H__INCLUDED
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/Exception.h>
+
+
+namespace dash {
+
+/**
+ * Scope guard enabling aggregation of small remote writes of the calling
+ * unit for its lifetime, see \c dart_aggregation_begin.
+ *
+ * Small assignments to remote elements and accumulates within the scope
+ * are buffered per target unit and transferred together. They complete
+ * at the latest in \c dash::barrier, a flush or at the end of the
+ * outermost scope.
+ * Scopes can be nested.
+ *
+ * \code
+ * dash::Array<int> arr(dash::size() * 1000);
+ * {
+ *   dash::AggregationScope aggregate;
+ *   for (auto i = 0; i < 1000; ++i) {
+ *     arr[(dash::myid() + 1) % dash::size() * 1000 + i] = i;
+ *   }
+ * } // all writes are complete
+ * \endcode
+ */
+class AggregationScope {
+private:
+  using self_t = AggregationScope;
+
+public:
+  AggregationScope()
+  {
+    DASH_ASSERT_RETURNS(dart_aggregation_begin(), DART_OK);
+  }
+
+  AggregationScope(const self_t & other)           = delete;
+  self_t & operator=(const self_t & other)         = delete;
+
+  /**
+   * Completes all buffered writes if this is the outermost scope.
+   */
+  ~AggregationScope()
+  {
+    dart_aggregation_end();
+  }
+}; // class AggregationScope
+
+} // namespace dash
+
+#endif // DASH__AGGREGATION_H__INCLUDED
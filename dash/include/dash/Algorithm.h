@@ -16,14 +16,19 @@
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Reduce.h>
 #include <dash/algorithm/Accumulate.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Gather.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
 #include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/None_of.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Scan.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -0,0 +1,223 @@
+#ifndef DASH__COLLECTIVE_H__
+#define DASH__COLLECTIVE_H__
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+  /**
+   * Exchanges the number of values to send to every unit in the team for
+   * the number of values to receive from every unit.
+   */
+  inline
+  std::vector<size_t>
+  alltoall_counts(
+    const std::vector<size_t> & send_counts,
+    dash::Team                & team)
+  {
+    DASH_ASSERT_EQ(send_counts.size(), team.size(),
+                   "number of send counts differs from team size");
+    std::vector<size_t> recv_counts(team.size());
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(send_counts.data(), recv_counts.data(), 1,
+                    dash::dart_datatype<size_t>::value,
+                    team.dart_id()),
+      DART_OK);
+    return recv_counts;
+  }
+
+  /**
+   * Displacements of consecutive blocks of the given sizes, in units of
+   * the DART data type used to transfer values of type \c T.
+   */
+  template<typename T>
+  inline
+  std::vector<size_t>
+  alltoall_displs(
+    const std::vector<size_t> & counts)
+  {
+    dash::dart_storage<T> ds(1);
+    std::vector<size_t> displs(counts.size());
+    size_t displ = 0;
+    for (size_t u = 0; u < counts.size(); ++u) {
+      displs[u]  = displ;
+      displ     += counts[u] * ds.nelem;
+    }
+    return displs;
+  }
+
+} // namespace internal
+
+/**
+ * Personalized all-to-all exchange of \c nelem values with every unit in
+ * the team.
+ * Values at block \c i in \c send_values are sent to unit \c i, values
+ * received from unit \c i are stored at block \c i in \c recv_values.
+ * Blocks are exchanged in-place if \c send_values equals
+ * \c recv_values.
+ *
+ * Collective operation.
+ *
+ * \sa dart_alltoall
+ */
+template<typename T>
+void alltoall(
+  const T    * send_values,
+  T          * recv_values,
+  size_t       nelem,
+  dash::Team & team = dash::Team::All())
+{
+  DASH_LOG_TRACE("dash::alltoall()", "nelem:", nelem);
+  dash::dart_storage<T> ds(nelem);
+  DASH_ASSERT_RETURNS(
+    dart_alltoall(send_values, recv_values, ds.nelem, ds.dtype,
+                  team.dart_id()),
+    DART_OK);
+}
+
+/**
+ * Personalized all-to-all exchange of a distinct number of values with
+ * every unit in the team.
+ * The values to send to unit \c i are stored consecutively in
+ * \c send_values, following the values for units \c 0 to \c i-1.
+ * Received values are stored in the same layout in \c recv_values,
+ * their number per unit is returned in \c recv_counts.
+ *
+ * Collective operation, exchanges counts and values in two collective
+ * all-to-all steps.
+ *
+ * \sa dart_alltoallv
+ */
+template<typename T>
+void alltoallv(
+  const T                   * send_values,
+  const std::vector<size_t> & send_counts,
+  std::vector<T>            & recv_values,
+  std::vector<size_t>       & recv_counts,
+  dash::Team                & team = dash::Team::All())
+{
+  DASH_LOG_TRACE("dash::alltoallv()");
+  dash::dart_storage<T> ds(1);
+  recv_counts = dash::internal::alltoall_counts(send_counts, team);
+
+  auto send_displs = dash::internal::alltoall_displs<T>(send_counts);
+  auto recv_displs = dash::internal::alltoall_displs<T>(recv_counts);
+  std::vector<size_t> send_nelem(send_counts);
+  std::vector<size_t> recv_nelem(recv_counts);
+  size_t nrecv = 0;
+  for (size_t u = 0; u < team.size(); ++u) {
+    nrecv         += recv_counts[u];
+    send_nelem[u] *= ds.nelem;
+    recv_nelem[u] *= ds.nelem;
+  }
+  recv_values.resize(nrecv);
+  // Null send buffer denotes in-place exchange in DART, use any valid
+  // address if there are no values to send:
+  const void * send_buf = send_values;
+  if (send_buf == nullptr) {
+    send_buf = send_nelem.data();
+  }
+  DASH_ASSERT_RETURNS(
+    dart_alltoallv(send_buf, send_nelem.data(), send_displs.data(),
+                   recv_values.data(), recv_nelem.data(),
+                   recv_displs.data(), ds.dtype, team.dart_id()),
+    DART_OK);
+  DASH_LOG_TRACE("dash::alltoallv >", "received:", nrecv);
+}
+
+namespace internal {
+
+  /**
+   * Exchanges buckets of values with every unit in the team, received
+   * values are stored consecutively by source unit.
+   */
+  template<typename T>
+  void alltoall_buckets(
+    const std::vector<std::vector<T>> & send_buckets,
+    std::vector<T>                    & recv_values,
+    std::vector<size_t>               & recv_counts,
+    dash::Team                        & team)
+  {
+    DASH_ASSERT_EQ(send_buckets.size(), team.size(),
+                   "number of buckets differs from team size");
+    std::vector<size_t> send_counts(send_buckets.size());
+    size_t nsend = 0;
+    for (size_t u = 0; u < send_buckets.size(); ++u) {
+      send_counts[u]  = send_buckets[u].size();
+      nsend          += send_counts[u];
+    }
+    std::vector<T> send_values;
+    send_values.reserve(nsend);
+    for (const auto & bucket : send_buckets) {
+      send_values.insert(send_values.end(), bucket.begin(), bucket.end());
+    }
+    dash::alltoallv(send_values.data(), send_counts,
+                    recv_values, recv_counts, team);
+  }
+
+} // namespace internal
+
+/**
+ * Personalized all-to-all exchange of buckets, sends bucket \c i to
+ * unit \c i.
+ *
+ * Collective operation.
+ *
+ * \return  Buckets received from every unit, bucket \c i contains the
+ *          values received from unit \c i.
+ */
+template<typename T>
+std::vector<std::vector<T>> alltoall(
+  const std::vector<std::vector<T>> & send_buckets,
+  dash::Team                        & team = dash::Team::All())
+{
+  std::vector<T>      recv_values;
+  std::vector<size_t> recv_counts;
+  dash::internal::alltoall_buckets(
+    send_buckets, recv_values, recv_counts, team);
+  std::vector<std::vector<T>> recv_buckets(team.size());
+  auto recv_first = recv_values.begin();
+  for (size_t u = 0; u < team.size(); ++u) {
+    recv_buckets[u].assign(recv_first, recv_first + recv_counts[u]);
+    recv_first += recv_counts[u];
+  }
+  return recv_buckets;
+}
+
+/**
+ * Personalized all-to-all exchange of buckets, sends bucket \c i to
+ * unit \c i and replaces it by the bucket received from unit \c i.
+ * Allocated capacity of the buckets is reused.
+ *
+ * Collective operation.
+ */
+template<typename T>
+void alltoall_inplace(
+  std::vector<std::vector<T>> & buckets,
+  dash::Team                  & team = dash::Team::All())
+{
+  std::vector<T>      recv_values;
+  std::vector<size_t> recv_counts;
+  dash::internal::alltoall_buckets(
+    buckets, recv_values, recv_counts, team);
+  auto recv_first = recv_values.begin();
+  for (size_t u = 0; u < buckets.size(); ++u) {
+    buckets[u].assign(recv_first, recv_first + recv_counts[u]);
+    recv_first += recv_counts[u];
+  }
+}
+
+} // namespace dash
+
+#endif // DASH__COLLECTIVE_H__
@@ -0,0 +1,80 @@
+#ifndef DASH__EXECUTION_H__INCLUDED
+#define DASH__EXECUTION_H__INCLUDED
+
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Execution policies of the local phase of DASH algorithms, corresponding
+ * to the execution policies in namespace \c std::execution of C++17.
+ *
+ * Algorithms accept an execution policy as first argument:
+ *
+ * \code
+ *   dash::fill(dash::execution::par, array.begin(), array.end(), 0);
+ *   dash::for_each(dash::execution::seq, array.begin(), array.end(),
+ *                  [&](int v) { hist[v]++; });
+ * \endcode
+ *
+ * The policy only affects how every unit processes its local elements,
+ * the semantics of the algorithm across units are unchanged.
+ */
+namespace execution {
+
+/**
+ * Local elements are processed sequentially by the calling thread.
+ */
+class sequenced_policy { };
+
+/**
+ * Local elements are partitioned into contiguous chunks that are
+ * processed by the threads available to the unit, see
+ * \c dash::util::UnitLocality::num_domain_threads. Function objects
+ * passed to the algorithm are invoked concurrently.
+ * Threads are provided by the OpenMP runtime, equivalent to
+ * \c sequenced_policy if DASH is built without OpenMP.
+ */
+class parallel_policy { };
+
+/// Sequenced execution policy object
+constexpr sequenced_policy seq { };
+
+/// Parallel execution policy object
+constexpr parallel_policy  par { };
+
+} // namespace execution
+
+/**
+ * Type trait, whether \c T is an execution policy type.
+ */
+template <class T>
+struct is_execution_policy : std::false_type { };
+
+template <>
+struct is_execution_policy<dash::execution::sequenced_policy>
+: std::true_type { };
+
+template <>
+struct is_execution_policy<dash::execution::parallel_policy>
+: std::true_type { };
+
+namespace internal {
+
+/**
+ * Defined as \c T if \c ExecutionPolicy is an execution policy type,
+ * restricts algorithm overloads to execution policy arguments.
+ */
+template <class ExecutionPolicy, class T = void>
+using enable_if_execution_policy =
+  typename std::enable_if<
+    dash::is_execution_policy<
+      typename std::decay<ExecutionPolicy>::type >::value,
+    T >::type;
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__EXECUTION_H__INCLUDED
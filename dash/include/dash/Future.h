@@ -12,16 +12,26 @@
 
 namespace dash {
 
+/**
+ * Result of an asynchronous operation.
+ *
+ * The result is obtained from the function passed on construction which
+ * blocks until the operation completed.
+ * An optional test function allows to query for completion without
+ * blocking.
+ */
 template<typename ResultT>
 class Future
 {
 private:
   typedef Future<ResultT>               self_t;
   typedef std::function<ResultT (void)> func_t;
+  typedef std::function<bool (void)>    test_func_t;
 
 private:
-  func_t    _func;
-  ResultT   _value;
+  func_t      _func;
+  test_func_t _test_func;
+  ResultT     _value;
   bool      _ready     = false;
   bool      _has_func  = false;
 
@@ -44,9 +54,22 @@ public:
     _has_func(true)
   { }
 
+  /**
+   * Creates a future from a function that waits for completion and
+   * returns the result, and a function that tests for completion without
+   * blocking.
+   */
+  Future(const func_t & func, const test_func_t & test_func)
+  : _func(func),
+    _test_func(test_func),
+    _ready(false),
+    _has_func(true)
+  { }
+
   Future(
     const self_t & other)
   : _func(other._func),
+    _test_func(other._test_func),
     _value(other._value),
     _ready(other._ready),
     _has_func(other._has_func)
@@ -56,6 +79,7 @@ public:
   {
     if (this != &other) {
       _func      = other._func;
+      _test_func = other._test_func;
       _value     = other._value;
       _ready     = other._ready;
       _has_func  = other._has_func;
@@ -80,8 +104,16 @@ public:
     DASH_LOG_TRACE_VAR("Future.wait >", _ready);
   }
 
-  bool test() const
+  /**
+   * Tests for completion of the asynchronous operation without blocking.
+   *
+   * \return  true if the result is available
+   */
+  bool test()
   {
+    if (!_ready && _test_func && _test_func()) {
+      wait();
+    }
     return _ready;
   }
 
@@ -95,6 +127,78 @@ public:
 
 }; // class Future
 
+/**
+ * Completion of an asynchronous operation without result.
+ */
+template<>
+class Future<void>
+{
+private:
+  typedef Future<void>               self_t;
+  typedef std::function<void (void)> func_t;
+  typedef std::function<bool (void)> test_func_t;
+
+private:
+  func_t      _func;
+  test_func_t _test_func;
+  bool        _ready     = false;
+  bool        _has_func  = false;
+
+public:
+  Future()
+  : _ready(false),
+    _has_func(false)
+  { }
+
+  Future(const func_t & func)
+  : _func(func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  Future(const func_t & func, const test_func_t & test_func)
+  : _func(func),
+    _test_func(test_func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  Future(const self_t & other) = default;
+
+  Future<void> & operator=(const self_t & other) = default;
+
+  void wait()
+  {
+    DASH_LOG_TRACE_VAR("Future.wait()", _ready);
+    if (_ready) {
+      return;
+    }
+    if (!_has_func) {
+      DASH_LOG_ERROR("Future.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    _func();
+    _ready = true;
+    DASH_LOG_TRACE_VAR("Future.wait >", _ready);
+  }
+
+  bool test()
+  {
+    if (!_ready && _test_func && _test_func()) {
+      wait();
+    }
+    return _ready;
+  }
+
+  void get()
+  {
+    wait();
+  }
+
+}; // class Future<void>
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
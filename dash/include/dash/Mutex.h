@@ -72,6 +72,25 @@ public:
    * Release the lock acquired through \c lock() or \c try_lock().
    */
   void unlock();
+
+  /**
+   * Block until the lock was acquired in shared mode.
+   *
+   * \note This works properly with \c std::shared_lock (C++14)
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock in shared mode and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
   
 private:
   dart_lock_t   _mutex;
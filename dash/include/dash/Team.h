@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -467,6 +468,120 @@ public:
     }
   }
 
+  /**
+   * Non-blocking barrier, completed once all units in the team entered
+   * the barrier.
+   */
+  inline dash::Future<void> ibarrier() const
+  {
+    dart_handle_t handle = DART_HANDLE_NULL;
+    if (!is_null()) {
+      DASH_ASSERT_RETURNS(
+        dart_ibarrier(_dartid, &handle),
+        DART_OK);
+    }
+    return handle_future(handle);
+  }
+
+  /**
+   * Non-blocking broadcast of \c nelem values in \c buf from unit
+   * \c root to all units in the team.
+   * The buffer must not be accessed before the returned future completed.
+   */
+  template <typename ValueType>
+  dash::Future<void> ibcast(
+    ValueType   * buf,
+    size_t        nelem,
+    team_unit_t   root) const
+  {
+    dart_handle_t handle = DART_HANDLE_NULL;
+    dash::dart_storage<ValueType> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_ibcast(buf, ds.nelem, ds.dtype, root, _dartid, &handle),
+      DART_OK);
+    return handle_future(handle);
+  }
+
+  /**
+   * Non-blocking element-wise reduction of \c nelem values in
+   * \c send_buf of all units in the team to \c recv_buf at all units,
+   * using a reduce operation like \c dash::plus.
+   * The buffers must not be accessed before the returned future
+   * completed.
+   */
+  template <typename ValueType, class BinaryOperation>
+  dash::Future<void> iallreduce(
+    const ValueType * send_buf,
+    ValueType       * recv_buf,
+    size_t            nelem,
+    BinaryOperation   binary_op) const
+  {
+    dart_handle_t handle = DART_HANDLE_NULL;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(send_buf, recv_buf, nelem,
+                      dash::dart_datatype<ValueType>::value,
+                      binary_op.dart_operation(),
+                      _dartid, &handle),
+      DART_OK);
+    return handle_future(handle);
+  }
+
+  /**
+   * Non-blocking reduction of a single value of all units in the team,
+   * using a reduce operation like \c dash::plus.
+   *
+   * \return  Future providing the reduced value at all units
+   */
+  template <typename ValueType, class BinaryOperation>
+  dash::Future<ValueType> iallreduce(
+    const ValueType & value,
+    BinaryOperation   binary_op) const
+  {
+    // Buffers must remain valid until completion, also if the future is
+    // copied:
+    auto buf    = std::make_shared<std::pair<ValueType, ValueType>>(
+                    value, value);
+    auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&buf->first, &buf->second, 1,
+                      dash::dart_datatype<ValueType>::value,
+                      binary_op.dart_operation(),
+                      _dartid, handle.get()),
+      DART_OK);
+    return dash::Future<ValueType>(
+      [buf, handle]() {
+        DASH_ASSERT_RETURNS(dart_wait_local(handle.get()), DART_OK);
+        return buf->second;
+      },
+      [handle]() {
+        int32_t flag = 0;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(handle.get(), &flag), DART_OK);
+        return flag != 0;
+      });
+  }
+
+  /**
+   * Non-blocking gather of \c nelem values in \c send_buf of every unit
+   * to \c recv_buf at all units, ordered by unit id.
+   * The buffers must not be accessed before the returned future
+   * completed.
+   */
+  template <typename ValueType>
+  dash::Future<void> iallgather(
+    const ValueType * send_buf,
+    ValueType       * recv_buf,
+    size_t            nelem) const
+  {
+    dart_handle_t handle = DART_HANDLE_NULL;
+    dash::dart_storage<ValueType> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_iallgather(send_buf, recv_buf, ds.nelem, ds.dtype,
+                      _dartid, &handle),
+      DART_OK);
+    return handle_future(handle);
+  }
+
   inline team_unit_t myid() const
   {
     if (_myid == -1 && dash::is_initialized() && _dartid != DART_TEAM_NULL) {
@@ -584,6 +699,24 @@ private:
     }
   }
 
+  /**
+   * Future completing the non-blocking operation of the given handle.
+   */
+  static dash::Future<void> handle_future(dart_handle_t dart_handle)
+  {
+    auto handle = std::make_shared<dart_handle_t>(dart_handle);
+    return dash::Future<void>(
+      [handle]() {
+        DASH_ASSERT_RETURNS(dart_wait_local(handle.get()), DART_OK);
+      },
+      [handle]() {
+        int32_t flag = 0;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(handle.get(), &flag), DART_OK);
+        return flag != 0;
+      });
+  }
+
 private:
 
   dart_team_t             _dartid;
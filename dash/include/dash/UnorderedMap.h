@@ -104,6 +104,7 @@ namespace dash {
  * <b>Modifiers</b>             | &nbsp;              | &nbsp;
  * <tt>emplace</tt>             | <tt>iterator</tt>   | Construct and insert element at given position
  * <tt>insert</tt>              | <tt>iterator</tt>   | Insert elements before given position
+ * <tt>bulk_insert</tt>         | <tt>size_type</tt>  | Collectively insert elements in range at their target units
  * <tt>erase</tt>               | <tt>iterator</tt>   | Erase elements at position or in range
  * <tt>swap</tt>                | <tt>void</tt>       | Swap content
  * <tt>clear</tt>               | <tt>void</tt>       | Clear the map's content
@@ -495,6 +496,14 @@ public:
    * The mapped value can also be accessed directly by using member functions
    * \c at or \c operator[].
    *
+   * Keys are resolved in the hash index of the unit mapped to the key by
+   * the hash function, requiring a constant number of one-sided
+   * operations. Elements inserted by other units are moved to that unit
+   * and visible after the next commit (\c barrier).
+   *
+   * For the default hash function \c dash::HashLocal, elements remain at
+   * the inserting unit and the hash indices of all P units are probed.
+   *
    * \return  iterator to element with specified key if found, otherwise
    *          iterator to the element past the end of the container.
    *
@@ -536,6 +545,11 @@ public:
    *   operation would increase above its capacity threshold.
    * - References to elements in the map container remain valid in all cases,
    *   even after a rehash.
+   * - Elements with a key mapped to another unit by the hash function are
+   *   stored at the calling unit until the next commit (\c barrier) moves
+   *   them to that unit. Iterators and references to these elements are
+   *   invalidated by the commit. Elements with equivalent keys inserted by
+   *   different units before the commit are merged into a single element.
    *
    * \see     \c operator[]
    *
@@ -1,11 +1,12 @@
 #ifndef DASH__ALGORITHM__ACCUMULATE_H__
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
-#include <dash/Array.h>
 #include <dash/iterator/GlobIter.h>
 
-#include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <dash/Execution.h>
 
 
 namespace dash {
@@ -14,6 +15,8 @@ namespace dash {
  * Accumulate values in range \c [first, last) as the sum of all values
  * in the range.
  *
+ * Collective operation, the result is returned at all units.
+ *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
  *
@@ -21,6 +24,7 @@ namespace dash {
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \see      dash::reduce
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -33,34 +37,15 @@ ValueType accumulate(
   GlobInputIt     in_last,
   ValueType       init)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
-    }
-  }
-  return result;
+  return dash::reduce(in_first, in_last, init, dash::plus<ValueType>());
 }
 
 /**
  * Accumulate values in range \c [first, last) using the given binary
  * reduce function \c op.
  *
- * Collective operation.
+ * Collective operation, the result is returned at all units.
+ * The reduce operation must be associative and commutative.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -69,6 +54,7 @@ ValueType accumulate(
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \see      dash::reduce
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -83,27 +69,35 @@ ValueType accumulate(
   ValueType       init,
   BinaryOperation binary_op = dash::plus<ValueType>())
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
+  return dash::reduce(in_first, in_last, init, binary_op);
+}
 
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
-  }
-  return result;
+/**
+ * Accumulate values in range \c [first, last) using the given binary
+ * reduce function \c op, local elements are accumulated using the given
+ * execution policy.
+ *
+ * Collective operation, the result is returned at all units.
+ * The reduce operation must be associative and commutative.
+ *
+ * \see      dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  return dash::reduce(policy, in_first, in_last, init, binary_op);
 }
 
 } // namespace dash
@@ -4,9 +4,40 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
 
+#include <dash/Execution.h>
+
 
 namespace dash {
 
+/**
+ * Check whether all element in the range satisfy predicate \c p.
+ * Local elements are checked using the given execution policy.
+ *
+ * \returns \c true if all elements satisfy \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::find_if_not
+ * \see dash::any_of
+ * \ingroup DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+all_of(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return find_if_not(policy, first, last, p) == last;
+}
 
 /**
  * Check whether all element in the range satisfy predicate \c p.
@@ -21,14 +52,14 @@ namespace dash {
 template<
   typename ElementType,
   class    PatternType,
-  typename UnaryPredicate>
+  typename UnaryPredicate >
 bool all_of(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate applied to the elements in range [first, last)
-  UnaryPredicate p)
+  UnaryPredicate                       p)
 {
   return find_if_not(first, last, p) == last;
 }
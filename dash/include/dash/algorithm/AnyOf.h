@@ -4,9 +4,41 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
 
+#include <dash/Execution.h>
+
 
 namespace dash {
 
+/**
+ * Check whether any element in the range satisfies predicate \c p.
+ * Local elements are checked using the given execution policy.
+ *
+ * \returns \c true if at least one element satisfies \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::find_if_not
+ * \see dash::all_of
+ * \ingroup DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+any_of(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return find_if(policy, first, last, p) != last;
+}
+
 /**
  * Check whether any element in the range satisfies predicate \c p.
  *
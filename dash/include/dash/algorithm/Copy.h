@@ -9,6 +9,8 @@
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include <memory>
 #include <future>
@@ -1131,14 +1133,441 @@ copy_async(
 }
 #endif
 
+namespace internal {
+
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+/**
+ * Number of elements starting at global index \c gidx, at most
+ * \c max_len, that are mapped to a single unit and stored in consecutive
+ * local memory by the given pattern.
+ *
+ * \complexity  O(log n) for one-dimensional patterns, with \c n the
+ *              length of the contiguous run. O(d) for multi-dimensional
+ *              patterns, with runs limited to a single block along the
+ *              fastest dimension.
+ */
+template <class PatternType>
+typename PatternType::size_type copy_contiguous_run(
+  const PatternType                 & pattern,
+  typename PatternType::index_type    gidx,
+  typename PatternType::size_type     max_len)
+{
+  typedef typename PatternType::index_type index_t;
+  typedef typename PatternType::size_type  size_type;
+
+  auto lpos_first = pattern.local(gidx);
+  // Elements in [gidx, gidx + len) are contiguous if the last element is
+  // located at the same unit at local offset (len - 1):
+  auto is_contiguous = [&](size_type len) {
+    auto lpos_last = pattern.local(static_cast<index_t>(gidx + len - 1));
+    return lpos_last.unit  == lpos_first.unit &&
+           lpos_last.index == static_cast<index_t>(
+                                lpos_first.index + len - 1);
+  };
+  if (max_len <= 1) {
+    return max_len;
+  }
+  if (PatternType::ndim() > 1) {
+    // Candidate run is limited by the extent of the block in the fastest
+    // dimension and verified at its last element:
+    dim_t     d_fast = (PatternType::memory_order() == ROW_MAJOR)
+                       ? PatternType::ndim() - 1
+                       : 0;
+    auto      coords = pattern.coords(gidx);
+    size_type bsize  = pattern.blocksize(d_fast);
+    size_type len    = std::min<size_type>(
+                         max_len,
+                         std::min<size_type>(
+                           pattern.extent(d_fast) - coords[d_fast],
+                           bsize - (coords[d_fast] % bsize)));
+    return is_contiguous(len) ? len : 1;
+  }
+  // Local offsets in one-dimensional patterns are ascending with global
+  // index, contiguous run length is found by exponential search:
+  size_type len_lo = 1;
+  size_type len_hi = 2;
+  while (len_hi <= max_len && is_contiguous(len_hi)) {
+    len_lo  = len_hi;
+    len_hi *= 2;
+  }
+  len_hi = std::min<size_type>(len_hi, max_len + 1);
+  while (len_hi - len_lo > 1) {
+    size_type len_mid = len_lo + (len_hi - len_lo) / 2;
+    if (is_contiguous(len_mid)) {
+      len_lo = len_mid;
+    } else {
+      len_hi = len_mid;
+    }
+  }
+  return len_lo;
+}
+
+/**
+ * Number of elements starting at offset \c offset in a global range, at
+ * most \c max_len, with consecutive global indices.
+ * Global ranges of iterators without view are always linear, elements
+ * in view ranges are linear within a single row of the view.
+ */
+template <class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  std::size_t
+>::type
+copy_linear_run(
+  const GlobIterType &,
+  std::size_t,
+  std::size_t          max_len)
+{
+  return max_len;
+}
+
+template <class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  std::size_t
+>::type
+copy_linear_run(
+  const GlobIterType & first,
+  std::size_t          offset,
+  std::size_t          max_len)
+{
+  auto g_first   = (first + offset).gpos();
+  auto is_linear = [&](std::size_t len) {
+    return (first + (offset + len - 1)).gpos() == g_first + (len - 1);
+  };
+  // Global indices in view ranges are ascending:
+  std::size_t len_lo = 1;
+  std::size_t len_hi = 2;
+  while (len_hi <= max_len && is_linear(len_hi)) {
+    len_lo  = len_hi;
+    len_hi *= 2;
+  }
+  len_hi = std::min<std::size_t>(len_hi, max_len + 1);
+  while (len_hi - len_lo > 1) {
+    std::size_t len_mid = len_lo + (len_hi - len_lo) / 2;
+    if (is_linear(len_mid)) {
+      len_lo = len_mid;
+    } else {
+      len_hi = len_mid;
+    }
+  }
+  return (max_len == 0) ? 0 : len_lo;
+}
+
+/**
+ * Rectangular region in global cartesian element space that is iterated
+ * by a global range, elements in the region are ordered by the memory
+ * order of the pattern.
+ * The region of iterators without view is the pattern's element space.
+ */
+template <class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  dash::ViewSpec<
+    GlobIterType::pattern_type::ndim(),
+    typename GlobIterType::pattern_type::index_type>
+>::type
+copy_range_region(
+  const GlobIterType & it)
+{
+  typedef typename GlobIterType::pattern_type pattern_t;
+  return dash::ViewSpec<pattern_t::ndim(), typename pattern_t::index_type>(
+           it.pattern().memory_layout().extents());
+}
+
+template <class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  dash::ViewSpec<
+    GlobIterType::pattern_type::ndim(),
+    typename GlobIterType::pattern_type::index_type>
+>::type
+copy_range_region(
+  const GlobIterType & it)
+{
+  return it.viewspec();
+}
+
+/**
+ * Position of the iterator in the region returned by
+ * \c copy_range_region.
+ */
+template <class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  typename GlobIterType::index_type
+>::type
+copy_range_region_pos(
+  const GlobIterType & it)
+{
+  return it.pos();
+}
+
+template <class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  typename GlobIterType::index_type
+>::type
+copy_range_region_pos(
+  const GlobIterType & it)
+{
+  return it.rpos();
+}
+
+/**
+ * Copies a segment of elements from global memory to the local memory of
+ * the calling unit.
+ * Uses memcpy if the source segment is local, otherwise starts a
+ * non-blocking get operation.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt >
+void copy_segment_async(
+  GlobInputIt                  g_in_first,
+  ValueType                  * l_out_first,
+  std::size_t                  num_copy_elem,
+  std::vector<dart_gptr_t>   & req_handles)
+{
+  // MPI uses offset type int, do not copy more than INT_MAX bytes:
+  std::size_t max_copy_elem = (std::numeric_limits<int>::max() /
+                               sizeof(ValueType));
+  std::size_t num_elem_copied = 0;
+  while (num_elem_copied < num_copy_elem) {
+    std::size_t num_get_elem = std::min(max_copy_elem,
+                                        num_copy_elem - num_elem_copied);
+    auto src_gptr = (g_in_first + num_elem_copied).dart_gptr();
+    ValueType * l_in_first = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(src_gptr, reinterpret_cast<void **>(&l_in_first)),
+      DART_OK);
+    if (l_in_first != nullptr) {
+      // Source segment is local:
+      std::memcpy(l_out_first + num_elem_copied, l_in_first,
+                  num_get_elem * sizeof(ValueType));
+    } else {
+      dash::internal::get(src_gptr,
+                          l_out_first + num_elem_copied,
+                          num_get_elem);
+      // All segments are located in the same global memory segment of
+      // the input range and completed by a single flush:
+      if (req_handles.empty()) {
+        req_handles.push_back(src_gptr);
+      }
+    }
+    num_elem_copied += num_get_elem;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy
+ * operation.
+ *
+ * Redistributes elements between global ranges with arbitrary patterns.
+ * Collective operation on the team of the output range, every unit
+ * copies the elements of the output range located in its local memory.
+ * Contiguous segments in both patterns are resolved from their block
+ * mapping and transferred in bulk get operations, segments located at
+ * the calling unit are copied with memcpy. Segments at units on the same
+ * node are copied in shared memory if supported by the runtime.
+ *
+ * The input range must not be modified until all units completed the
+ * copy operation. The copied elements are visible to remote units after
+ * synchronization, e.g. a barrier on the output container.
+ *
+ * \returns  An instance of \c dash::Future providing the output range end
+ *           iterator on completion of the local part of the copy
+ *           operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  GlobOutputIt  out_first)
+{
+  typedef typename GlobOutputIt::pattern_type  out_pattern_t;
+  typedef typename GlobOutputIt::value_type    value_t;
+  typedef typename out_pattern_t::index_type   index_t;
+  typedef typename out_pattern_t::size_type    size_type;
+
+  DASH_LOG_TRACE("dash::copy_async()", "async, global to global");
+
+  size_type    num_elem_total = dash::distance(in_first, in_last);
+  GlobOutputIt out_last       = out_first + num_elem_total;
+  if (num_elem_total == 0) {
+    DASH_LOG_TRACE("dash::copy_async", "input range empty");
+    return dash::Future<GlobOutputIt>([=]() { return out_last; });
+  }
+  auto    g_in_first   = in_first.global();
+  auto  & in_pattern   = g_in_first.pattern();
+  auto  & out_pattern  = out_first.pattern();
+  index_t g_in_begin   = g_in_first.pos();
+  auto    myid         = out_pattern.team().myid();
+  value_t * l_out      = static_cast<value_t *>(out_first.globmem().lbegin());
+  DASH_LOG_TRACE("dash::copy_async",
+                 "g_in_begin:",  g_in_begin,
+                 "g_out_begin:", out_first.gpos(),
+                 "num_elem:",    num_elem_total);
+
+  std::vector<dart_gptr_t> req_handles;
+  // Copies the contiguous input segment at offset i in the range to the
+  // given local output index, returns the number of copied elements:
+  auto copy_run = [&](size_type i, size_type max_len, index_t l_out_idx) {
+    index_t   g_in = (in_first + i).gpos();
+    size_type len  = dash::internal::copy_contiguous_run(
+                       in_pattern, g_in,
+                       dash::internal::copy_linear_run(
+                         in_first, i, max_len));
+    dash::internal::copy_segment_async(
+      g_in_first + (g_in - g_in_begin),
+      l_out + l_out_idx,
+      len,
+      req_handles);
+    return len;
+  };
+  // Copies the local output segment at offset i in the range:
+  auto copy_out_run = [&](size_type i, size_type out_len,
+                          index_t l_out_idx) {
+    size_type copied = 0;
+    while (copied < out_len) {
+      copied += copy_run(i + copied, out_len - copied,
+                         l_out_idx + copied);
+    }
+  };
+  size_type num_elem_local = 0;
+  if (out_pattern_t::ndim() == 1) {
+    // Iterate local elements in the output range, global indices in
+    // one-dimensional ranges are consecutive:
+    index_t g_out_begin = out_first.gpos();
+    auto    l_idx_range = dash::internal::local_index_range_1d(
+                            out_pattern, g_out_begin,
+                            g_out_begin + num_elem_total);
+    index_t l_idx = l_idx_range.begin;
+    while (l_idx < l_idx_range.end) {
+      index_t   g_out   = out_pattern.global(l_idx);
+      size_type out_len = dash::internal::copy_contiguous_run(
+                            out_pattern, g_out,
+                            l_idx_range.end - l_idx);
+      copy_out_run(g_out - g_out_begin, out_len, l_idx);
+      l_idx          += out_len;
+      num_elem_local += out_len;
+    }
+  } else {
+    // Iterate rows in the fastest dimension of local blocks intersected
+    // with the output range:
+    constexpr dim_t ndim   = out_pattern_t::ndim();
+    constexpr dim_t d_fast = (out_pattern_t::memory_order() == ROW_MAJOR)
+                             ? ndim - 1
+                             : 0;
+    constexpr dim_t d_slow = ndim - 1 - d_fast;
+    auto    region   = dash::internal::copy_range_region(out_first);
+    index_t r_begin  = dash::internal::copy_range_region_pos(out_first);
+    index_t r_end    = r_begin + num_elem_total;
+    dash::CartesianIndexSpace<ndim, out_pattern_t::memory_order(), index_t>
+            r_space(region.extents());
+    auto    r_first  = r_space.coords(r_begin);
+    auto    r_last   = r_space.coords(r_end - 1);
+    auto    nlblocks = out_pattern.local_blockspec().size();
+    for (size_type lb = 0; lb < nlblocks; ++lb) {
+      auto block = out_pattern.local_block(lb);
+      // Bounds of the block in region coordinates, the range is limited
+      // to the rows of its first and last element in the slowest
+      // dimension:
+      std::array<index_t, ndim> lo;
+      std::array<index_t, ndim> hi;
+      bool empty = false;
+      for (dim_t d = 0; d < ndim; ++d) {
+        lo[d] = std::max<index_t>(block.offset(d), region.offset(d))
+                - region.offset(d);
+        hi[d] = std::min<index_t>(block.offset(d) + block.extent(d),
+                                  region.offset(d) + region.extent(d))
+                - region.offset(d);
+        if (d == d_slow) {
+          lo[d] = std::max<index_t>(lo[d], r_first[d]);
+          hi[d] = std::min<index_t>(hi[d], r_last[d] + 1);
+        }
+        empty = empty || lo[d] >= hi[d];
+      }
+      if (empty) {
+        continue;
+      }
+      auto row = lo;
+      while (true) {
+        index_t r_row     = r_space.at(row);
+        index_t seg_begin = std::max(r_row, r_begin);
+        index_t seg_end   = std::min(r_row + (hi[d_fast] - lo[d_fast]),
+                                     r_end);
+        if (seg_begin < seg_end) {
+          auto g_coords = r_space.coords(seg_begin);
+          for (dim_t d = 0; d < ndim; ++d) {
+            g_coords[d] += region.offset(d);
+          }
+          index_t g_out = out_pattern.memory_layout().at(g_coords);
+          index_t i     = seg_begin - r_begin;
+          while (i < seg_end - r_begin) {
+            size_type out_len = dash::internal::copy_contiguous_run(
+                                  out_pattern, g_out,
+                                  seg_end - r_begin - i);
+            copy_out_run(i, out_len, out_pattern.local(g_out).index);
+            g_out          += out_len;
+            i              += out_len;
+            num_elem_local += out_len;
+          }
+        }
+        // Next row in memory order:
+        dim_t d = (d_fast == 0) ? 1 : ndim - 2;
+        while (true) {
+          if (++row[d] < hi[d]) {
+            break;
+          }
+          row[d] = lo[d];
+          if (d == d_slow) {
+            break;
+          }
+          d += (d_fast == 0) ? 1 : -1;
+        }
+        if (d == d_slow && row[d] == lo[d]) {
+          break;
+        }
+      }
+    }
+  }
+  DASH_LOG_TRACE("dash::copy_async", "local elements:", num_elem_local,
+                 "pending requests:", req_handles.size());
+  dash::Future<GlobOutputIt> result([=]() mutable {
+    // Wait for all get requests to complete:
+    for (auto gptr : req_handles) {
+      dart_flush_local_all(gptr);
+    }
+    DASH_LOG_TRACE("dash::copy_async [Future] >",
+                   "async requests completed");
+    return out_last;
+  });
+  DASH_LOG_TRACE("dash::copy_async >", "returning future");
+  return result;
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Collective operation on the team of the output range, redistributes
+ * elements between global ranges with arbitrary patterns.
+ *
+ * \see      dash::copy_async(GlobInputIt, GlobInputIt, GlobOutputIt)
+ *
  * \ingroup  DashAlgorithms
  */
 template <
-  typename ValueType,
   class GlobInputIt,
   class GlobOutputIt >
 GlobOutputIt copy(
@@ -1147,12 +1576,7 @@ GlobOutputIt copy(
   GlobOutputIt  out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
-
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+  return dash::copy_async(in_first, in_last, out_first).get();
 }
 
 #endif // DOXYGEN
@@ -1,59 +1,94 @@
 #ifndef DASH__ALGORITHM__EQUAL_H__
 #define DASH__ALGORITHM__EQUAL_H__
 
-#include <dash/Array.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <dash/Execution.h>
+
+#include <functional>
+
 namespace dash {
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise.
+ * The result is returned at all units.
+ *
+ * Every unit compares the elements in its local part of the range
+ * \c [first1, last1) using the given execution policy. Elements of the
+ * second range are accessed locally if both ranges have the same
+ * pattern and offset, and are read one by one otherwise.
  *
  * \ingroup     DashAlgorithms
  */
 template <
+  class    ExecutionPolicy,
   typename ElementType,
-  class    PatternType >
-bool equal(
+  class    PatternType,
+  class    BinaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+equal(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first_1,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last_1,
-  GlobIter<ElementType, PatternType>   first_2)
+  GlobIter<ElementType, PatternType>   first_2,
+  BinaryPredicate                      pred)
 {
   auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2);
-
-  dash::Array<bool> l_results(team.size(), team);
+  auto & pattern     = first_1.pattern();
+  // Global iterators to local index range:
+  auto index_range   = dash::local_index_range(first_1, last_1);
+  auto l_begin_index = index_range.begin;
+  auto l_end_index   = index_range.end;
+  int  l_result      = 1;
 
-  l_results.local[0] = l_result;
-  bool return_result = true;
-
-  // wait for all units to contribute their data
-  team.barrier();
-
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
+  if (l_begin_index != l_end_index) {
+    std::size_t nlocal  = l_end_index - l_begin_index;
+    auto g_begin_offset = pattern.global(l_begin_index) - first_1.pos();
+    auto l_first_1      = (first_1 + g_begin_offset).local();
+    if (first_2.pos() == first_1.pos() &&
+        first_2.pattern() == pattern) {
+      auto l_first_2 = (first_2 + g_begin_offset).local();
+      l_result = dash::internal::parallel_find(
+                   policy, nlocal,
+                   [&](std::size_t l) {
+                     return !pred(l_first_1[l], l_first_2[l]);
+                   }) == nlocal;
+    } else {
+      for (std::size_t l = 0; l < nlocal && l_result; ++l) {
+        auto g_offset = pattern.global(l_begin_index + l) - first_1.pos();
+        l_result = pred(l_first_1[l],
+                        static_cast<ElementType>(first_2[g_offset]));
+      }
     }
   }
-  return return_result;
+
+  int g_result;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_result,
+      &g_result,
+      1,
+      DART_TYPE_INT,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  return g_result != 0;
 }
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
  * \c [first2, first2 + (last1 - first1)) with respect to a specified
  * predicate, and false otherwise.
+ * The result is returned at all units.
  *
  * \ingroup     DashAlgorithms
  */
@@ -69,29 +104,58 @@ bool equal(
   GlobIter<ElementType, PatternType>   first_2,
   BinaryPredicate                      pred)
 {
-  auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2, pred);
-
-  dash::Array<bool> l_results(team.size(), team);
-
-  l_results.local[0] = l_result;
-
-  bool return_result = true;
+  return dash::equal(
+           dash::execution::sequenced_policy(),
+           first_1, last_1, first_2, pred);
+}
 
-  team.barrier();
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ * The result is returned at all units.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+equal(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first_1,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last_1,
+  GlobIter<ElementType, PatternType>   first_2)
+{
+  return dash::equal(
+           policy, first_1, last_1, first_2,
+           std::equal_to<ElementType>());
+}
 
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
-    }
-  }
-  return return_result;
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ * The result is returned at all units.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+bool equal(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first_1,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last_1,
+  GlobIter<ElementType, PatternType>   first_2)
+{
+  return dash::equal(
+           dash::execution::parallel_policy(),
+           first_1, last_1, first_2,
+           std::equal_to<ElementType>());
 }
 
 } // namespace dash
@@ -1,31 +1,47 @@
 #ifndef DASH__ALGORITHM__FIND_H__
 #define DASH__ALGORITHM__FIND_H__
 
-#include <dash/Array.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <dash/Execution.h>
+
+#include <limits>
+
 namespace dash {
 
 /**
  * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
+ * satisfies the predicate \c p.
  * If no such element is found, the function returns \c last.
+ * Local elements are searched using the given execution policy, with
+ * \c dash::execution::par the predicate is invoked concurrently.
+ *
+ * \see dash::find
+ * \see dash::find_if_not
  *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
-  class    PatternType>
-GlobIter<ElementType, PatternType> find(
+  class    PatternType,
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find_if(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
-  /// Value which will be assigned to the elements in range [first, last)
-  const ElementType                  & value)
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate                       predicate)
 {
   using p_index_t = typename PatternType::index_type;
 
@@ -39,12 +55,9 @@ GlobIter<ElementType, PatternType> find(
   auto index_range   = dash::local_index_range(first, last);
   auto l_begin_index = index_range.begin;
   auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
   if(l_begin_index == l_end_index){
     g_index = std::numeric_limits<p_index_t>::max();
   } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
     // Pointer to first element in local memory:
     const ElementType * lbegin        = first.globmem().lbegin();
     // Pointers to first / final element in local range:
@@ -53,7 +66,12 @@ GlobIter<ElementType, PatternType> find(
 
     DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
 
-    auto l_result = std::find(l_range_begin, l_range_end, value);
+    auto l_result = l_range_begin +
+                    dash::internal::parallel_find(
+                      policy, l_range_end - l_range_begin,
+                      [&](std::size_t i) {
+                        return predicate(l_range_begin[i]);
+                      });
     if(l_result == l_range_end){
       DASH_LOG_DEBUG("Not found in local range");
       g_index = std::numeric_limits<p_index_t>::max();
@@ -62,9 +80,7 @@ GlobIter<ElementType, PatternType> find(
       g_index = pattern.global(l_hit_index);
     }
   }
-  team.barrier();
-
-  // receive buffer for global maximal index
+  // receive buffer for global minimal index
   p_index_t g_hit_idx;
 
   DASH_ASSERT_RETURNS(
@@ -80,7 +96,7 @@ GlobIter<ElementType, PatternType> find(
   if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
     DASH_LOG_DEBUG("element not found");
   } else {
-    return first + g_hit_idx;
+    return first + (g_hit_idx - first.pos());
   }
   return last;
 }
@@ -89,6 +105,7 @@ GlobIter<ElementType, PatternType> find(
  * Returns an iterator to the first element in the range \c [first,last) that
  * satisfies the predicate \c p.
  * If no such element is found, the function returns \c last.
+ * Local elements are searched sequentially, see \c dash::execution::seq.
  *
  * \see dash::find
  * \see dash::find_if_not
@@ -107,43 +124,42 @@ GlobIter<ElementType, PatternType> find_if(
   /// Predicate which will be applied to the elements in range [first, last)
   UnaryPredicate                       predicate)
 {
-  typedef typename PatternType::index_type index_t;
-
-  auto & team        = first.pattern().team();
-  auto myid          = team.myid();
-  /// Global iterators to local range:
-  auto index_range   = dash::local_range(first, last);
-  auto l_first       = index_range.begin;
-  auto l_last        = index_range.end;
-
-  auto l_result      = std::find_if(l_first, l_last, predicate);
-  auto l_offset      = std::distance(l_first, l_result);
-  if (l_result == l_last) {
-    l_offset = -1;
-  }
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  auto result = last;
-
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern()
-                           .global_index(
-                              u,
-                              { l_results[u] });
-      result = first + g_offset - first.pos();
-      break;
-    }
-  }
+  return dash::find_if(
+           dash::execution::sequenced_policy(), first, last, predicate);
+}
 
-  team.barrier();
-  return result;
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * does not satisfy the predicate \c p.
+ * If no such element is found, the function returns \c last.
+ * Local elements are searched using the given execution policy.
+ *
+ * \see dash::find
+ * \see dash::find_if
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate>
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find_if_not(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate                       predicate)
+{
+  return dash::find_if(
+           policy, first, last,
+           [&](const ElementType & value) { return !predicate(value); });
 }
 
 /**
@@ -152,23 +168,75 @@ GlobIter<ElementType, PatternType> find_if(
  * If no such element is found, the function returns \c last.
  *
  * \see dash::find
- * \see dash::find_if_not
+ * \see dash::find_if
  *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
   class    PatternType,
-	class    UnaryPredicate>
+  class    UnaryPredicate>
 GlobIter<ElementType, PatternType> find_if_not(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate which will be applied to the elements in range [first, last)
-	UnaryPredicate                       predicate)
+  UnaryPredicate                       predicate)
+{
+  return dash::find_if_not(
+           dash::execution::sequenced_policy(), first, last, predicate);
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ * Local elements are searched using the given execution policy.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType>
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
+{
+  return dash::find_if(
+           policy, first, last,
+           [&](const ElementType & element) { return element == value; });
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType>
+GlobIter<ElementType, PatternType> find(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
 {
-  return find_if(first, last, std::not1(predicate));
+  return dash::find(dash::execution::parallel_policy(), first, last, value);
 }
 
 } // namespace dash
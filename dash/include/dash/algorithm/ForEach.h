@@ -3,6 +3,9 @@
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/Execution.h>
 
 #include <algorithm>
 
@@ -11,10 +14,8 @@ namespace dash {
 
 /**
  * Invoke a function on every element in a range distributed by a pattern.
- * This function has the same signature as \c std::for_each but
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
- * To support compiler optimization, this const version is provided
+ * function on its local elements only, using the given execution policy.
  *
  * \tparam      ElementType   Type of the elements in the sequence
  * \tparam      UnaryFunction Function to invoke for each element
@@ -29,10 +30,14 @@ namespace dash {
  * \ingroup     DashAlgorithms
  */
 template <
+  class    ExecutionPolicy,
   typename ElementType,
   class    PatternType,
   class    UnaryFunction >
-void for_each(
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+for_each(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
@@ -48,19 +53,59 @@ void for_each(
   if (lbegin_index != lend_index) {
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
+    auto first_offset = first.pos();
     // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
+    auto lrange_begin = (first + (pattern.global(lbegin_index) -
+                                  first_offset)).local();
+    dash::internal::parallel_for(
+      policy, lend_index - lbegin_index,
+      [&](std::size_t begin, std::size_t end) {
+        std::for_each(lrange_begin + begin, lrange_begin + end, func);
+      });
   }
   team.barrier();
 }
 
 /**
  * Invoke a function on every element in a range distributed by a pattern.
+ * This function has the same signature as \c std::for_each but
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only. The index passed to the function is
- * a global index.
+ * function on its local elements only.
+ * Local elements are processed sequentially, see
+ * \c dash::execution::seq.
+ *
+ * \tparam      ElementType   Type of the elements in the sequence
+ * \tparam      UnaryFunction Function to invoke for each element
+ *                            in the specified range with signature
+ *                            \c (void (const ElementType &)).
+ *                            Signature does not need to have \c (const &)
+ *                            but must be compatible to \c std::for_each.
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+void for_each(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func)
+{
+  dash::for_each(dash::execution::sequenced_policy(), first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only, using the given execution policy.
+ * The index passed to the function is a global index.
  *
  * \tparam      ElementType            Type of the elements in the sequence
  * \tparam      UnaryFunctionWithIndex Function to invoke for each element
@@ -76,10 +121,14 @@ void for_each(
  * \ingroup     DashAlgorithms
  */
 template <
+  class    ExecutionPolicy,
   typename ElementType,
   class    PatternType,
   class    UnaryFunctionWithIndex >
-void for_each_with_index(
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+for_each_with_index(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
@@ -96,18 +145,57 @@ void for_each_with_index(
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
     auto first_offset = first.pos();
+    auto lrange_begin = (first + (pattern.global(lbegin_index) -
+                                  first_offset)).local();
     // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex       = pattern.global(lindex);
-      auto element_it   = first + (gindex - first_offset);
-      func(*(element_it.local()), gindex);
-    }
+    dash::internal::parallel_for(
+      policy, lend_index - lbegin_index,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto l = begin; l != end; ++l) {
+          func(lrange_begin[l], pattern.global(lbegin_index + l));
+        }
+      });
   }
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only. The index passed to the function is
+ * a global index.
+ * Local elements are processed sequentially, see
+ * \c dash::execution::seq.
+ *
+ * \tparam      ElementType            Type of the elements in the sequence
+ * \tparam      UnaryFunctionWithIndex Function to invoke for each element
+ *                                     in the specified range with signature
+ *                                     \c void (const ElementType &, index_t)
+ *                                     Signature does not need to have
+ *                                     \c (const &) but must be compatible
+ *                                     to \c std::for_each.
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+void for_each_with_index(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunctionWithIndex                     func)
+{
+  dash::for_each_with_index(
+    dash::execution::sequenced_policy(), first, last, func);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FOR_EACH_H__
@@ -0,0 +1,212 @@
+#ifndef DASH__ALGORITHM__GATHER_H__
+#define DASH__ALGORITHM__GATHER_H__
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+inline dart_ret_t vector_transfer_issue(
+  const dart_gptr_t  * gptrs,
+  void       * const * bufs,
+  const size_t       * nelem,
+  size_t               count,
+  dart_datatype_t      dtype)
+{
+  return dart_getv(bufs, gptrs, nelem, count, dtype);
+}
+
+inline dart_ret_t vector_transfer_issue(
+  const dart_gptr_t  * gptrs,
+  const void * const * bufs,
+  const size_t       * nelem,
+  size_t               count,
+  dart_datatype_t      dtype)
+{
+  return dart_putv(gptrs, bufs, nelem, count, dtype);
+}
+
+/**
+ * Transfers the elements at the global indices in \c [idx_first, idx_last)
+ * relative to \c first in one message per target unit. Elements are read
+ * into a mutable local range starting at \c local_first and written from
+ * a const local range.
+ */
+template <
+  class    GlobIterType,
+  class    IndexIt,
+  typename ValueType >
+void vector_transfer(
+  GlobIterType  first,
+  IndexIt       idx_first,
+  IndexIt       idx_last,
+  ValueType   * local_first)
+{
+  typedef typename std::remove_const<ValueType>::type value_t;
+  static_assert(
+    std::is_same<typename std::remove_const<
+                   typename GlobIterType::value_type>::type,
+                 value_t>::value,
+    "dash::gather/scatter: local and global value types differ");
+
+  auto count = std::distance(idx_first, idx_last);
+  if (count <= 0) {
+    return;
+  }
+  dash::dart_storage<value_t> ds(1);
+
+  typedef typename std::conditional<
+                    std::is_const<ValueType>::value,
+                    const void *, void *>::type buf_t;
+
+  std::vector<dart_gptr_t> gptrs;
+  std::vector<buf_t>       bufs;
+  gptrs.reserve(count);
+  bufs.reserve(count);
+  for (auto idx = idx_first; idx != idx_last; ++idx, ++local_first) {
+    gptrs.push_back((first + *idx).dart_gptr());
+    bufs.push_back(local_first);
+  }
+  // elements of non-basic types consist of several bytes
+  std::vector<size_t> nelem;
+  if (ds.nelem > 1) {
+    nelem.assign(count, ds.nelem);
+  }
+  const size_t * nelem_ptr = nelem.empty() ? nullptr : nelem.data();
+
+  DASH_ASSERT_RETURNS(
+    vector_transfer_issue(gptrs.data(), bufs.data(), nelem_ptr, count,
+                          ds.dtype),
+    DART_OK);
+}
+
+} // namespace internal
+
+/**
+ * Copies the elements at global indices \c [idx_first, idx_last) relative
+ * to \c first to the local range beginning at \c out_first.
+ *
+ * Elements owned by the same unit are transferred in a single message,
+ * which makes indirect accesses like sparse lookups considerably cheaper
+ * than reading elements one by one.
+ *
+ * Example:
+ *
+ * \code
+ *     std::vector<int> idx = { 17, 3, 1024, 5 };
+ *     std::vector<int> values(idx.size());
+ *     dash::gather(array.begin(), idx.begin(), idx.end(), values.data());
+ * \endcode
+ *
+ * \returns  The end of the output range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt,
+  typename ValueType >
+ValueType * gather(
+  /// Iterator the global indices refer to
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the first global index
+  IndexIt                            idx_first,
+  /// Iterator past the last global index
+  IndexIt                            idx_last,
+  /// Local destination of the elements
+  ValueType                        * out_first)
+{
+  dash::internal::vector_transfer(
+    first, idx_first, idx_last, out_first);
+  return out_first + std::distance(idx_first, idx_last);
+}
+
+/**
+ * Copies the elements of \c container at the global indices in range
+ * \c indices to the local range beginning at \c out_first.
+ *
+ * \see dash::gather
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ContainerType,
+  class    IndexRangeType,
+  typename ValueType >
+ValueType * gather(
+  ContainerType        & container,
+  const IndexRangeType & indices,
+  ValueType            * out_first)
+{
+  return dash::gather(
+           container.begin(), std::begin(indices), std::end(indices),
+           out_first);
+}
+
+/**
+ * Copies the elements in the local range beginning at \c in_first to the
+ * global indices \c [idx_first, idx_last) relative to \c first.
+ * The indices must be unique.
+ *
+ * Elements owned by the same unit are transferred in a single message.
+ *
+ * \returns  The end of the input range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt,
+  typename ValueType >
+const ValueType * scatter(
+  /// Iterator the global indices refer to
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the first global index
+  IndexIt                            idx_first,
+  /// Iterator past the last global index
+  IndexIt                            idx_last,
+  /// Local source of the elements
+  const ValueType                  * in_first)
+{
+  dash::internal::vector_transfer(
+    first, idx_first, idx_last, in_first);
+  return in_first + std::distance(idx_first, idx_last);
+}
+
+/**
+ * Copies the elements in the local range beginning at \c in_first to the
+ * elements of \c container at the global indices in range \c indices.
+ *
+ * \see dash::scatter
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ContainerType,
+  class    IndexRangeType,
+  typename ValueType >
+const ValueType * scatter(
+  ContainerType        & container,
+  const IndexRangeType & indices,
+  const ValueType      * in_first)
+{
+  return dash::scatter(
+           container.begin(), std::begin(indices), std::end(indices),
+           in_first);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__GATHER_H__
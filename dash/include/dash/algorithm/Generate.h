@@ -4,6 +4,9 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/Execution.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -17,7 +20,9 @@ namespace dash {
  * given function object g.
  *
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
+ * function on its local elements only, using the given execution policy.
+ * With a parallel policy, every thread invokes a copy of the function
+ * object.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
@@ -30,10 +35,14 @@ namespace dash {
  * \ingroup     DashAlgorithms
  */
 template <
+    class    ExecutionPolicy,
     typename ElementType,
     class    PatternType,
     class    UnaryFunction >
-void generate (
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+generate(
+  /// Execution policy of the local phase
+  ExecutionPolicy                 && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType> first,
   /// Iterator to the final position in the sequence
@@ -44,8 +53,47 @@ void generate (
   auto lrange = dash::local_range(first, last);
   auto lfirst = lrange.begin;
   auto llast  = lrange.end;
+  if (lfirst == nullptr) {
+    return;
+  }
+  dash::internal::parallel_for(
+    policy, llast - lfirst,
+    [&](std::size_t begin, std::size_t end) {
+      std::generate(lfirst + begin, lfirst + end, gen);
+    });
+}
 
-  std::generate(lfirst, llast, gen);
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g.
+ *
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * Local elements are processed sequentially, see
+ * \c dash::execution::seq.
+ *
+ * \tparam      ElementType    Type of the elements in the sequence
+ *                             invoke, deduced from parameter \c gen
+ * \tparam      UnaryFunction  Unary function with signature
+ *                             \c ElementType(void)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+void generate (
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  dash::generate(dash::execution::sequenced_policy(), first, last, gen);
 }
 
 /**
@@ -54,7 +102,7 @@ void generate (
  * a global index.
  *
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
+ * function on its local elements only, using the given execution policy.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
@@ -67,10 +115,14 @@ void generate (
  * \ingroup     DashAlgorithms
  */
 template <
+    class    ExecutionPolicy,
     typename ElementType,
     class    PatternType,
     class    UnaryFunction >
-void generate_with_index(
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+generate_with_index(
+  /// Execution policy of the local phase
+  ExecutionPolicy                 && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType> first,
   /// Iterator to the final position in the sequence
@@ -86,17 +138,54 @@ void generate_with_index(
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
     auto first_offset = first.pos();
+    auto lrange_begin = (first + (pattern.global(lbegin_index) -
+                                  first_offset)).local();
     // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex     = pattern.global(lindex);
-      auto element_it = first + (gindex - first_offset);
-      *element_it = gen(gindex);
-    }
+    dash::internal::parallel_for(
+      policy, lend_index - lbegin_index,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto l = begin; l != end; ++l) {
+          lrange_begin[l] = gen(pattern.global(lbegin_index + l));
+        }
+      });
   }
 }
 
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g. The index passed to the function is
+ * a global index.
+ *
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * Local elements are processed sequentially, see
+ * \c dash::execution::seq.
+ *
+ * \tparam      ElementType    Type of the elements in the sequence
+ *                             invoke, deduced from parameter \c gen
+ * \tparam      UnaryFunction  Unary function with signature
+ *                             \c ElementType(index_t)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+void generate_with_index(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  dash::generate_with_index(
+    dash::execution::sequenced_policy(), first, last, gen);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__GENERATE_H__
@@ -9,6 +9,8 @@
 
 #include <dash/internal/Logging.h>
 
+#include <limits>
+
 
 namespace dash {
 
@@ -371,6 +373,44 @@ local_range(
            lbegin + lend_index };
 }
 
+namespace internal {
+
+/**
+ * Resolves the local index range of elements in the global index range
+ * [gbegin, gend) in a one-dimensional pattern.
+ * Unlike \c dash::local_index_range, also valid for patterns in which
+ * the local elements of a unit are not contiguous in global index
+ * domain, like cyclic patterns.
+ *
+ * \complexity  O(log nl), with \c nl local elements in the pattern
+ */
+template <class PatternType>
+LocalIndexRange<typename PatternType::index_type>
+local_index_range_1d(
+  const PatternType                & pattern,
+  typename PatternType::index_type   gbegin,
+  typename PatternType::index_type   gend)
+{
+  typedef typename PatternType::index_type index_t;
+  // Global indices of local elements are ascending with local index:
+  auto lower_lidx = [&](index_t gidx) {
+    index_t lo = 0;
+    index_t hi = pattern.local_size();
+    while (lo < hi) {
+      index_t mid = lo + (hi - lo) / 2;
+      if (pattern.global(mid) < gidx) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  };
+  return LocalIndexRange<index_t> { lower_lidx(gbegin), lower_lidx(gend) };
+}
+
+} // namespace internal
+
 } // namespace dash
 
 #include <dash/algorithm/LocalRanges.h>
@@ -6,20 +6,19 @@
 #include <dash/Allocator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
-#include <dash/util/UnitLocality.h>
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/internal/Logging.h>
 
-#include <algorithm>
-#include <memory>
+#include <dash/Execution.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
+#include <functional>
 
 
 namespace dash {
@@ -27,7 +26,8 @@ namespace dash {
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, delegates to std::min_element on
+ * partitions of the range according to the execution policy.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
@@ -36,8 +36,58 @@ namespace dash {
  * \tparam      Compare      Binary comparison function with signature
  *                           \c bool (const TypeA &a, const TypeB &b)
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(nl), with \c nl local elements within the range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  const ElementType *>
+min_element(
+  /// Execution policy of the local phase
+  ExecutionPolicy    && policy,
+  /// Iterator to the initial position in the sequence
+  const ElementType *   l_range_begin,
+  /// Iterator to the final position in the sequence
+  const ElementType *   l_range_end,
+  /// Element comparison function, defaults to std::less
+  Compare               compare
+    = std::less<const ElementType &>())
+{
+  if (l_range_begin == l_range_end) {
+    return l_range_end;
+  }
+  // Partitions are combined in order, the first occurrence of the
+  // smallest value is preserved:
+  return dash::internal::parallel_reduce<const ElementType *>(
+           policy, l_range_end - l_range_begin,
+           [&](std::size_t begin, std::size_t end) {
+             return ::std::min_element(l_range_begin + begin,
+                                       l_range_begin + end,
+                                       compare);
+           },
+           [&](const ElementType * a, const ElementType * b) {
+             return compare(*b, *a) ? b : a;
+           });
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ * Specialization for local range, uses the parallel execution policy.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(nl), with \c nl local elements within the range
  *
  * \ingroup     DashAlgorithms
  */
@@ -53,87 +103,15 @@ const ElementType * min_element(
   Compare             compare
     = std::less<const ElementType &>())
 {
-#ifdef DASH_ENABLE_OPENMP
-  typedef typename std::decay<ElementType>::type      value_t;
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
-      }
-    }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
-  }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return dash::min_element(
+           dash::execution::parallel_policy(),
+           l_range_begin, l_range_end, compare);
 }
 
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
+ * Local elements are searched using the given execution policy.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
@@ -148,10 +126,16 @@ const ElementType * min_element(
  * \ingroup     DashAlgorithms
  */
 template <
+  class ExecutionPolicy,
   class ElementType,
   class PatternType,
   class Compare = std::less<const ElementType &> >
-GlobIter<ElementType, PatternType> min_element(
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+min_element(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
@@ -176,8 +160,6 @@ GlobIter<ElementType, PatternType> min_element(
 
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
   // Global position of end element in range:
   auto    gi_last            = last.gpos();
   // Find the local min. element in parallel
@@ -199,7 +181,7 @@ GlobIter<ElementType, PatternType> min_element(
     const ElementType * l_range_begin = lbegin + local_idx_range.begin;
     const ElementType * l_range_end   = lbegin + local_idx_range.end;
 
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
+    lmin = dash::min_element(policy, l_range_begin, l_range_end, compare);
 
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
@@ -211,20 +193,12 @@ GlobIter<ElementType, PatternType> min_element(
   }
   DASH_LOG_TRACE("dash::min_element",
                  "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
 
   typedef struct {
     value_t  value;
     index_t  g_index;
   } local_min_t;
 
-  std::vector<local_min_t> local_min_values(team.size());
-
   // Set global index of local minimum to -1 if no local minimum has been
   // found:
   local_min_t local_min;
@@ -235,54 +209,41 @@ GlobIter<ElementType, PatternType> min_element(
                       ? -1
                       : pattern.global(l_idx_lmin);
 
-  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
+  DASH_LOG_TRACE("dash::min_element", "local minimum: {",
                  "value:",   local_min.value,
                  "g.index:", local_min.g_index, "}");
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
+  // Reduce local minima of all units to the global minimum with the
+  // smallest global index in a single allreduce, ignoring units without
+  // local minimum:
+  auto min_op = [compare](const local_min_t & a,
+                          const local_min_t & b) -> local_min_t {
+                  if (a.g_index < 0) { return b; }
+                  if (b.g_index < 0) { return a; }
+                  if (compare(a.value, b.value)) { return a; }
+                  if (compare(b.value, a.value)) { return b; }
+                  return (a.g_index < b.g_index) ? a : b;
+                };
+  dash::DartOperation<local_min_t, decltype(min_op)> dart_min_op(min_op);
+
+  local_min_t global_min;
+  DASH_LOG_TRACE("dash::min_element", "dart_allreduce()");
+  trace.enter_state("allreduce");
   DASH_ASSERT_RETURNS(
-    dart_allgather(
+    dart_allreduce(
       &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
+      &global_min,
+      1,
+      dart_min_op.dart_datatype(),
+      dart_min_op.dart_operation(),
       team.dart_id()),
     DART_OK);
-  trace.exit_state("allgather");
-
-#ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
-#endif
-
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
+  trace.exit_state("allreduce");
 
-  auto gi_minimum    = gmin_elem_it->g_index;
+  auto gi_minimum    = global_min.g_index;
 
   DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
+                 "min. value:", global_min.value,
                  "global idx:", gi_minimum);
 
   DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
@@ -300,6 +261,79 @@ GlobIter<ElementType, PatternType> min_element(
   return minimum;
 }
 
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+GlobIter<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  return dash::min_element(
+           dash::execution::parallel_policy(), first, last, compare);
+}
+
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last).
+ * Local elements are searched using the given execution policy.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::greater<const ElementType &> >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+max_element(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::greater<const ElementType &>())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
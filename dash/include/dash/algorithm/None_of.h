@@ -2,29 +2,67 @@
 #define DASH__ALGORITHM__NONE_OF_H__
 
 #include <dash/iterator/GlobIter.h>
-#include <dash/algorithm/LocalRange.h>
-#include <dash/algorithm/Operation.h>
-#include <dash/dart/if/dart_communication.h>
-#include <dash/algorithm/Find_if.h>
+#include <dash/algorithm/Find.h>
+
+#include <dash/Execution.h>
+
 
 namespace dash {
 
 /**
- * \ingroup     DashAlgorithms
+ * Check whether no element in the range satisfies predicate \c p.
+ * Local elements are checked using the given execution policy.
+ *
+ * \returns \c true if no element satisfies \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::any_of
+ * \see dash::all_of
+ * \ingroup DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, bool>
+none_of(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  return find_if(policy, first, last, p) == last;
+}
+
+/**
+ * Check whether no element in the range satisfies predicate \c p.
+ *
+ * \returns \c true if no element satisfies \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::any_of
+ * \see dash::all_of
+ * \ingroup DashAlgorithms
  */
 template<
-    typename ElementType,
-    class PatternType>
-GlobIter<ElementType, PatternType> any_of(
-    /// Iterator to the initial position in the sequence
-    GlobIter<ElementType, PatternType>   first,
-    /// Iterator to the final position in the sequence
-    GlobIter<ElementType, PatternType>   last,
-    /// Predicate applied to the elements in range [first, last)
-    UnaryPredicate p)
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+bool none_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
 {
-    
-    return find_if(first, last, p) == last;
+  return find_if(first, last, p) == last;
+}
 
 } // namespace dash
 
@@ -3,10 +3,13 @@
 
 #include <dash/Types.h>
 #include <dash/Meta.h>
+#include <dash/Exception.h>
 
 #include <dash/dart/if/dart_types.h>
 
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 
 /**
@@ -36,14 +39,145 @@ public:
   typedef ValueType value_type;
 
 public:
-  constexpr typename std::enable_if< enabled, dart_operation_t >::type
+  template <bool E = enabled>
+  constexpr typename std::enable_if< E, dart_operation_t >::type
   dart_operation() const {
     return _op;
   }
 };
 
+/**
+ * Whether the reduce operation type provides a predefined DART operation.
+ */
+template <class BinaryOperation, class = void>
+struct has_dart_operation : std::false_type { };
+
+template <class BinaryOperation>
+struct has_dart_operation<
+  BinaryOperation,
+  decltype((void)std::declval<const BinaryOperation &>().dart_operation())>
+: std::true_type { };
+
 } // namespace internal
 
+/**
+ * Provides a reduce operation on values of type \c ValueType as DART
+ * operation and data type for use in collective reductions like
+ * \c dart_allreduce.
+ *
+ * Predefined reduce operations on arithmetic types are mapped to the
+ * corresponding DART operation. Any other binary operation is registered
+ * as user-defined DART operation for the lifetime of the instance, values
+ * of non-arithmetic types are transferred as contiguous DART type of
+ * \c sizeof(ValueType) bytes.
+ *
+ * Example:
+ *
+ * \code
+ *   auto abs_max = [](int a, int b) { return std::abs(a) > std::abs(b)
+ *                                            ? a : b; };
+ *   dash::DartOperation<int, decltype(abs_max)> op(abs_max);
+ *   dart_allreduce(&l_value, &g_value, 1, op.dart_datatype(),
+ *                  op.dart_operation(), team.dart_id());
+ * \endcode
+ *
+ * \ingroup  DashReduceOperations
+ */
+template <
+  typename ValueType,
+  class    BinaryOperation,
+  bool     predefined =
+             internal::has_dart_operation<BinaryOperation>::value &&
+             dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >
+class DartOperation;
+
+template <typename ValueType, class BinaryOperation>
+class DartOperation<ValueType, BinaryOperation, true> {
+public:
+  explicit DartOperation(
+    BinaryOperation binary_op,
+    bool            /* commute */ = true)
+  : _op(binary_op.dart_operation())
+  { }
+
+  dart_operation_t dart_operation() const {
+    return _op;
+  }
+
+  dart_datatype_t dart_datatype() const {
+    return dash::dart_datatype<ValueType>::value;
+  }
+
+private:
+  dart_operation_t _op;
+};
+
+template <typename ValueType, class BinaryOperation>
+class DartOperation<ValueType, BinaryOperation, false> {
+  static constexpr bool custom_type =
+    dash::dart_datatype<ValueType>::value == DART_TYPE_UNDEFINED;
+
+public:
+  /**
+   * Creates the DART operation, operands of operations that are not
+   * commutative are combined in ascending order of unit IDs.
+   */
+  explicit DartOperation(
+    BinaryOperation binary_op,
+    bool            commute = true)
+  : _binary_op(binary_op),
+    _dtype(dash::dart_datatype<ValueType>::value)
+  {
+    if (custom_type) {
+      DASH_ASSERT_RETURNS(
+        dart_type_create_custom(sizeof(ValueType), &_dtype),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_op_create(&DartOperation::apply, &_binary_op, commute, _dtype,
+                     &_op),
+      DART_OK);
+  }
+
+  ~DartOperation() {
+    dart_op_destroy(&_op);
+    if (custom_type) {
+      dart_type_destroy(&_dtype);
+    }
+  }
+
+  DartOperation(const DartOperation &)            = delete;
+  DartOperation & operator=(const DartOperation &) = delete;
+
+  dart_operation_t dart_operation() const {
+    return _op;
+  }
+
+  dart_datatype_t dart_datatype() const {
+    return _dtype;
+  }
+
+private:
+  static void apply(
+    const void * invec,
+    void       * inoutvec,
+    size_t       len,
+    void       * userdata)
+  {
+    BinaryOperation & binary_op = *static_cast<BinaryOperation *>(userdata);
+    const ValueType * in    = static_cast<const ValueType *>(invec);
+    ValueType       * inout = static_cast<ValueType *>(inoutvec);
+    for (size_t i = 0; i < len; ++i) {
+      inout[i] = binary_op(in[i], inout[i]);
+    }
+  }
+
+private:
+  BinaryOperation  _binary_op;
+  dart_datatype_t  _dtype;
+  dart_operation_t _op = DART_OP_UNDEFINED;
+};
+
 /**
  * Reduce operands to their minimum value.
  *
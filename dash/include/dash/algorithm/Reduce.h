@@ -0,0 +1,436 @@
+#ifndef DASH__ALGORITHM__REDUCE_H__
+#define DASH__ALGORITHM__REDUCE_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/Execution.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/// Number of independent partial results in local reductions, allows
+/// vectorization of the reduction loop.
+constexpr std::size_t ReduceLanes = 8;
+
+/// Minimum number of local elements per thread in parallel local
+/// reductions.
+constexpr std::size_t ReduceMinElementsPerThread = 16384;
+
+/**
+ * Identity element of a reduce operation, defined for reduce operations
+ * that correspond to a DART operation.
+ */
+template <class BinaryOperation, class ValueType>
+struct reduce_identity {
+  static constexpr bool defined = false;
+};
+
+template <class ValueType>
+struct reduce_identity<dash::plus<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::multiply<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(1); }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::min<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return std::numeric_limits<ValueType>::max(); }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::max<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() {
+    return std::numeric_limits<ValueType>::lowest();
+  }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::bit_and<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ~ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::bit_or<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_identity<dash::bit_xor<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+/**
+ * Reduces transformed values in a contiguous range, using independent
+ * partial results to allow vectorization.
+ * The range must not be empty.
+ */
+template <
+  class ValueType,
+  class InputType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce_chunk(
+  const InputType * first,
+  std::size_t       nelem,
+  BinaryOperation   binary_op,
+  UnaryOperation    unary_op)
+{
+  if (nelem < 2 * ReduceLanes) {
+    ValueType acc = unary_op(first[0]);
+    for (std::size_t i = 1; i < nelem; ++i) {
+      acc = binary_op(acc, unary_op(first[i]));
+    }
+    return acc;
+  }
+  ValueType lanes[ReduceLanes];
+  for (std::size_t l = 0; l < ReduceLanes; ++l) {
+    lanes[l] = unary_op(first[l]);
+  }
+  std::size_t i = ReduceLanes;
+  for (; i + ReduceLanes <= nelem; i += ReduceLanes) {
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+    #pragma omp simd
+#endif
+    for (std::size_t l = 0; l < ReduceLanes; ++l) {
+      lanes[l] = binary_op(lanes[l], unary_op(first[i + l]));
+    }
+  }
+  for (; i < nelem; ++i) {
+    lanes[0] = binary_op(lanes[0], unary_op(first[i]));
+  }
+  ValueType acc = lanes[0];
+  for (std::size_t l = 1; l < ReduceLanes; ++l) {
+    acc = binary_op(acc, lanes[l]);
+  }
+  return acc;
+}
+
+/**
+ * Reduces transformed values in a local range, partitions of the range
+ * are reduced according to the execution policy.
+ *
+ * \return  false if the local range is empty, otherwise true and the
+ *          reduced value in \c l_result.
+ */
+template <
+  class ExecutionPolicy,
+  class ValueType,
+  class InputType,
+  class BinaryOperation,
+  class UnaryOperation >
+bool transform_reduce_local(
+  const ExecutionPolicy & policy,
+  const InputType       * l_first,
+  const InputType       * l_last,
+  ValueType             & l_result,
+  BinaryOperation         binary_op,
+  UnaryOperation          unary_op)
+{
+  std::size_t nlocal = (l_first == nullptr) ? 0 : l_last - l_first;
+  if (nlocal == 0) {
+    return false;
+  }
+  l_result = dash::internal::parallel_reduce<ValueType>(
+               policy, nlocal,
+               [&](std::size_t begin, std::size_t end) {
+                 return transform_reduce_chunk<ValueType>(
+                          l_first + begin, end - begin,
+                          binary_op, unary_op);
+               },
+               binary_op,
+               ReduceMinElementsPerThread);
+  return true;
+}
+
+/**
+ * Combines local results of all units in a single \c dart_allreduce.
+ * Units with empty local range contribute the identity element of the
+ * reduce operation.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType reduce_global(
+  bool                    l_valid,
+  const ValueType       & l_result,
+  ValueType               init,
+  BinaryOperation         binary_op,
+  dash::Team            & team,
+  std::true_type          /* dart operation */)
+{
+  ValueType l_value = l_valid
+                      ? l_result
+                      : reduce_identity<BinaryOperation, ValueType>::value();
+  ValueType g_value;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_value, &g_value, 1,
+                   dash::dart_datatype<ValueType>::value,
+                   binary_op.dart_operation(),
+                   team.dart_id()),
+    DART_OK);
+  return binary_op(init, g_value);
+}
+
+/**
+ * Combines local results of all units for reduce operations that have no
+ * corresponding DART operation.
+ * The reduce operation is registered as user-defined DART operation on
+ * local results and their validity, local results are combined in a
+ * single \c dart_allreduce.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType reduce_global(
+  bool                    l_valid,
+  const ValueType       & l_result,
+  ValueType               init,
+  BinaryOperation         binary_op,
+  dash::Team            & team,
+  std::false_type         /* dart operation */)
+{
+  typedef struct {
+    ValueType value;
+    bool      valid;
+  } partial_t;
+
+  auto partial_op = [binary_op](const partial_t & lhs,
+                                const partial_t & rhs) -> partial_t {
+                      if (!lhs.valid) { return rhs; }
+                      if (!rhs.valid) { return lhs; }
+                      partial_t result;
+                      result.value = binary_op(lhs.value, rhs.value);
+                      result.valid = true;
+                      return result;
+                    };
+  dash::DartOperation<partial_t, decltype(partial_op)> dart_op(partial_op);
+
+  partial_t l_partial;
+  l_partial.valid = l_valid;
+  if (l_valid) {
+    l_partial.value = l_result;
+  }
+  partial_t g_partial;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_partial, &g_partial, 1,
+                   dart_op.dart_datatype(),
+                   dart_op.dart_operation(),
+                   team.dart_id()),
+    DART_OK);
+  return g_partial.valid ? binary_op(init, g_partial.value) : init;
+}
+
+template <class BinaryOperation, class ValueType>
+using reduce_has_dart_operation =
+  std::integral_constant<bool,
+    reduce_identity<BinaryOperation, ValueType>::defined &&
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >;
+
+} // namespace internal
+
+/**
+ * Reduces the transformed values in range \c [first, last) using the
+ * given binary reduce operation.
+ *
+ * Every unit reduces its local elements in the range, the local results
+ * are combined in a single collective operation. Reduce operations of
+ * type \c dash::plus, \c dash::multiply, \c dash::min, \c dash::max and
+ * bitwise operations on arithmetic value types are mapped to a
+ * predefined DART operation. Other operations are registered as
+ * user-defined DART operation, see \c dash::DartOperation. In both cases
+ * local results are combined in a single \c dart_allreduce.
+ * No global memory is allocated.
+ *
+ * The reduce operation must be associative and commutative as values are
+ * reduced in unspecified order.
+ *
+ * Collective operation, the result is returned at all units.
+ * Local elements are reduced using the given execution policy.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) t(in[0]) (+) t(in[1]) (+) ... (+) t(in[n])
+ *
+ * \tparam      ValueType        Type of the result and the initial value
+ * \tparam      BinaryOperation  Reduce operation with signature
+ *                               \c ValueType(ValueType, ValueType)
+ * \tparam      UnaryOperation   Transformation with signature
+ *                               \c ValueType(const ElementType &)
+ *
+ * \complexity  O(nl) + O(log p), with \c nl local elements within the
+ *              global range and \c p units in the team
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+transform_reduce(
+  /// Execution policy of the local phase
+  ExecutionPolicy && policy,
+  /// Iterator to the initial position in the sequence
+  GlobInputIt     in_first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt     in_last,
+  /// Initial value of the reduction
+  ValueType       init,
+  /// Reduce operation
+  BinaryOperation binary_op,
+  /// Transformation applied to every element
+  UnaryOperation  unary_op)
+{
+  auto & team     = in_first.team();
+  auto   l_range  = dash::local_range(in_first, in_last);
+  ValueType l_result;
+  bool      l_valid = dash::internal::transform_reduce_local(
+                        policy, l_range.begin, l_range.end, l_result,
+                        binary_op, unary_op);
+  return dash::internal::reduce_global(
+           l_valid, l_result, init, binary_op, team,
+           dash::internal::reduce_has_dart_operation<
+             BinaryOperation, ValueType>());
+}
+
+/**
+ * Reduces the transformed values in range \c [first, last) using the
+ * given binary reduce operation.
+ * Local elements are reduced using \c dash::execution::par.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt     in_first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt     in_last,
+  /// Initial value of the reduction
+  ValueType       init,
+  /// Reduce operation
+  BinaryOperation binary_op,
+  /// Transformation applied to every element
+  UnaryOperation  unary_op)
+{
+  return dash::transform_reduce(
+           dash::execution::parallel_policy(),
+           in_first, in_last, init, binary_op, unary_op);
+}
+
+/**
+ * Reduces the values in range \c [first, last) using the given binary
+ * reduce operation, defaults to the sum of all values.
+ * Local elements are reduced using the given execution policy.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+reduce(
+  /// Execution policy of the local phase
+  ExecutionPolicy && policy,
+  /// Iterator to the initial position in the sequence
+  GlobInputIt        in_first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt        in_last,
+  /// Initial value of the reduction
+  ValueType          init,
+  /// Reduce operation
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  typedef typename GlobInputIt::value_type element_t;
+  return dash::transform_reduce(
+           policy, in_first, in_last, init, binary_op,
+           [](const element_t & value) -> ValueType {
+             return static_cast<ValueType>(value);
+           });
+}
+
+/**
+ * Reduces the values in range \c [first, last) using the given binary
+ * reduce operation, defaults to the sum of all values.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+ValueType reduce(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt     in_first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt     in_last,
+  /// Initial value of the reduction
+  ValueType       init,
+  /// Reduce operation
+  BinaryOperation binary_op = BinaryOperation())
+{
+  return dash::reduce(
+           dash::execution::parallel_policy(),
+           in_first, in_last, init, binary_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDUCE_H__
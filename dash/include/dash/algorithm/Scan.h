@@ -0,0 +1,629 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/Execution.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/// Minimum number of local elements per thread in parallel local scans.
+constexpr std::size_t ScanMinElementsPerThread = 16384;
+
+/**
+ * Range of local elements that is also contiguous in the global index
+ * domain, unit of work in local scan passes.
+ */
+template <class ValueType>
+struct ScanSegment {
+  /// Local offset of the first element in the segment
+  std::size_t lbegin;
+  /// Local offset past the last element in the segment
+  std::size_t lend;
+  /// Index of the global block containing the segment
+  std::size_t gblock;
+  /// Reduction of all elements in the segment
+  ValueType   total;
+  /// Reduction of all elements preceding the segment in the global range
+  ValueType   prefix;
+  /// Whether any elements precede the segment in the global range
+  bool        has_prefix;
+};
+
+/**
+ * Reduction of the elements within a global block.
+ */
+template <class ValueType>
+struct ScanBlockTotal {
+  std::size_t gblock;
+  ValueType   value;
+};
+
+/**
+ * Reduction of the elements in a range that may be empty, combined in
+ * prefix reductions over units with user-defined DART operations.
+ */
+template <class ValueType>
+struct ScanPartial {
+  ValueType value;
+  bool      valid;
+};
+
+/**
+ * Splits the local index range \c [lbegin, lend) into segments that are
+ * contiguous in the global index domain, segments are further divided for
+ * processing according to the execution policy.
+ */
+template <
+  class ValueType,
+  class ExecutionPolicy,
+  class PatternType >
+std::vector<ScanSegment<ValueType>> scan_segments(
+  const ExecutionPolicy & policy,
+  const PatternType     & pattern,
+  std::size_t             lbegin,
+  std::size_t             lend)
+{
+  std::vector<ScanSegment<ValueType>> segments;
+  std::size_t nlocal    = lend - lbegin;
+  std::size_t blocksize = pattern.blocksize(0);
+  std::size_t n_threads = dash::internal::parallel_num_threads(
+                            policy, nlocal, ScanMinElementsPerThread);
+  std::size_t chunksize = std::max<std::size_t>(
+                            1, (nlocal + n_threads - 1) / n_threads);
+  for (std::size_t l = lbegin; l < lend; ) {
+    std::size_t block_end = std::min(lend, (l / blocksize + 1) * blocksize);
+    std::size_t gblock    = pattern.global(l) / blocksize;
+    for (; l < block_end; l = std::min(block_end, l + chunksize)) {
+      ScanSegment<ValueType> segment;
+      segment.lbegin     = l;
+      segment.lend       = std::min(block_end, l + chunksize);
+      segment.gblock     = gblock;
+      segment.has_prefix = false;
+      segments.push_back(segment);
+    }
+  }
+  return segments;
+}
+
+/**
+ * Inclusive scan of the elements in every segment, stores segment totals.
+ * Input and output range may be identical.
+ */
+template <
+  class ExecutionPolicy,
+  class InputType,
+  class ValueType,
+  class BinaryOperation >
+void scan_local(
+  const ExecutionPolicy               & policy,
+  const InputType                     * l_in,
+  ValueType                           * l_out,
+  std::vector<ScanSegment<ValueType>> & segments,
+  BinaryOperation                       binary_op)
+{
+  dash::internal::parallel_for(
+    policy, segments.size(),
+    [&](std::size_t s_begin, std::size_t s_end) {
+      for (std::size_t s = s_begin; s < s_end; ++s) {
+        auto & segment = segments[s];
+        ValueType acc  = l_in[segment.lbegin];
+        l_out[segment.lbegin] = acc;
+        for (std::size_t i = segment.lbegin + 1; i < segment.lend; ++i) {
+          acc      = binary_op(acc, static_cast<ValueType>(l_in[i]));
+          l_out[i] = acc;
+        }
+        segment.total = acc;
+      }
+    },
+    1);
+}
+
+/**
+ * Applies segment prefixes to inclusive local scans.
+ * For exclusive scans, values are shifted by one position in the same
+ * pass.
+ */
+template <
+  class ExecutionPolicy,
+  class ValueType,
+  class BinaryOperation >
+void scan_fixup(
+  const ExecutionPolicy                     & policy,
+  ValueType                                 * l_out,
+  const std::vector<ScanSegment<ValueType>> & segments,
+  bool                                        exclusive,
+  BinaryOperation                             binary_op)
+{
+  dash::internal::parallel_for(
+    policy, segments.size(),
+    [&](std::size_t s_begin, std::size_t s_end) {
+      for (std::size_t s = s_begin; s < s_end; ++s) {
+        auto & segment = segments[s];
+        if (exclusive) {
+          for (std::size_t i = segment.lend - 1; i > segment.lbegin; --i) {
+            l_out[i] = binary_op(segment.prefix, l_out[i-1]);
+          }
+          l_out[segment.lbegin] = segment.prefix;
+        } else if (segment.has_prefix) {
+          for (std::size_t i = segment.lbegin; i < segment.lend; ++i) {
+            l_out[i] = binary_op(segment.prefix, l_out[i]);
+          }
+        }
+      }
+    },
+    1);
+}
+
+/**
+ * Determines the prefix of the single local block with a single
+ * \c dart_exscan, for reduce operations with a corresponding DART
+ * operation if every unit holds at most one block and blocks are ordered
+ * by unit.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+void scan_block_prefix_exscan(
+  std::vector<ScanBlockTotal<ValueType>> & l_blocks,
+  std::vector<ValueType>                 & l_prefixes,
+  std::vector<char>                      & l_has_prefix,
+  BinaryOperation                          binary_op,
+  dash::Team                             & team)
+{
+  ValueType l_total = l_blocks.empty()
+                      ? reduce_identity<BinaryOperation, ValueType>::value()
+                      : l_blocks.front().value;
+  ValueType l_prefix;
+  DASH_ASSERT_RETURNS(
+    dart_exscan(&l_total, &l_prefix, 1,
+                dash::dart_datatype<ValueType>::value,
+                binary_op.dart_operation(),
+                team.dart_id()),
+    DART_OK);
+  if (!l_blocks.empty()) {
+    l_prefixes.assign(1, l_prefix);
+    l_has_prefix.assign(1, team.myid() > 0);
+  }
+}
+
+/**
+ * Determines the prefixes of all local blocks, blocks are assigned to
+ * units in round-robin order: global block \c b is the local block
+ * \c b / p of unit \c b % p in a team of \c p units.
+ *
+ * Totals of the local blocks in every round are combined over units in a
+ * single \c dart_exscan for the prefixes within the round and a single
+ * \c dart_allreduce for the totals of the rounds. Operands are block
+ * totals and their validity, the reduce operation is registered as
+ * user-defined DART operation that is not commutative. Prefixes of rounds
+ * are accumulated locally.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+void scan_block_prefix_rounds(
+  std::vector<ScanBlockTotal<ValueType>> & l_blocks,
+  std::size_t                              max_lblocks,
+  std::vector<ValueType>                 & l_prefixes,
+  std::vector<char>                      & l_has_prefix,
+  BinaryOperation                          binary_op,
+  dash::Team                             & team)
+{
+  typedef ScanPartial<ValueType> partial_t;
+
+  auto partial_op = [binary_op](const partial_t & lhs,
+                                const partial_t & rhs) -> partial_t {
+                      if (!lhs.valid) { return rhs; }
+                      if (!rhs.valid) { return lhs; }
+                      partial_t result;
+                      result.value = binary_op(lhs.value, rhs.value);
+                      result.valid = true;
+                      return result;
+                    };
+  dash::DartOperation<partial_t, decltype(partial_op)> dart_op(
+    partial_op, false);
+
+  std::size_t nunits = team.size();
+  partial_t   none;
+  none.valid = false;
+
+  std::vector<partial_t> l_totals(max_lblocks, none);
+  for (const auto & block : l_blocks) {
+    DASH_ASSERT_EQ(block.gblock % nunits, team.myid().id,
+                   "dash::*_scan: blocks not assigned in round-robin order");
+    auto & total = l_totals[block.gblock / nunits];
+    total.value  = block.value;
+    total.valid  = true;
+  }
+  std::vector<partial_t> r_prefixes(max_lblocks, none);
+  std::vector<partial_t> r_totals(max_lblocks, none);
+  DASH_ASSERT_RETURNS(
+    dart_exscan(l_totals.data(), r_prefixes.data(), max_lblocks,
+                dart_op.dart_datatype(), dart_op.dart_operation(),
+                team.dart_id()),
+    DART_OK);
+  // Totals of rounds are only required if units hold more than one block:
+  if (max_lblocks > 1) {
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(l_totals.data(), r_totals.data(), max_lblocks,
+                     dart_op.dart_datatype(), dart_op.dart_operation(),
+                     team.dart_id()),
+      DART_OK);
+  }
+  // Result of the exclusive prefix reduction is undefined at unit 0:
+  if (team.myid() == 0) {
+    r_prefixes.assign(max_lblocks, none);
+  }
+
+  l_prefixes.resize(l_blocks.size());
+  l_has_prefix.resize(l_blocks.size());
+  partial_t   acc = none;
+  std::size_t lb  = 0;
+  for (std::size_t r = 0; r < max_lblocks && lb < l_blocks.size(); ++r) {
+    if (l_blocks[lb].gblock / nunits == r) {
+      partial_t prefix = partial_op(acc, r_prefixes[r]);
+      l_prefixes[lb]   = prefix.value;
+      l_has_prefix[lb] = prefix.valid;
+      ++lb;
+    }
+    acc = partial_op(acc, r_totals[r]);
+  }
+}
+
+template <
+  class ValueType,
+  class BinaryOperation >
+void scan_block_prefix(
+  std::vector<ScanBlockTotal<ValueType>> & l_blocks,
+  std::size_t                              max_lblocks,
+  std::vector<ValueType>                 & l_prefixes,
+  std::vector<char>                      & l_has_prefix,
+  BinaryOperation                          binary_op,
+  dash::Team                             & team,
+  std::true_type                           /* dart operation */)
+{
+  if (max_lblocks <= 1) {
+    scan_block_prefix_exscan(
+      l_blocks, l_prefixes, l_has_prefix, binary_op, team);
+  } else {
+    scan_block_prefix_rounds(
+      l_blocks, max_lblocks, l_prefixes, l_has_prefix, binary_op, team);
+  }
+}
+
+template <
+  class ValueType,
+  class BinaryOperation >
+void scan_block_prefix(
+  std::vector<ScanBlockTotal<ValueType>> & l_blocks,
+  std::size_t                              max_lblocks,
+  std::vector<ValueType>                 & l_prefixes,
+  std::vector<char>                      & l_has_prefix,
+  BinaryOperation                          binary_op,
+  dash::Team                             & team,
+  std::false_type                          /* dart operation */)
+{
+  scan_block_prefix_rounds(
+    l_blocks, max_lblocks, l_prefixes, l_has_prefix, binary_op, team);
+}
+
+/**
+ * Distributed scan: local elements are scanned in segments according to
+ * the execution policy, the prefixes of local blocks are obtained from a
+ * prefix reduction of block totals over all units and applied to the
+ * local scans in a final pass.
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+GlobOutputIt scan(
+  const ExecutionPolicy            & policy,
+  GlobIter<ElementType, PatternType> in_first,
+  GlobIter<ElementType, PatternType> in_last,
+  GlobOutputIt                       out_first,
+  bool                               exclusive,
+  const ValueType                  & init,
+  BinaryOperation                    binary_op)
+{
+  typedef typename std::decay<ElementType>::type input_t;
+
+  static_assert(PatternType::ndim() == 1,
+                "dash::*_scan is only defined for one-dimensional patterns");
+  // Prefixes of blocks are combined in rounds of one block per unit, block
+  // sizes of minimal and dynamic partitionings differ between units:
+  typedef typename dash::pattern_partitioning_traits<PatternType>::type
+    partitioning_t;
+  static_assert(!partitioning_t::minimal && !partitioning_t::dynamic,
+                "dash::*_scan requires blocks of identical size assigned "
+                "to units in round-robin order");
+
+  auto & pattern = in_first.pattern();
+  auto & team    = pattern.team();
+  auto   out_last = out_first + (in_last - in_first);
+
+  if (!(out_first.pattern() == pattern) ||
+      out_first.pos() != in_first.pos()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::*_scan requires input and output range with identical " <<
+      "distribution");
+  }
+  if (in_first == in_last) {
+    return out_last;
+  }
+
+  auto l_idx_range = dash::internal::local_index_range_1d(
+                       pattern, in_first.pos(), in_last.pos());
+  const input_t * l_in  = static_cast<const input_t *>(
+                            in_first.globmem().lbegin());
+  ValueType     * l_out = static_cast<ValueType *>(
+                            out_first.globmem().lbegin());
+  DASH_LOG_DEBUG("dash::scan()", "local index range:",
+                 l_idx_range.begin, "-", l_idx_range.end);
+
+  auto segments = scan_segments<ValueType>(
+                    policy, pattern, l_idx_range.begin, l_idx_range.end);
+  scan_local(policy, l_in, l_out, segments, binary_op);
+
+  // Totals of local blocks, in global order:
+  std::vector<ScanBlockTotal<ValueType>> l_blocks;
+  for (const auto & segment : segments) {
+    if (!l_blocks.empty() && l_blocks.back().gblock == segment.gblock) {
+      l_blocks.back().value = binary_op(l_blocks.back().value,
+                                        segment.total);
+    } else {
+      ScanBlockTotal<ValueType> block;
+      block.gblock = segment.gblock;
+      block.value  = segment.total;
+      l_blocks.push_back(block);
+    }
+  }
+
+  // Blocks are assigned to units in round-robin order, a single exclusive
+  // prefix reduction over units is sufficient if every unit holds at most
+  // one block:
+  std::size_t blocksize   = pattern.blocksize(0);
+  std::size_t max_lblocks = (pattern.local_capacity() + blocksize - 1)
+                            / blocksize;
+
+  std::vector<ValueType> l_prefixes;
+  std::vector<char>      l_has_prefix;
+  scan_block_prefix(
+    l_blocks, max_lblocks, l_prefixes, l_has_prefix, binary_op, team,
+    reduce_has_dart_operation<BinaryOperation, ValueType>());
+
+  // Initial value precedes all elements in exclusive scans:
+  if (exclusive) {
+    for (std::size_t lb = 0; lb < l_blocks.size(); ++lb) {
+      l_prefixes[lb]   = l_has_prefix[lb]
+                         ? binary_op(init, l_prefixes[lb])
+                         : init;
+      l_has_prefix[lb] = true;
+    }
+  }
+
+  // Prefixes of segments from prefixes of their block and totals of
+  // preceding segments in the block:
+  std::size_t lb = 0;
+  for (std::size_t s = 0; s < segments.size(); ++s) {
+    auto & segment = segments[s];
+    if (s > 0 && segments[s-1].gblock == segment.gblock) {
+      auto & prev        = segments[s-1];
+      segment.prefix     = prev.has_prefix
+                           ? binary_op(prev.prefix, prev.total)
+                           : prev.total;
+      segment.has_prefix = true;
+    } else {
+      if (s > 0) {
+        ++lb;
+      }
+      segment.prefix     = l_prefixes[lb];
+      segment.has_prefix = l_has_prefix[lb];
+    }
+  }
+  scan_fixup(policy, l_out, segments, exclusive, binary_op);
+
+  team.barrier();
+  return out_last;
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the elements in range
+ * \c [first, last) using the given binary operation, defaults to the
+ * prefix sum.
+ *
+ * Local elements are scanned according to the execution policy, the
+ * prefixes of local blocks are obtained from a \c dart_exscan of the
+ * totals of local blocks over units and applied in a final local pass.
+ * Reduce operations without corresponding DART operation are registered
+ * as user-defined DART operation.
+ *
+ * The output range must have the same distribution as the input range,
+ * the scan is performed in-place if \c out_first equals \c in_first.
+ * Patterns must assign blocks of identical size to units in round-robin
+ * order, patterns with minimal or dynamic partitioning like
+ * \c dash::CSRPattern are rejected at compile time.
+ *
+ * Collective operation, the output range is visible to all units on
+ * return.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \tparam      ElementType      Type of the elements in the input range
+ * \tparam      GlobOutputIt     Global iterator on the output range,
+ *                               value type must be trivially copyable
+ * \tparam      BinaryOperation  Associative operation with signature
+ *                               \c ValueType(ValueType, ValueType)
+ *
+ * \complexity  O(nl) + O(log p), with \c nl local elements within the
+ *              global range and \c p units in the team
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class GlobOutputIt,
+  class BinaryOperation =
+          dash::plus<typename GlobOutputIt::value_type> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+inclusive_scan(
+  /// Execution policy of the local phases
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> in_first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> in_last,
+  /// Iterator to the initial position in the output sequence
+  GlobOutputIt                       out_first,
+  /// Reduce operation
+  BinaryOperation                    binary_op = BinaryOperation())
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  return dash::internal::scan(
+           policy, in_first, in_last, out_first, false, value_t(),
+           binary_op);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the elements in range
+ * \c [first, last) using the given binary operation, defaults to the
+ * prefix sum. Local phases use \c dash::execution::par.
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class GlobOutputIt,
+  class BinaryOperation =
+          dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> in_first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> in_last,
+  /// Iterator to the initial position in the output sequence
+  GlobOutputIt                       out_first,
+  /// Reduce operation
+  BinaryOperation                    binary_op = BinaryOperation())
+{
+  return dash::inclusive_scan(
+           dash::execution::parallel_policy(),
+           in_first, in_last, out_first, binary_op);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the elements in range
+ * \c [first, last) using the given binary operation and initial value,
+ * defaults to the prefix sum. Local elements are scanned according to
+ * the execution policy.
+ *
+ * The output range must have the same distribution as the input range,
+ * the scan is performed in-place if \c out_first equals \c in_first.
+ *
+ * Collective operation, the output range is visible to all units on
+ * return.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class GlobOutputIt,
+  class BinaryOperation =
+          dash::plus<typename GlobOutputIt::value_type> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+exclusive_scan(
+  /// Execution policy of the local phases
+  ExecutionPolicy                    && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>    in_first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>    in_last,
+  /// Iterator to the initial position in the output sequence
+  GlobOutputIt                          out_first,
+  /// Initial value of the prefix reduction
+  typename GlobOutputIt::value_type     init,
+  /// Reduce operation
+  BinaryOperation                       binary_op = BinaryOperation())
+{
+  return dash::internal::scan(
+           policy, in_first, in_last, out_first, true, init, binary_op);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the elements in range
+ * \c [first, last) using the given binary operation and initial value,
+ * defaults to the prefix sum. Local phases use \c dash::execution::par.
+ *
+ * \see         dash::exclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class GlobOutputIt,
+  class BinaryOperation =
+          dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt exclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>    in_first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>    in_last,
+  /// Iterator to the initial position in the output sequence
+  GlobOutputIt                          out_first,
+  /// Initial value of the prefix reduction
+  typename GlobOutputIt::value_type     init,
+  /// Reduce operation
+  BinaryOperation                       binary_op = BinaryOperation())
+{
+  return dash::exclusive_scan(
+           dash::execution::parallel_policy(),
+           in_first, in_last, out_first, init, binary_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -0,0 +1,471 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Collective.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/util/Trace.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/Execution.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/// Minimum number of local elements per thread in parallel local sort.
+constexpr std::size_t SortMinElementsPerThread = 4096;
+
+/**
+ * Merges consecutive sorted runs of values in place, the runs are
+ * delimited by the offsets in \c bounds.
+ * Pairs of runs are merged according to the execution policy.
+ */
+template <class ExecutionPolicy, class ValueType, class Compare>
+void sort_merge_runs(
+  const ExecutionPolicy    & policy,
+  ValueType                * values,
+  std::vector<std::size_t>   bounds,
+  Compare                    compare)
+{
+  while (bounds.size() > 2) {
+    std::size_t nruns  = bounds.size() - 1;
+    std::size_t npairs = nruns / 2;
+    dash::internal::parallel_for(
+      policy, npairs,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t p = begin; p < end; ++p) {
+          std::inplace_merge(values + bounds[2 * p],
+                             values + bounds[2 * p + 1],
+                             values + bounds[2 * p + 2],
+                             compare);
+        }
+      },
+      1);
+    std::vector<std::size_t> merged_bounds;
+    for (std::size_t r = 0; r < nruns; r += 2) {
+      merged_bounds.push_back(bounds[r]);
+    }
+    merged_bounds.push_back(bounds[nruns]);
+    bounds = std::move(merged_bounds);
+  }
+}
+
+/**
+ * Sorts values in a local range.
+ * Partitions of the range are sorted and merged according to the
+ * execution policy, a single partition is sorted by std::sort.
+ */
+template <class ExecutionPolicy, class ValueType, class Compare>
+void sort_local(
+  const ExecutionPolicy & policy,
+  ValueType             * l_range_begin,
+  ValueType             * l_range_end,
+  Compare                 compare)
+{
+  std::size_t nlocal    = l_range_end - l_range_begin;
+  std::size_t n_threads = dash::internal::parallel_num_threads(
+                            policy, nlocal, SortMinElementsPerThread);
+  DASH_LOG_DEBUG("dash::sort", "local sort threads:", n_threads);
+  if (n_threads > 1) {
+    std::vector<std::size_t> bounds(n_threads + 1);
+    dash::internal::parallel_chunks(
+      n_threads, nlocal,
+      [&](std::size_t t, std::size_t begin, std::size_t end) {
+        bounds[t + 1] = end;
+        std::sort(l_range_begin + begin, l_range_begin + end, compare);
+      });
+    sort_merge_runs(policy, l_range_begin, std::move(bounds), compare);
+    return;
+  }
+  std::sort(l_range_begin, l_range_end, compare);
+}
+
+/**
+ * Resolves the offsets in locally sorted values that partition the
+ * global sequence of values at the given global ranks.
+ *
+ * Splitters are found by histogramming: in every round, each unit
+ * proposes the median of its remaining candidate values for every
+ * unresolved rank. The weighted median of all proposals is used as
+ * splitter candidate and its global rank is determined from the global
+ * histogram of values less or equal to the candidate. Candidate ranges
+ * are narrowed until the global rank of a candidate matches the target
+ * rank. Values equal to a splitter are assigned to units in unit order.
+ *
+ * \return  Offsets in local sorted values, value at index \c b is the
+ *          number of local values preceding global rank \c ranks[b].
+ */
+template <class ValueType, class Compare>
+std::vector<std::size_t> sort_splitters(
+  const ValueType                * l_sorted,
+  std::size_t                      nlocal,
+  const std::vector<std::size_t> & ranks,
+  std::size_t                      nglobal,
+  Compare                          compare,
+  dash::Team                     & team)
+{
+  typedef struct {
+    ValueType   value;
+    std::size_t weight;
+  } proposal_t;
+
+  std::size_t nunits  = team.size();
+  std::size_t nsplit  = ranks.size();
+  const ValueType * l_end = l_sorted + nlocal;
+
+  std::vector<std::size_t> splits(nsplit, 0);
+  std::vector<std::size_t> lo(nsplit, 0);
+  std::vector<std::size_t> hi(nsplit, nlocal);
+  std::vector<bool>        resolved(nsplit, false);
+  std::vector<ValueType>   pivots(nsplit);
+  // Number of values less than the resolved splitter in global range
+  // and number of local values equal to the resolved splitter:
+  std::vector<std::size_t> n_less(nsplit, 0);
+  std::vector<std::size_t> l_equal(nsplit, 0);
+
+  std::size_t nactive = 0;
+  for (std::size_t b = 0; b < nsplit; ++b) {
+    if (ranks[b] == 0 || ranks[b] >= nglobal) {
+      // Trivial partition:
+      splits[b]   = ranks[b] == 0 ? 0 : nlocal;
+      resolved[b] = true;
+    } else {
+      ++nactive;
+    }
+  }
+
+  std::vector<proposal_t>  l_proposals(nsplit);
+  std::vector<proposal_t>  g_proposals(nsplit * nunits);
+  std::vector<std::size_t> l_hist(2 * nsplit);
+  std::vector<std::size_t> g_hist(2 * nsplit);
+  std::vector<proposal_t>  candidates;
+  dash::dart_storage<proposal_t> ds_proposals(nsplit);
+
+  while (nactive > 0) {
+    // Propose median of local candidate range for every unresolved rank:
+    for (std::size_t b = 0; b < nsplit; ++b) {
+      l_proposals[b].weight = 0;
+      if (!resolved[b] && hi[b] > lo[b]) {
+        l_proposals[b].value  = l_sorted[lo[b] + (hi[b] - lo[b]) / 2];
+        l_proposals[b].weight = hi[b] - lo[b];
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(l_proposals.data(), g_proposals.data(),
+                     ds_proposals.nelem, ds_proposals.dtype,
+                     team.dart_id()),
+      DART_OK);
+    // Weighted median of proposals as splitter candidate, identical at
+    // all units:
+    for (std::size_t b = 0; b < nsplit; ++b) {
+      l_hist[2 * b]     = 0;
+      l_hist[2 * b + 1] = 0;
+      if (resolved[b]) {
+        continue;
+      }
+      candidates.clear();
+      std::size_t total_weight = 0;
+      for (std::size_t u = 0; u < nunits; ++u) {
+        const proposal_t & p = g_proposals[u * nsplit + b];
+        if (p.weight > 0) {
+          candidates.push_back(p);
+          total_weight += p.weight;
+        }
+      }
+      DASH_ASSERT_GT(total_weight, 0, "no splitter candidates left");
+      std::stable_sort(candidates.begin(), candidates.end(),
+                       [&](const proposal_t & a, const proposal_t & c) {
+                         return compare(a.value, c.value);
+                       });
+      std::size_t acc_weight = 0;
+      for (const auto & c : candidates) {
+        pivots[b]   = c.value;
+        acc_weight += c.weight;
+        if (2 * acc_weight >= total_weight) {
+          break;
+        }
+      }
+      // Local histogram of values less than and not greater than the
+      // splitter candidate:
+      l_hist[2 * b]     = std::lower_bound(l_sorted, l_end, pivots[b],
+                                           compare) - l_sorted;
+      l_hist[2 * b + 1] = std::upper_bound(l_sorted, l_end, pivots[b],
+                                           compare) - l_sorted;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(l_hist.data(), g_hist.data(), 2 * nsplit,
+                     dash::dart_datatype<std::size_t>::value,
+                     dash::plus<std::size_t>().dart_operation(),
+                     team.dart_id()),
+      DART_OK);
+    // Narrow candidate ranges:
+    for (std::size_t b = 0; b < nsplit; ++b) {
+      if (resolved[b]) {
+        continue;
+      }
+      std::size_t g_less   = g_hist[2 * b];
+      std::size_t g_not_gt = g_hist[2 * b + 1];
+      if (ranks[b] < g_less) {
+        hi[b] = std::max(lo[b], std::min(hi[b], l_hist[2 * b]));
+      } else if (ranks[b] > g_not_gt) {
+        lo[b] = std::min(hi[b], std::max(lo[b], l_hist[2 * b + 1]));
+      } else {
+        resolved[b] = true;
+        splits[b]   = l_hist[2 * b];
+        l_equal[b]  = l_hist[2 * b + 1] - l_hist[2 * b];
+        n_less[b]   = g_less;
+        --nactive;
+      }
+    }
+    DASH_LOG_TRACE("dash::sort", "unresolved splitters:", nactive);
+  }
+  // Distribute values equal to splitters in unit order:
+  std::vector<std::size_t> g_equal(nsplit * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(l_equal.data(), g_equal.data(), nsplit,
+                   dash::dart_datatype<std::size_t>::value,
+                   team.dart_id()),
+    DART_OK);
+  std::size_t myid = team.myid();
+  for (std::size_t b = 0; b < nsplit; ++b) {
+    if (ranks[b] == 0 || ranks[b] >= nglobal) {
+      continue;
+    }
+    std::size_t n_equal_pred = 0;
+    for (std::size_t u = 0; u < myid; ++u) {
+      n_equal_pred += g_equal[u * nsplit + b];
+    }
+    std::size_t n_left  = ranks[b] - n_less[b];
+    std::size_t n_take  = (n_left > n_equal_pred)
+                          ? std::min(l_equal[b], n_left - n_equal_pred)
+                          : 0;
+    splits[b] += n_take;
+  }
+  return splits;
+}
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the range [first, last) in ascending order
+ * using the given comparison function.
+ *
+ * Distributed sample sort: local elements are sorted at every unit,
+ * splitters partitioning the global sequence are determined from global
+ * histograms of splitter candidates, and elements are exchanged between
+ * units in a single all-to-all step and merged at their target unit.
+ * The order of equal elements is not preserved.
+ *
+ * Collective operation, the sorted range is visible to all units on
+ * return. The local sort and merge phases use the given execution
+ * policy.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence,
+ *                           must be trivially copyable
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(nl log nl) + O(log n) rounds of collective
+ *              communication, with \c nl local elements and \c n
+ *              elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<ElementType> >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+sort(
+  /// Execution policy of the local phases
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Element comparison function, defaults to std::less
+  Compare                            compare = Compare())
+{
+  typedef typename std::decay<ElementType>::type value_t;
+  typedef typename PatternType::index_type       index_t;
+
+  static_assert(PatternType::ndim() == 1,
+                "dash::sort is only defined for one-dimensional patterns");
+
+  if (first == last) {
+    return;
+  }
+
+  dash::util::Trace trace("sort");
+
+  auto      & pattern   = first.pattern();
+  auto      & team      = pattern.team();
+  std::size_t nunits    = team.size();
+  std::size_t myid      = team.myid();
+  index_t     gbegin    = first.pos();
+  std::size_t nglobal   = last.pos() - gbegin;
+
+  auto        l_idx_range = dash::internal::local_index_range_1d(
+                              pattern, gbegin, last.pos());
+  value_t   * l_range     = static_cast<value_t *>(first.globmem().lbegin())
+                            + l_idx_range.begin;
+  std::size_t nlocal      = l_idx_range.end - l_idx_range.begin;
+  DASH_LOG_DEBUG("dash::sort()", "global size:", nglobal,
+                 "local size:", nlocal);
+
+  trace.enter_state("local_sort");
+  dash::internal::sort_local(policy, l_range, l_range + nlocal, compare);
+  trace.exit_state("local_sort");
+
+  if (nunits < 2) {
+    return;
+  }
+
+  // Number of elements in the range at every unit, the sorted sequence
+  // is first partitioned in blocks of these sizes in unit order:
+  std::vector<std::size_t> l_sizes(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&nlocal, l_sizes.data(), 1,
+                   dash::dart_datatype<std::size_t>::value,
+                   team.dart_id()),
+    DART_OK);
+  std::vector<std::size_t> ranks(nunits - 1);
+  std::size_t rank = 0;
+  for (std::size_t u = 0; u < nunits - 1; ++u) {
+    rank     += l_sizes[u];
+    ranks[u]  = rank;
+  }
+
+  trace.enter_state("splitters");
+  auto splits = dash::internal::sort_splitters(
+                  l_range, nlocal, ranks, nglobal, compare, team);
+  trace.exit_state("splitters");
+
+  trace.enter_state("exchange");
+  std::vector<std::size_t> send_counts(nunits);
+  std::size_t split_prev = 0;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    std::size_t split = (u < nunits - 1) ? splits[u] : nlocal;
+    send_counts[u]    = split - split_prev;
+    split_prev        = split;
+  }
+  std::vector<value_t>     recv_values;
+  std::vector<std::size_t> recv_counts;
+  dash::alltoallv(
+    l_range, send_counts, recv_values, recv_counts, team);
+  DASH_ASSERT_EQ(nlocal, recv_values.size(),
+                 "received number of elements differs from local size");
+  trace.exit_state("exchange");
+
+  trace.enter_state("merge");
+  std::vector<std::size_t> run_bounds(nunits + 1, 0);
+  for (std::size_t u = 0; u < nunits; ++u) {
+    run_bounds[u+1] = run_bounds[u] + recv_counts[u];
+  }
+  dash::internal::sort_merge_runs(
+    policy, recv_values.data(), std::move(run_bounds), compare);
+  trace.exit_state("merge");
+
+  // Test if the local elements of every unit are contiguous in the
+  // global range and ordered by unit, as in blocked patterns:
+  std::size_t l_blocked = 1;
+  std::size_t g_blocked = 0;
+  std::size_t rank_begin = (myid == 0) ? 0 : ranks[myid - 1];
+  if (nlocal > 0) {
+    index_t g_first = pattern.global(l_idx_range.begin);
+    index_t g_last  = pattern.global(l_idx_range.end - 1);
+    l_blocked = (static_cast<std::size_t>(g_first - gbegin) == rank_begin &&
+                 static_cast<std::size_t>(g_last - g_first) == nlocal - 1);
+  }
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_blocked, &g_blocked, 1,
+                   dash::dart_datatype<std::size_t>::value,
+                   dash::min<std::size_t>().dart_operation(),
+                   team.dart_id()),
+    DART_OK);
+
+  if (g_blocked) {
+    std::copy(recv_values.begin(), recv_values.end(), l_range);
+  } else {
+    // Move elements from their position in the blocked partition to
+    // their position in the pattern:
+    trace.enter_state("redistribute");
+    std::vector<std::size_t> dest_units(nlocal);
+    send_counts.assign(nunits, 0);
+    for (std::size_t r = 0; r < nlocal; ++r) {
+      std::size_t unit = pattern.unit_at(gbegin + rank_begin + r);
+      dest_units[r]    = unit;
+      ++send_counts[unit];
+    }
+    std::vector<std::size_t> send_displs(nunits, 0);
+    for (std::size_t u = 1; u < nunits; ++u) {
+      send_displs[u] = send_displs[u-1] + send_counts[u-1];
+    }
+    std::vector<value_t> send_values(nlocal);
+    for (std::size_t r = 0; r < nlocal; ++r) {
+      send_values[send_displs[dest_units[r]]++] = recv_values[r];
+    }
+    dash::alltoallv(
+      send_values.data(), send_counts, recv_values, recv_counts, team);
+    // Elements received from every unit are ordered by rank:
+    std::vector<std::size_t> recv_offsets(nunits, 0);
+    for (std::size_t u = 1; u < nunits; ++u) {
+      recv_offsets[u] = recv_offsets[u-1] + recv_counts[u-1];
+    }
+    for (std::size_t l = 0; l < nlocal; ++l) {
+      std::size_t r    = pattern.global(l_idx_range.begin + l) - gbegin;
+      std::size_t unit = std::upper_bound(ranks.begin(), ranks.end(), r)
+                         - ranks.begin();
+      l_range[l]       = recv_values[recv_offsets[unit]++];
+    }
+    trace.exit_state("redistribute");
+  }
+  team.barrier();
+}
+
+/**
+ * Sorts the elements in the range [first, last) in ascending order
+ * using the given comparison function, local phases use
+ * \c dash::execution::par.
+ *
+ * \see         dash::sort
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<ElementType> >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Element comparison function, defaults to std::less
+  Compare                            compare = Compare())
+{
+  dash::sort(dash::execution::parallel_policy(), first, last, compare);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
@@ -7,6 +7,7 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/iterator/GlobIter.h>
 
@@ -15,11 +16,9 @@
 
 #include <dash/dart/if/dart_communication.h>
 
-#include <iterator>
+#include <dash/Execution.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <iterator>
 
 namespace dash {
 
@@ -185,14 +184,19 @@ GlobOutputIt transform(
  *              =    =    =    ...
  *   output:  [ u0 | u1 | u2 | ... ]
  * </pre>
+ *
+ * Local elements are transformed using the given execution policy.
  */
 template<
   typename ValueType,
+  class ExecutionPolicy,
   class InputAIt,
   class InputBIt,
   class OutputIt,
   class BinaryOperation >
-OutputIt transform_local(
+dash::internal::enable_if_execution_policy<ExecutionPolicy, OutputIt>
+transform_local(
+  ExecutionPolicy && policy,
   InputAIt        in_a_first,
   InputAIt        in_a_last,
   InputBIt        in_b_first,
@@ -228,31 +232,41 @@ OutputIt transform_local(
   // Local pointer of initial output element:
   ValueType * lbegin_out = (out_first  + g_offset_first).local();
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
-      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+  dash::internal::parallel_for(
+    policy, lend_a - lbegin_a,
+    [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
+      }
+    });
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset, local elements are transformed using \c dash::execution::par.
+ *
+ * \see dash::transform_local
+ */
+template<
+  typename ValueType,
+  class InputAIt,
+  class InputBIt,
+  class OutputIt,
+  class BinaryOperation >
+OutputIt transform_local(
+  InputAIt        in_a_first,
+  InputAIt        in_a_last,
+  InputBIt        in_b_first,
+  OutputIt        out_first,
+  BinaryOperation binary_op)
+{
+  return dash::transform_local<ValueType>(
+           dash::execution::parallel_policy(),
+           in_a_first, in_a_last, in_b_first, out_first, binary_op);
+}
+
 /**
  * Local lhs input ranges on global output range.
  *
@@ -0,0 +1,213 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/Execution.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/// Minimum number of local elements per thread in parallel local phases.
+constexpr std::size_t ParallelMinElementsPerThread = 16384;
+
+/// Number of elements a thread searches before checking whether another
+/// thread found a match at a smaller index.
+constexpr std::size_t ParallelFindBlockSize = 1024;
+
+/**
+ * Number of threads available to the calling unit for local phases of
+ * algorithms, see \c dash::util::UnitLocality::num_domain_threads.
+ * Determined once at the first parallel local phase.
+ */
+inline std::size_t num_unit_threads()
+{
+#ifdef DASH_ENABLE_OPENMP
+  static const std::size_t n_threads = std::max<int>(
+                                         1,
+                                         dash::util::UnitLocality()
+                                           .num_domain_threads());
+  return n_threads;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Number of threads processing \c nelem elements with at least
+ * \c min_chunk elements per thread.
+ */
+inline std::size_t parallel_num_threads(
+  const dash::execution::sequenced_policy &,
+  std::size_t                               /* nelem */,
+  std::size_t                               /* min_chunk */)
+{
+  return 1;
+}
+
+inline std::size_t parallel_num_threads(
+  const dash::execution::parallel_policy  &,
+  std::size_t                               nelem,
+  std::size_t                               min_chunk)
+{
+  return std::max<std::size_t>(
+           1, std::min(num_unit_threads(),
+                       nelem / std::max<std::size_t>(1, min_chunk)));
+}
+
+/**
+ * Invokes \c func(t, begin, end) for the \c n_threads contiguous
+ * partitions of \c [0, nelem), partition \c t is processed by thread
+ * \c t.
+ */
+template <class ChunkFunction>
+void parallel_chunks(
+  std::size_t   n_threads,
+  std::size_t   nelem,
+  ChunkFunction func)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (n_threads > 1) {
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (long t = 0; t < static_cast<long>(n_threads); ++t) {
+      func(static_cast<std::size_t>(t),
+           (nelem * t) / n_threads,
+           (nelem * (t + 1)) / n_threads);
+    }
+    return;
+  }
+#endif
+  func(0, 0, nelem);
+}
+
+/**
+ * Invokes \c func(begin, end) on partitions of \c [0, nelem) according
+ * to the execution policy.
+ */
+template <
+  class ExecutionPolicy,
+  class ChunkFunction >
+void parallel_for(
+  const ExecutionPolicy & policy,
+  std::size_t             nelem,
+  ChunkFunction           func,
+  std::size_t             min_chunk = ParallelMinElementsPerThread)
+{
+  if (nelem == 0) {
+    return;
+  }
+  std::size_t n_threads = parallel_num_threads(policy, nelem, min_chunk);
+  DASH_LOG_TRACE("dash::internal::parallel_for", "threads:", n_threads);
+  parallel_chunks(n_threads, nelem,
+                  [&](std::size_t, std::size_t begin, std::size_t end) {
+                    func(begin, end);
+                  });
+}
+
+/**
+ * Result of a single thread in \c parallel_reduce.
+ * Wrapping the value prevents packing in \c std::vector<bool>, the
+ * padding prevents false sharing between threads.
+ */
+template <class ValueType>
+struct ParallelThreadResult {
+  ValueType value;
+  char      pad[DASH__ARCH__CACHE_LINE_SIZE];
+};
+
+/**
+ * Combines the results of \c func(begin, end) on partitions of
+ * \c [0, nelem) in the order of partitions using \c combine.
+ * The range must not be empty.
+ */
+template <
+  class ResultType,
+  class ExecutionPolicy,
+  class ChunkFunction,
+  class CombineFunction >
+ResultType parallel_reduce(
+  const ExecutionPolicy & policy,
+  std::size_t             nelem,
+  ChunkFunction           func,
+  CombineFunction         combine,
+  std::size_t             min_chunk = ParallelMinElementsPerThread)
+{
+  std::size_t n_threads = parallel_num_threads(policy, nelem, min_chunk);
+  DASH_LOG_TRACE("dash::internal::parallel_reduce", "threads:", n_threads);
+  if (n_threads < 2) {
+    return func(std::size_t(0), nelem);
+  }
+  std::vector<ParallelThreadResult<ResultType>> t_results(n_threads);
+  parallel_chunks(n_threads, nelem,
+                  [&](std::size_t t, std::size_t begin, std::size_t end) {
+                    t_results[t].value = func(begin, end);
+                  });
+  ResultType result = t_results[0].value;
+  for (std::size_t t = 1; t < n_threads; ++t) {
+    result = combine(result, t_results[t].value);
+  }
+  return result;
+}
+
+/**
+ * Smallest index \c i in \c [0, nelem) for which \c pred(i) is satisfied,
+ * or \c nelem if there is no such index.
+ * Threads stop searching once a match at a smaller index has been found.
+ */
+template <
+  class ExecutionPolicy,
+  class IndexPredicate >
+std::size_t parallel_find(
+  const ExecutionPolicy & policy,
+  std::size_t             nelem,
+  IndexPredicate          pred)
+{
+  std::size_t n_threads = parallel_num_threads(
+                            policy, nelem, ParallelMinElementsPerThread);
+  if (n_threads < 2) {
+    for (std::size_t i = 0; i < nelem; ++i) {
+      if (pred(i)) {
+        return i;
+      }
+    }
+    return nelem;
+  }
+  std::atomic<std::size_t> found(nelem);
+  parallel_chunks(
+    n_threads, nelem,
+    [&](std::size_t, std::size_t begin, std::size_t end) {
+      for (std::size_t b = begin; b < end; b += ParallelFindBlockSize) {
+        if (found.load(std::memory_order_relaxed) < b) {
+          return;
+        }
+        std::size_t b_end = std::min(end, b + ParallelFindBlockSize);
+        for (std::size_t i = b; i < b_end; ++i) {
+          if (pred(i)) {
+            std::size_t prev = found.load(std::memory_order_relaxed);
+            while (i < prev &&
+                   !found.compare_exchange_weak(prev, i)) { }
+            return;
+          }
+        }
+      }
+    });
+  return found.load();
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
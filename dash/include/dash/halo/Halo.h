@@ -78,6 +78,21 @@ enum class Cycle : uint8_t {
   FIXED
 };
 
+/**
+ * Specifies how halo regions are exchanged between units
+ */
+enum class HaloExchange : uint8_t {
+  /// Select the faster of \c GET and \c PUSH when the halo wrapper is
+  /// created
+  AUTO,
+  /// Every unit reads its halo regions from the neighbours' memory with one
+  /// strided or indexed get per region
+  GET,
+  /// Every unit packs its boundary elements into a contiguous buffer per
+  /// neighbour and writes it to the neighbour with a single notified put
+  PUSH
+};
+
 /**
  * Cycle specification for every dimension
  */
@@ -288,6 +303,8 @@ public:
   using region_index_t  = typename RegionCoords_t::region_index_t;
   using region_size_t   = typename RegionCoords_t::region_index_t;
   using region_extent_t = typename RegionSpec_t::region_extent_t;
+  using StencilExtents_t =
+    std::array<std::pair<region_extent_t, region_extent_t>, NumDimensions>;
 
 public:
   constexpr HaloSpec(const Specs_t& specs) : _specs(specs) {}
@@ -304,16 +321,57 @@ public:
     }
   }
 
+  /**
+   * Halo specification of deep halos for \c depth stencil iterations per
+   * halo exchange: all halo regions, including the corner regions, are
+   * \c depth times as wide as the largest stencil extent. Elements within
+   * the stencil extents of the block border remain the boundary elements.
+   */
+  template <typename StencilSpecT>
+  HaloSpec(const StencilSpecT& stencil_specs, region_extent_t depth)
+  : HaloSpec(stencil_specs) {
+    if(depth < 2)
+      return;
+
+    region_extent_t radius = 0;
+    for(const auto& spec : _specs) {
+      radius = std::max(radius, spec.extent());
+      for(auto d = 0; d < NumDimensions; ++d) {
+        if(spec[d] == 0)
+          _stencil_extents[d].first =
+            std::max(_stencil_extents[d].first, spec.extent());
+        else if(spec[d] == 2)
+          _stencil_extents[d].second =
+            std::max(_stencil_extents[d].second, spec.extent());
+      }
+    }
+
+    RegionCoords_t center;
+    _num_regions = 0;
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index) {
+      if(index == center.index())
+        continue;
+      _specs[index] = RegionSpec_t(index, radius * depth);
+      ++_num_regions;
+    }
+    _depth = depth;
+  }
+
   template <typename... ARGS>
-  HaloSpec(const ARGS&... args) {
-    std::array<RegionSpec_t, sizeof...(ARGS)> tmp{ args... };
+  HaloSpec(const RegionSpec_t& region_spec, const ARGS&... args) {
+    std::array<RegionSpec_t, sizeof...(ARGS) + 1> tmp{ region_spec, args... };
     for(auto& spec : tmp) {
       _specs[spec.index()] = spec;
       ++_num_regions;
     }
   }
 
-  HaloSpec(const Self_t& other) { _specs = other._specs; }
+  HaloSpec(const Self_t& other) {
+    _specs           = other._specs;
+    _num_regions     = other._num_regions;
+    _depth           = other._depth;
+    _stencil_extents = other._stencil_extents;
+  }
 
   constexpr RegionSpec_t spec(const region_index_t index) const {
     return _specs[index];
@@ -327,6 +385,18 @@ public:
 
   const Specs_t& specs() const { return _specs; }
 
+  /**
+   * Number of stencil iterations per halo exchange, 1 unless created for
+   * deep halos.
+   */
+  constexpr region_extent_t depth() const { return _depth; }
+
+  /**
+   * Largest extents of the stencil points in negative and positive
+   * direction of every dimension, only set for deep halos.
+   */
+  const StencilExtents_t& stencil_extents() const { return _stencil_extents; }
+
 private:
   void set_region_spec(const Stencil_t& stencil) {
     auto index = RegionSpec_t::index(stencil);
@@ -353,8 +423,10 @@ private:
   }
 
 private:
-  Specs_t       _specs{};
-  region_size_t _num_regions{ 0 };
+  Specs_t          _specs{};
+  region_size_t    _num_regions{ 0 };
+  region_extent_t  _depth{ 1 };
+  StencilExtents_t _stencil_extents{};
 };  // HaloSpec
 
 template <typename ElementT, typename PatternT,
@@ -740,13 +812,14 @@ public:
   using RegionVector_t  = std::vector<Region_t>;
   using region_index_t  = typename RegionSpec_t::region_index_t;
   using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
+  using HaloElements_t  = std::vector<std::pair<region_index_t, ViewSpec_t>>;
 
 public:
   HaloBlock(GlobMem_t& globmem, const PatternT& pattern, const ViewSpec_t& view,
             const HaloSpec_t&  halo_reg_spec,
             const CycleSpec_t& cycle_spec = CycleSpec_t{})
   : _globmem(globmem), _pattern(pattern), _view(view),
-    _halo_reg_spec(halo_reg_spec) {
+    _halo_reg_spec(halo_reg_spec), _cycle_spec(cycle_spec) {
     _view_inner                 = view;
     _view_inner_with_boundaries = view;
 
@@ -835,6 +908,11 @@ public:
       _boundary_reg_mapping[index] = &_boundary_regions.back();
     }
 
+    // deep halos do not widen the boundary, the inner elements only depend
+    // on the stencil extents
+    if(_halo_reg_spec.depth() > 1)
+      halo_extents_max = _halo_reg_spec.stencil_extents();
+
     for(auto d = 0; d < NumDimensions; ++d) {
       const auto view_offset = view.offset(d);
       const auto view_extent = view.extent(d);
@@ -932,6 +1010,45 @@ public:
 
   pattern_size_t boundary_size() const { return _size_bnd_elems; }
 
+  /**
+   * Views on the halo elements within \c depth elements of the local block
+   * and their halo region indices, with offsets relative to the local
+   * block. Halo regions with fixed values and halo elements within the
+   * stencil extents of a global border without halo regions are excluded.
+   */
+  HaloElements_t halo_elements(pattern_size_t depth) const {
+    HaloElements_t elements;
+    if(depth == 0)
+      return elements;
+
+    for(const auto& region : _halo_regions) {
+      const auto& spec    = region.spec();
+      auto        rel_dim = spec.relevant_dim() - 1;
+      if(region.size() == 0
+         || (region.is_border_region() && region.border_dim(rel_dim)
+             && _cycle_spec[rel_dim] == Cycle::FIXED))
+        continue;
+
+      std::array<pattern_index_t, NumDimensions> offsets{};
+      std::array<pattern_size_t, NumDimensions>  extents{};
+      for(auto d = 0; d < NumDimensions; ++d) {
+        if(spec[d] == 1) {
+          offsets[d] = _view_inner_with_boundaries.offset(d) - _view.offset(d);
+          extents[d] = _view_inner_with_boundaries.extent(d);
+          continue;
+        }
+        extents[d] = std::min<pattern_size_t>(depth, region.region().extent(d));
+        offsets[d] = (spec[d] == 0) ? -static_cast<pattern_index_t>(extents[d])
+                                    : _view.extent(d);
+      }
+      ViewSpec_t view(offsets, extents);
+      if(view.size() > 0)
+        elements.push_back(std::make_pair(region.index(), view));
+    }
+
+    return elements;
+  }
+
   region_index_t index_at(const ViewSpec_t&      view,
                           const ElementCoords_t& coords) const {
     using signed_extent_t = typename std::make_signed<pattern_size_t>::type;
@@ -993,6 +1110,8 @@ private:
 
   const HaloSpec_t& _halo_reg_spec;
 
+  CycleSpec_t _cycle_spec;
+
   ViewSpec_t _view_inner_with_boundaries;
 
   ViewSpec_t _view_inner;
@@ -1044,6 +1163,10 @@ public:
 
   Element_t* pos_at(region_index_t index) { return _halo_offsets[index]; }
 
+  const Element_t* pos_at(region_index_t index) const {
+    return _halo_offsets[index];
+  }
+
   Element_t* pos_start() { return _halobuffer.data(); }
 
   const std::vector<Element_t>& buffer() const { return _halobuffer; }
@@ -5,15 +5,60 @@
 
 #include <dash/Matrix.h>
 #include <dash/Pattern.h>
+#include <dash/Collective.h>
+#include <dash/Exception.h>
+#include <dash/Execution.h>
 #include <dash/memory/GlobStaticMem.h>
 
+#include <dash/algorithm/internal/Parallel.h>
+
 #include <dash/halo/iterator/HaloMatrixIterator.h>
+#include <dash/halo/StencilOperator.h>
 
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <vector>
 
 namespace dash {
 
+namespace internal {
+
+/// First DART notification ID used by halo exchanges, lower IDs are left
+/// to applications.
+constexpr int HaloNotifyIdBegin = DART_NOTIFY_NUM_IDS / 2;
+
+/// Notification IDs used by a single halo exchange: data and
+/// acknowledgements for both receive buffers.
+constexpr int HaloNotifyIdsPerExchange = 4;
+
+/// Number of timed updates per exchange method when selecting the method
+/// of \c HaloExchange::AUTO.
+constexpr int HaloExchangeBenchRuns = 3;
+
+/// Number of push-based halo exchanges with distinct notification IDs
+/// that can exist at a time.
+constexpr int HaloNotifySlots =
+  (DART_NOTIFY_NUM_IDS - HaloNotifyIdBegin) / HaloNotifyIdsPerExchange;
+
+static_assert(HaloNotifySlots <= 32,
+              "notification ID slots of halo exchanges exceed slot mask");
+
+/**
+ * Mask of the notification ID slots used by push-based halo exchanges of
+ * the calling unit.
+ */
+inline uint32_t& halo_notify_slots_used() {
+  static uint32_t used = 0;
+  return used;
+}
+
+}  // namespace internal
+
 template <typename MatrixT, typename StencilSpecT>
 class HaloMatrixWrapper {
 private:
@@ -34,6 +79,8 @@ public:
   using iterator_bnd = HaloMatrixIterator<Element_t, Pattern_t, StencilSpecT,
                                           StencilViewScope::BOUNDARY>;
   using const_iterator_bnd = const iterator_bnd;
+  using iterator_halo = HaloMatrixIterator<Element_t, Pattern_t, StencilSpecT,
+                                           StencilViewScope::HALO>;
 
   using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
   using CycleSpec_t     = CycleSpec<NumDimensions>;
@@ -41,6 +88,7 @@ public:
   using HaloMemory_t    = HaloMemory<HaloBlock_t>;
   using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
   using region_index_t  = typename RegionCoords<NumDimensions>::region_index_t;
+  using StencilOperator_t = StencilOperator<Element_t, Pattern_t, StencilSpecT>;
 
 private:
   static constexpr auto MemoryArrange = Pattern_t::memory_order();
@@ -50,10 +98,34 @@ private:
   using Region_t       = Region<Element_t, Pattern_t, NumDimensions>;
 
 public:
+  /**
+   * Creates halo regions for the local block of the matrix.
+   *
+   * Collective operation. Halo regions are read from the neighbours by
+   * default (\c HaloExchange::GET), updates are local operations.
+   *
+   * With \c HaloExchange::PUSH and \c HaloExchange::AUTO, the exchange
+   * plan is built here: every unit announces the local offsets of the
+   * elements in its halo regions to their owners, which pack them into a
+   * contiguous send buffer per neighbour in every update. With
+   * \c HaloExchange::AUTO, both methods are timed in a few updates and the
+   * faster one is used. As push-based updates are collective operations
+   * of all neighbouring units, all units must call \c update (or
+   * \c update_async and \c wait) in the same order with both methods.
+   *
+   * With \c depth greater than 1, halo regions are \c depth times as wide
+   * as the stencil and halo regions have to be exchanged only once every
+   * \c depth stencil iterations, see \c hbegin. The halo regions must not
+   * be wider than the blocks of the neighbours.
+   */
   HaloMatrixWrapper(MatrixT& matrix, const StencilSpecT& stencil_spec,
-                    const CycleSpec_t& cycle_spec = CycleSpec_t())
+                    const CycleSpec_t& cycle_spec = CycleSpec_t(),
+                    HaloExchange exchange = HaloExchange::GET,
+                    std::size_t depth = 1)
   : _matrix(matrix), _stencil_spec(stencil_spec), _cycle_spec(cycle_spec),
-    _halo_reg_spec(stencil_spec), _view_local(matrix.local.extents()),
+    _halo_reg_spec(stencil_spec,
+                   static_cast<typename HaloSpec_t::region_extent_t>(depth)),
+    _view_local(matrix.local.extents()),
     _view_global(ViewSpec_t(matrix.local.offsets(), matrix.local.extents())),
     _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
                _halo_reg_spec, cycle_spec),
@@ -64,7 +136,13 @@ public:
     _iend(_haloblock, _halomemory, _stencil_spec,
           _haloblock.view_inner().size()),
     _bbegin(_haloblock, _halomemory, _stencil_spec, 0),
-    _bend(_haloblock, _halomemory, _stencil_spec, _haloblock.boundary_size()) {
+    _bend(_haloblock, _halomemory, _stencil_spec, _haloblock.boundary_size()),
+    _stencil_op(stencil_spec, _view_local.extents()) {
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      _view_inner_local.resize_dim(
+        d, _haloblock.view_inner().offset(d) - _view_global.offset(d),
+        _haloblock.view_inner().extent(d));
+    }
     for(const auto& region : _haloblock.halo_regions()) {
       if(region.size() == 0)
         continue;
@@ -221,15 +299,51 @@ public:
         num_elems_block = region.region().extent(0);
       }
     }
+
+    _exchange = exchange;
+    if(exchange != HaloExchange::GET) {
+      build_push_plan();
+    }
+    if(exchange == HaloExchange::AUTO) {
+      select_exchange();
+    }
+
+    _depth = std::max<std::size_t>(depth, 1);
+    for(const auto& stencil : stencil_spec.specs())
+      _radius = std::max<pattern_size_t>(_radius, stencil.max());
+    _valid_depth = 0;
   }
 
   ~HaloMatrixWrapper() {
+    // Global resources have been released in dash::finalize:
+    if(!dash::is_initialized())
+      return;
+    if(_push_planned) {
+      // Consume acknowledgements of the final updates, notification IDs
+      // may be reused by other halo exchanges afterwards:
+      auto dart_team = _matrix.pattern().team().dart_id();
+      for(auto u = std::max<size_t>(_push_updates, 2) - 2;
+          u < _push_updates; ++u) {
+        if(!_push_targets.empty()) {
+          dart_notify_wait(dart_team, _notify_id + 2 + (u % 2),
+                           _push_targets.size());
+        }
+      }
+      dart_team_memfree(_push_gptr);
+      internal::halo_notify_slots_used() &= ~(uint32_t(1) << _notify_slot);
+    }
     for(auto& dart_type : _dart_types) {
       dart_type_destroy(&dart_type);
     }
     _dart_types.clear();
   }
 
+  /**
+   * The method used to exchange halo regions, either \c HaloExchange::GET
+   * or \c HaloExchange::PUSH.
+   */
+  HaloExchange exchange() const { return _exchange; }
+
   iterator begin() noexcept { return _begin; }
 
   const_iterator begin() const noexcept { return _begin; }
@@ -254,11 +368,72 @@ public:
 
   const_iterator_bnd bend() const noexcept { return _bend; }
 
+  /**
+   * Iterator to the first halo element whose value has to be computed in
+   * the current stencil iteration for deep halos: halo elements within
+   * <tt>(valid_depth() - 1)</tt> times the stencil width of the local block.
+   * Their new values are stored in the halo memory of the wrapper of the
+   * result matrix at position \c hpos() of the iterator. Empty unless
+   * \c depth is greater than 1.
+   *
+   * Halo elements with fixed values are not computed. Like boundary
+   * elements, halo elements within the stencil width of a global border
+   * without halo regions are not computed and keep the values of the last
+   * update.
+   */
+  iterator_halo hbegin() {
+    return iterator_halo(_haloblock, _halomemory, _stencil_spec, 0,
+                         halo_compute_depth());
+  }
+
+  /**
+   * Iterator past the last halo element to compute, see \c hbegin.
+   */
+  iterator_halo hend() {
+    auto           depth = halo_compute_depth();
+    pattern_size_t size  = 0;
+    for(const auto& element : _haloblock.halo_elements(depth))
+      size += element.second.size();
+    return iterator_halo(_haloblock, _halomemory, _stencil_spec, size, depth);
+  }
+
+  /**
+   * Number of stencil iterations per halo exchange.
+   */
+  std::size_t depth() const { return _depth; }
+
+  /**
+   * Number of stencil iterations the values in the halo regions are valid
+   * for: \c depth() after an update of all halo regions and 0 before the
+   * first update. In every stencil iteration, the valid depth of the
+   * wrapper of the result matrix has to be set to the valid depth of the
+   * input matrix decremented by one, halo regions have to be updated once
+   * the valid depth is 0.
+   */
+  std::size_t valid_depth() const { return _valid_depth; }
+
+  /**
+   * Sets the number of stencil iterations the values in the halo regions
+   * are valid for, see \c valid_depth.
+   */
+  void set_valid_depth(std::size_t valid_depth) {
+    DASH_ASSERT_LE(valid_depth, _depth, "valid depth exceeds halo depth");
+    _valid_depth = valid_depth;
+  }
+
   const HaloBlock_t& halo_block() { return _haloblock; }
 
+  /**
+   * Updates all halo regions, blocks until the halo regions are updated.
+   *
+   * With \c HaloExchange::PUSH, this is a collective operation of all
+   * neighbouring units that also synchronizes them: a unit's halo regions
+   * are updated when its neighbours called \c update, no barrier is
+   * required between modifying the matrix and updating halo regions.
+   */
   void update() {
-    for(auto& region : _region_data)
-      update_halo_intern(region.second, false);
+    update_async();
+    wait();
   }
 
   void update_at(region_index_t index) {
@@ -267,7 +442,15 @@ public:
       update_halo_intern(it_find->second, false);
   }
 
+  /**
+   * Starts the update of all halo regions, completed by \c wait.
+   */
   void update_async() {
+    _valid_depth = _depth;
+    if(_exchange == HaloExchange::PUSH) {
+      push_halos();
+      return;
+    }
     for(auto& region : _region_data)
       update_halo_intern(region.second, true);
   }
@@ -278,15 +461,45 @@ public:
       update_halo_intern(it_find->second, true);
   }
 
+  /**
+   * Waits for the completion of all started halo region updates.
+   */
   void wait() {
     for(auto& region : _region_data)
       dart_wait_local(&region.second.halo_data.handle);
+    if(_push_pending)
+      wait_push();
   }
 
   const ViewSpec_t& view_local() const { return _view_local; }
 
+  /**
+   * View of the inner elements in local coordinates, i.e. the elements
+   * whose stencil points are all in the local block.
+   */
+  const ViewSpec_t& view_inner_local() const { return _view_inner_local; }
+
+  /**
+   * Stencil operator for regions of the local block, e.g.
+   * \c view_inner_local.
+   */
+  const StencilOperator_t& stencil_operator() const { return _stencil_op; }
+
+  /**
+   * Computes the inner elements of the local block into the local block
+   * \c out with the stencil operator, see \c StencilOperator. Boundary
+   * elements have to be computed separately, see \c bbegin.
+   */
+  template <typename ExecutionPolicy, typename StencilOpT>
+  internal::enable_if_execution_policy<ExecutionPolicy> compute_inner(
+    ExecutionPolicy&& policy, StencilOpT op, Element_t* out) const {
+    _stencil_op.apply(policy, _matrix.lbegin(), out, _view_inner_local, op);
+  }
+
   const StencilSpecT& stencil_spec() const { return _stencil_spec; }
 
+  HaloMemory_t& halo_memory() { return _halomemory; }
+
   const HaloMemory_t& halo_memory() const { return _halomemory; }
 
   MatrixT& matrix() { return _matrix; }
@@ -349,7 +562,79 @@ public:
     }
   }
 
+  /**
+   * Computes one stencil iteration of the local block into the matrix of
+   * \c out, overlapping the halo exchange with computation:
+   *
+   * - halo regions are updated if the valid depth is 0, see \c valid_depth
+   * - inner elements are computed by the threads of the unit while the
+   *   halo regions are exchanged, see \c dash::execution::par and
+   *   \c StencilOperator
+   * - boundary elements are computed as soon as the halo regions they
+   *   depend on arrived. With \c HaloExchange::PUSH, halo regions of all
+   *   neighbours arrive with a single notification, boundary elements are
+   *   computed once all halo regions arrived
+   * - for deep halos, the halo elements still valid in the next iteration
+   *   are computed into the halo memory of \c out, see \c hbegin
+   *
+   * The stencil operation is called as <tt>op(center, values)</tt> with the
+   * value of the element and the array of the values at the stencil
+   * points, in the order of the stencil specification, and returns the new
+   * value of the element. It is called concurrently for inner elements.
+   *
+   * Collective operation of all neighbouring units if halo regions are
+   * updated. The units are synchronized as required by the exchange method,
+   * the matrices must only be modified by \c compute_overlapped while
+   * iterating.
+   */
+  template <typename StencilOpT>
+  void compute_overlapped(StencilOpT op, HaloMatrixWrapper& out) {
+    compute_overlapped(dash::execution::par, op, out);
+  }
+
+  /**
+   * Computes one stencil iteration of the local block into the matrix of
+   * \c out, see \c compute_overlapped. The local elements are computed
+   * according to the execution policy.
+   */
+  template <typename ExecutionPolicy, typename StencilOpT>
+  internal::enable_if_execution_policy<ExecutionPolicy> compute_overlapped(
+    ExecutionPolicy&& policy, StencilOpT op, HaloMatrixWrapper& out) {
+    DASH_ASSERT_EQ(out.matrix().local_size(), _matrix.local_size(),
+                   "matrices have different local extents");
+    compute_overlapped_intern(policy, op, out.matrix().lbegin(), &out);
+  }
+
+  /**
+   * Computes one stencil iteration of the local block into the local
+   * block of matrix \c out with the same pattern as the wrapped matrix,
+   * see \c compute_overlapped. As the valid depth of the halo regions
+   * cannot be passed on to the result, halo regions are updated in every
+   * call and halo elements of deep halos are not computed.
+   */
+  template <typename StencilOpT>
+  void compute_overlapped(StencilOpT op, MatrixT& out) {
+    compute_overlapped(dash::execution::par, op, out);
+  }
+
+  /**
+   * Computes one stencil iteration of the local block into the local
+   * block of matrix \c out, see \c compute_overlapped. The local
+   * elements are computed according to the execution policy.
+   */
+  template <typename ExecutionPolicy, typename StencilOpT>
+  internal::enable_if_execution_policy<ExecutionPolicy> compute_overlapped(
+    ExecutionPolicy&& policy, StencilOpT op, MatrixT& out) {
+    DASH_ASSERT_EQ(out.local_size(), _matrix.local_size(),
+                   "matrices have different local extents");
+    compute_overlapped_intern(policy, op, out.lbegin(), nullptr);
+  }
+
 private:
+  using RegionMask_t = std::bitset<RegionCoords<NumDimensions>::MaxIndex>;
+  using StencilValues_t =
+    std::array<Element_t, StencilSpecT::num_stencil_points()>;
+
   struct HaloData {
     dart_handle_t       handle = DART_HANDLE_NULL;
   };
@@ -360,10 +645,220 @@ private:
     HaloData                       halo_data;
   };
 
+  /**
+   * Contiguous elements in the local memory of a unit.
+   */
+  struct PushBlock {
+    pattern_size_t offset;
+    pattern_size_t nelem;
+  };
+
+  /**
+   * Halo regions of a neighbour filled from local elements, packed into a
+   * contiguous range of the send buffer.
+   */
+  struct PushTarget {
+    /// Receive buffers of the neighbour for both parities
+    dart_gptr_t            gptrs[2];
+    /// Offset of the packed elements in the send buffer
+    size_t                 pack_offset;
+    /// Number of packed elements
+    size_t                 nelem;
+    /// Local elements to pack, in the order of the neighbour's halo regions
+    std::vector<PushBlock> blocks;
+  };
+
+  /**
+   * Halo regions filled from the elements of a neighbour, received in a
+   * contiguous range of the receive buffer.
+   */
+  struct PushSource {
+    /// Receive buffer of the neighbour, target of acknowledgements
+    dart_gptr_t                                  ack_gptr;
+    /// Offset of the received elements in the receive buffer
+    size_t                                       recv_offset;
+    /// Halo memory and number of elements of every region, in the order
+    /// of received elements
+    std::vector<std::pair<Element_t*, size_t>>   regions;
+  };
+
+  /**
+   * Halo region filled from local elements.
+   */
+  struct PushLocal {
+    Element_t*             halo_pos;
+    std::vector<PushBlock> blocks;
+  };
+
+  template <typename IteratorT, typename StencilOpT>
+  Element_t apply_stencil(IteratorT& it, StencilOpT& op) {
+    StencilValues_t values;
+    for(std::size_t i = 0; i < values.size(); ++i)
+      values[i] = it.value_at(i);
+
+    return op(*it, values);
+  }
+
+  template <typename ExecutionPolicy, typename StencilOpT>
+  void compute_overlapped_intern(const ExecutionPolicy& policy,
+                                 StencilOpT& op, Element_t* out_local,
+                                 HaloMatrixWrapper* out) {
+    bool exchange = (_valid_depth == 0 || out == nullptr);
+    bool get      = (_exchange == HaloExchange::GET);
+    if(exchange) {
+      // gets read the matrix of the neighbours, which must have completed
+      // writing it
+      if(get && !_matrix_complete)
+        _matrix.barrier();
+      update_async();
+    }
+    _matrix_complete = false;
+
+    _stencil_op.apply(policy, _matrix.lbegin(), out_local, _view_inner_local,
+                      op);
+
+    if(exchange && get) {
+      compute_boundary_on_arrival(op, out_local);
+    } else {
+      if(exchange)
+        wait();
+      auto it_bend = _bend;
+      for(auto it = _bbegin; it != it_bend; ++it)
+        out_local[it.lpos()] = apply_stencil(it, op);
+    }
+
+    if(out != nullptr) {
+      auto* out_halo = out->halo_memory().pos_start();
+      auto  it_hend  = hend();
+      for(auto it = hbegin(); it != it_hend; ++it)
+        out_halo[it.hpos()] = apply_stencil(it, op);
+      out->set_valid_depth(_valid_depth - 1);
+    }
+
+    // neighbours read the matrix until they completed the iteration
+    if(exchange && get) {
+      _matrix.barrier();
+      if(out != nullptr)
+        out->_matrix_complete = true;
+    }
+  }
+
+  /**
+   * Groups boundary elements by the halo regions their stencil points
+   * depend on.
+   */
+  void init_boundary_groups() {
+    if(_boundary_groups_init)
+      return;
+
+    ViewSpec_t view_local(_view_local.extents());
+    pattern_index_t idx    = 0;
+    auto            it_end = _bend;
+    for(auto it = _bbegin; it != it_end; ++it, ++idx) {
+      RegionMask_t mask;
+      for(const auto& stencil : _stencil_spec.specs()) {
+        auto coords = it.coords();
+        bool halo   = false;
+        for(auto d = 0; d < NumDimensions; ++d) {
+          coords[d] += stencil[d];
+          if(coords[d] < 0
+             || coords[d] >= static_cast<pattern_index_t>(
+                               _view_local.extent(d)))
+            halo = true;
+        }
+        if(halo)
+          mask.set(_haloblock.index_at(view_local, coords));
+      }
+      auto group = std::find_if(
+        _boundary_groups.begin(), _boundary_groups.end(),
+        [&](const std::pair<RegionMask_t, std::vector<pattern_index_t>>& g) {
+          return g.first == mask;
+        });
+      if(group == _boundary_groups.end()) {
+        _boundary_groups.push_back(
+          std::make_pair(mask, std::vector<pattern_index_t>()));
+        group = _boundary_groups.end() - 1;
+      }
+      group->second.push_back(idx);
+    }
+    _boundary_groups_init = true;
+  }
+
+  /**
+   * Computes the boundary elements while halo regions are updated with
+   * gets, every group of boundary elements as soon as the halo regions it
+   * depends on are complete.
+   */
+  template <typename StencilOpT>
+  void compute_boundary_on_arrival(StencilOpT& op, Element_t* out_local) {
+    init_boundary_groups();
+
+    RegionMask_t       ready;
+    std::vector<Data*> pending;
+    ready.set();
+    for(auto& region : _region_data) {
+      if(is_fixed_region(region.second.region))
+        continue;
+      ready.reset(region.first);
+      pending.push_back(&region.second);
+    }
+
+    std::vector<bool> done(_boundary_groups.size(), false);
+    std::size_t       num_done = 0;
+    while(num_done < _boundary_groups.size()) {
+      for(auto it = pending.begin(); it != pending.end();) {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(&(*it)->halo_data.handle, &flag), DART_OK);
+        if(flag) {
+          ready.set((*it)->region.index());
+          it = pending.erase(it);
+        } else {
+          ++it;
+        }
+      }
+
+      bool progress = false;
+      for(std::size_t g = 0; g < _boundary_groups.size(); ++g) {
+        const auto& group = _boundary_groups[g];
+        if(done[g] || (group.first & ~ready).any())
+          continue;
+        for(auto idx : group.second) {
+          auto it              = _bbegin + idx;
+          out_local[it.lpos()] = apply_stencil(it, op);
+        }
+        done[g]  = true;
+        progress = true;
+        ++num_done;
+      }
+
+      // block on a halo region instead of polling
+      if(!progress && !pending.empty()) {
+        DASH_ASSERT_RETURNS(
+          dart_wait_local(&pending.front()->halo_data.handle), DART_OK);
+        ready.set(pending.front()->region.index());
+        pending.erase(pending.begin());
+      }
+    }
+    wait();
+  }
+
+  /**
+   * Halo elements within this number of elements of the local block are
+   * computed in the current stencil iteration.
+   */
+  pattern_size_t halo_compute_depth() const {
+    return (_valid_depth > 1) ? (_valid_depth - 1) * _radius : 0;
+  }
+
+  bool is_fixed_region(const Region_t& region) const {
+    auto rel_dim = region.spec().relevant_dim() - 1;
+    return region.is_border_region() && region.border_dim(rel_dim)
+           && _cycle_spec[rel_dim] == Cycle::FIXED;
+  }
+
   void update_halo_intern(Data& data, bool async) {
-    auto rel_dim = data.region.spec().relevant_dim() - 1;
-    if(data.region.is_border_region() && data.region.border_dim(rel_dim)
-       && _cycle_spec[rel_dim] == Cycle::FIXED) {
+    if(is_fixed_region(data.region)) {
       return;
     }
     data.get_halos(data.halo_data);
@@ -372,6 +867,248 @@ private:
       dart_wait_local(&data.halo_data.handle);
   }
 
+  /**
+   * Builds the plan of \c HaloExchange::PUSH, see the constructor.
+   * Collective operation.
+   */
+  void build_push_plan() {
+    auto&  team  = _matrix.pattern().team();
+    auto   myid  = team.myid();
+    size_t nunits = team.size();
+
+    // Notification IDs, a slot that is free at all units in the team:
+    uint32_t used_local = internal::halo_notify_slots_used();
+    uint32_t used;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&used_local, &used, 1, DART_TYPE_UINT, DART_OP_BOR,
+                     team.dart_id()),
+      DART_OK);
+    _notify_slot = 0;
+    while(_notify_slot < internal::HaloNotifySlots
+          && (used & (uint32_t(1) << _notify_slot)))
+      ++_notify_slot;
+    if(_notify_slot == internal::HaloNotifySlots) {
+      DASH_THROW(dash::exception::RuntimeError,
+                 "HaloMatrixWrapper: no free notification IDs, at most "
+                   << internal::HaloNotifySlots
+                   << " halo wrappers with HaloExchange::PUSH or "
+                   << "HaloExchange::AUTO may exist at a time");
+    }
+    internal::halo_notify_slots_used() |= uint32_t(1) << _notify_slot;
+    _notify_id = internal::HaloNotifyIdBegin
+                 + _notify_slot * internal::HaloNotifyIdsPerExchange;
+
+    // Local offsets of the halo elements at their owners, prefixed by the
+    // offset of the elements in the receive buffer:
+    std::vector<std::vector<size_t>> requests(nunits);
+    std::vector<PushSource>          sources(nunits);
+    std::vector<size_t>              source_nelem(nunits, 0);
+    for(auto& region_data : _region_data) {
+      const auto& region = region_data.second.region;
+      if(is_fixed_region(region))
+        continue;
+
+      auto it     = region.begin();
+      auto it_end = region.end();
+      auto unit   = it.lpos().unit;
+      std::vector<PushBlock> blocks;
+      for(; it != it_end; ++it) {
+        auto lpos = it.lpos();
+        DASH_ASSERT_MSG(lpos.unit == unit,
+                        "halo region spans more than one unit");
+        pattern_size_t offset = lpos.index;
+        if(!blocks.empty()
+           && blocks.back().offset + blocks.back().nelem == offset) {
+          ++blocks.back().nelem;
+        } else {
+          blocks.push_back(PushBlock{ offset, 1 });
+        }
+      }
+      auto* halo_pos = _halomemory.pos_at(region.index());
+      if(unit == myid) {
+        _push_locals.push_back(PushLocal{ halo_pos, std::move(blocks) });
+        continue;
+      }
+      auto& request = requests[unit];
+      for(const auto& block : blocks) {
+        request.push_back(block.offset);
+        request.push_back(block.nelem);
+      }
+      sources[unit].regions.push_back(std::make_pair(halo_pos, region.size()));
+      source_nelem[unit] += region.size();
+    }
+
+    size_t recv_size = 0;
+    for(size_t u = 0; u < nunits; ++u) {
+      sources[u].recv_offset = recv_size;
+      recv_size += source_nelem[u];
+      if(!requests[u].empty()) {
+        requests[u].insert(requests[u].begin(), sources[u].recv_offset);
+      }
+    }
+
+    std::vector<size_t> recv_values;
+    std::vector<size_t> recv_counts;
+    dash::internal::alltoall_buckets(requests, recv_values, recv_counts, team);
+
+    // Receive buffers for two consecutive updates in symmetric global
+    // memory:
+    size_t recv_capacity;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&recv_size, &recv_capacity, 1,
+                     dash::dart_datatype<size_t>::value, DART_OP_MAX,
+                     team.dart_id()),
+      DART_OK);
+    _push_recv_capacity = std::max<size_t>(recv_capacity, 1);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(),
+                                 2 * _push_recv_capacity * sizeof(Element_t),
+                                 DART_TYPE_BYTE, &_push_gptr),
+      DART_OK);
+    dart_gptr_t local_gptr = _push_gptr;
+    dart_gptr_setunit(&local_gptr, myid);
+    void* recv_addr;
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(local_gptr, &recv_addr), DART_OK);
+    _push_recvbuf = static_cast<Element_t*>(recv_addr);
+
+    for(size_t u = 0; u < nunits; ++u) {
+      if(sources[u].regions.empty())
+        continue;
+      sources[u].ack_gptr = _push_gptr;
+      dart_gptr_setunit(&sources[u].ack_gptr, team_unit_t(u));
+      _push_sources.push_back(std::move(sources[u]));
+    }
+
+    // Targets from the requests of the neighbours:
+    size_t pack_size = 0;
+    size_t r_offset  = 0;
+    for(size_t u = 0; u < nunits; ++u) {
+      if(recv_counts[u] == 0)
+        continue;
+      PushTarget target;
+      auto recv_offset   = recv_values[r_offset];
+      target.pack_offset = pack_size;
+      target.nelem       = 0;
+      for(size_t r = r_offset + 1; r < r_offset + recv_counts[u]; r += 2) {
+        target.blocks.push_back(PushBlock{ recv_values[r],
+                                           recv_values[r + 1] });
+        target.nelem += recv_values[r + 1];
+      }
+      for(int parity = 0; parity < 2; ++parity) {
+        target.gptrs[parity] = _push_gptr;
+        dart_gptr_setunit(&target.gptrs[parity], team_unit_t(u));
+        dart_gptr_incaddr(&target.gptrs[parity],
+                          (parity * _push_recv_capacity + recv_offset)
+                            * sizeof(Element_t));
+      }
+      pack_size += target.nelem;
+      r_offset  += recv_counts[u];
+      _push_targets.push_back(std::move(target));
+    }
+    _push_sendbuf.resize(pack_size);
+
+    _push_planned = true;
+  }
+
+  /**
+   * Packs and sends boundary elements to all neighbours.
+   */
+  void push_halos() {
+    auto dart_team = _matrix.pattern().team().dart_id();
+    int  parity    = _push_updates % 2;
+    // Receive buffers of this parity have been used two updates before:
+    if(_push_updates >= 2 && !_push_targets.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_notify_wait(dart_team, _notify_id + 2 + parity,
+                         _push_targets.size()),
+        DART_OK);
+    }
+    const Element_t* lbegin = _matrix.lbegin();
+    for(const auto& local : _push_locals) {
+      auto* halo_pos = local.halo_pos;
+      for(const auto& block : local.blocks) {
+        std::copy(lbegin + block.offset, lbegin + block.offset + block.nelem,
+                  halo_pos);
+        halo_pos += block.nelem;
+      }
+    }
+    for(const auto& target : _push_targets) {
+      auto* pack_pos = _push_sendbuf.data() + target.pack_offset;
+      for(const auto& block : target.blocks) {
+        std::copy(lbegin + block.offset, lbegin + block.offset + block.nelem,
+                  pack_pos);
+        pack_pos += block.nelem;
+      }
+      DASH_ASSERT_RETURNS(
+        dart_put_notify(target.gptrs[parity],
+                        _push_sendbuf.data() + target.pack_offset,
+                        target.nelem * sizeof(Element_t),
+                        DART_TYPE_BYTE, DART_TYPE_BYTE,
+                        _notify_id + parity),
+        DART_OK);
+    }
+    _push_pending = true;
+  }
+
+  /**
+   * Waits for the boundary elements of all neighbours and copies them to
+   * the halo regions.
+   */
+  void wait_push() {
+    auto dart_team = _matrix.pattern().team().dart_id();
+    int  parity    = _push_updates % 2;
+    if(!_push_sources.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_notify_wait(dart_team, _notify_id + parity,
+                         _push_sources.size()),
+        DART_OK);
+    }
+    const Element_t* recvbuf = _push_recvbuf + parity * _push_recv_capacity;
+    for(const auto& source : _push_sources) {
+      auto* recv_pos = recvbuf + source.recv_offset;
+      for(const auto& region : source.regions) {
+        std::copy(recv_pos, recv_pos + region.second, region.first);
+        recv_pos += region.second;
+      }
+      // Receive buffer may be reused by the neighbour:
+      DASH_ASSERT_RETURNS(
+        dart_put_notify(source.ack_gptr, &parity, 0, DART_TYPE_BYTE,
+                        DART_TYPE_BYTE, _notify_id + 2 + parity),
+        DART_OK);
+    }
+    ++_push_updates;
+    _push_pending = false;
+  }
+
+  /**
+   * Times both exchange methods in a few updates and selects the faster
+   * one. Collective operation.
+   */
+  void select_exchange() {
+    auto& team = _matrix.pattern().team();
+    double times[2];
+    HaloExchange methods[2] = { HaloExchange::GET, HaloExchange::PUSH };
+    for(int m = 0; m < 2; ++m) {
+      _exchange = methods[m];
+      update();
+      team.barrier();
+      auto start = std::chrono::steady_clock::now();
+      for(int r = 0; r < internal::HaloExchangeBenchRuns; ++r) {
+        update();
+      }
+      double elapsed = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start).count();
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(&elapsed, &times[m], 1, DART_TYPE_DOUBLE, DART_OP_MAX,
+                       team.dart_id()),
+        DART_OK);
+    }
+    _exchange = (times[1] <= times[0]) ? HaloExchange::PUSH
+                                       : HaloExchange::GET;
+    DASH_LOG_DEBUG("HaloMatrixWrapper.select_exchange",
+                   "get:", times[0], "push:", times[1]);
+  }
+
 private:
   MatrixT&                       _matrix;
   const StencilSpecT&            _stencil_spec;
@@ -383,6 +1120,27 @@ private:
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+  HaloExchange                   _exchange = HaloExchange::GET;
+  bool                           _push_planned = false;
+  bool                           _push_pending = false;
+  size_t                         _push_updates = 0;
+  int                            _notify_slot = 0;
+  int                            _notify_id = 0;
+  dart_gptr_t                    _push_gptr = DART_GPTR_NULL;
+  Element_t*                     _push_recvbuf = nullptr;
+  size_t                         _push_recv_capacity = 0;
+  std::vector<Element_t>         _push_sendbuf;
+  std::vector<PushTarget>        _push_targets;
+  std::vector<PushSource>        _push_sources;
+  std::vector<PushLocal>         _push_locals;
+  std::size_t                    _depth = 1;
+  std::size_t                    _valid_depth = 0;
+  pattern_size_t                 _radius = 0;
+  /// Whether all units completed writing the matrix, see compute_overlapped
+  bool                           _matrix_complete = false;
+  bool                           _boundary_groups_init = false;
+  std::vector<std::pair<RegionMask_t, std::vector<pattern_index_t>>>
+                                 _boundary_groups;
 
   iterator       _begin;
   iterator       _end;
@@ -390,8 +1148,36 @@ private:
   iterator_inner _iend;
   iterator_bnd   _bbegin;
   iterator_bnd   _bend;
+
+  StencilOperator_t _stencil_op;
+  ViewSpec_t        _view_inner_local;
 };
 
+/**
+ * One iteration of double-buffered time stepping: computes the matrix of
+ * \c next from the matrix of \c current, see
+ * \c HaloMatrixWrapper::compute_overlapped, and swaps both wrappers.
+ *
+ * \code
+ *   auto* current = &halo_1;
+ *   auto* next    = &halo_2;
+ *   for(int iter = 0; iter < num_iter; ++iter) {
+ *     dash::compute_overlapped(current, next,
+ *       [](double center, const std::array<double, 4>& values) {
+ *         return 0.5 * center + 0.125 * (values[0] + values[1] +
+ *                                        values[2] + values[3]);
+ *       });
+ *   }
+ * \endcode
+ */
+template <typename MatrixT, typename StencilSpecT, typename StencilOpT>
+void compute_overlapped(HaloMatrixWrapper<MatrixT, StencilSpecT>*& current,
+                        HaloMatrixWrapper<MatrixT, StencilSpecT>*& next,
+                        StencilOpT                                 op) {
+  current->compute_overlapped(op, *next);
+  std::swap(current, next);
+}
+
 }  // namespace dash
 
 #endif  // DASH__HALO_HALOMATRIXWRAPPER_H
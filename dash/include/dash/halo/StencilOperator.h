@@ -0,0 +1,318 @@
+#ifndef DASH__HALO__STENCILOPERATOR_H
+#define DASH__HALO__STENCILOPERATOR_H
+
+#include <dash/Types.h>
+#include <dash/Dimensional.h>
+#include <dash/Execution.h>
+
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/halo/Halo.h>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/// Number of contiguous elements of a tile in stencil operators
+constexpr std::size_t StencilTileInner = 512;
+
+/// Extent of a tile in stencil operators in dimensions other than the
+/// contiguous and the outermost dimension
+constexpr std::size_t StencilTileRows = 16;
+
+/// Number of elements in the outermost dimension computed per sweep before
+/// the subsequent sweeps follow in temporally blocked stencil operators
+constexpr std::size_t StencilWavefrontRows = 8;
+
+}  // namespace internal
+
+/**
+ * Stencil operator on elements of a local block whose stencil points are
+ * all in the local block, e.g. the inner elements of a
+ * \c HaloMatrixWrapper.
+ *
+ * The memory offsets of the stencil points are computed once for the
+ * local memory layout. The operator iterates tiles of the block in memory
+ * order and computes contiguous rows of elements with pointer arithmetic
+ * only, the loop over stencil points has a constant number of iterations
+ * and the loop over a row can be vectorized if the stencil operation is
+ * inlined.
+ *
+ * The stencil operation is called as <tt>op(center, values)</tt> with the
+ * value of the element and the array of the values at the stencil points,
+ * in the order of the stencil specification, and returns the new value of
+ * the element.
+ */
+template <typename ElementT, typename PatternT, typename StencilSpecT>
+class StencilOperator {
+private:
+  static constexpr auto NumDimensions    = PatternT::ndim();
+  static constexpr auto NumStencilPoints = StencilSpecT::num_stencil_points();
+  static constexpr auto MemoryArrange    = PatternT::memory_order();
+
+  using pattern_index_t       = typename PatternT::index_type;
+  using pattern_size_t        = typename PatternT::size_type;
+  using signed_pattern_size_t = typename std::make_signed<pattern_size_t>::type;
+
+public:
+  using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
+  using Extents_t       = std::array<pattern_size_t, NumDimensions>;
+  using StencilValues_t = std::array<ElementT, NumStencilPoints>;
+
+public:
+  /**
+   * Creates a stencil operator for local blocks with the given extents.
+   */
+  StencilOperator(const StencilSpecT& stencil_spec, const Extents_t& extents)
+  : _extents(extents) {
+    // dimensions in memory order, outermost first
+    for(dim_t p = 0; p < NumDimensions; ++p) {
+      _dims[p] = (MemoryArrange == ROW_MAJOR) ? p : NumDimensions - 1 - p;
+    }
+    signed_pattern_size_t stride = 1;
+    for(dim_t p = NumDimensions - 1; p >= 0; --p) {
+      _strides[_dims[p]] = stride;
+      stride *= _extents[_dims[p]];
+    }
+    for(std::size_t i = 0; i < NumStencilPoints; ++i) {
+      signed_pattern_size_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        offset += stencil_spec[i][d] * _strides[d];
+        _reach[d].first  = std::max<pattern_size_t>(
+          _reach[d].first, std::max<int>(0, -stencil_spec[i][d]));
+        _reach[d].second = std::max<pattern_size_t>(
+          _reach[d].second, std::max<int>(0, stencil_spec[i][d]));
+      }
+      _offsets[i] = offset;
+    }
+  }
+
+  /**
+   * Computes the elements of \c region in local coordinates from \c in and
+   * stores the results at the same positions in \c out. All stencil points
+   * of the elements in \c region must be in the local block. Rows are
+   * distributed to the threads of the unit according to the execution
+   * policy.
+   */
+  template <typename ExecutionPolicy, typename StencilOpT>
+  void apply(const ExecutionPolicy& policy, const ElementT* in, ElementT* out,
+             const ViewSpec_t& region, StencilOpT op) const {
+    if(region.size() == 0)
+      return;
+
+    auto outer = _dims[0];
+    internal::parallel_for(
+      policy, region.extent(outer),
+      [&](std::size_t begin, std::size_t end) {
+        auto part = region;
+        part.resize_dim(outer, region.offset(outer) + begin, end - begin);
+        apply_tiles(in, out, part, op);
+      },
+      internal::ParallelMinElementsPerThread
+        / std::max<std::size_t>(1, region.size() / region.extent(outer)));
+  }
+
+  /**
+   * Computes \c sweeps iterations on the elements of \c region using
+   * \c buf_0 and \c buf_1 alternately as input and output, starting with
+   * input \c buf_0. As the stencil points of the elements at the border of
+   * \c region are not updated, every iteration computes \c region shrunk
+   * by the extents of the stencil of all iterations before.
+   *
+   * The iterations are temporally blocked: every iteration follows the
+   * previous one at a distance of a few rows in the outermost dimension,
+   * while the rows it depends on are still cached.
+   *
+   * \return  Buffer containing the result of the last iteration.
+   */
+  template <typename ExecutionPolicy, typename StencilOpT>
+  ElementT* apply(const ExecutionPolicy& policy, ElementT* buf_0,
+                  ElementT* buf_1, const ViewSpec_t& region,
+                  std::size_t sweeps, StencilOpT op) const {
+    if(sweeps == 0)
+      return buf_0;
+
+    auto outer = _dims[0];
+    std::vector<ViewSpec_t>     regions;
+    std::vector<pattern_size_t> done(sweeps, 0);
+    auto                        shrunk = region;
+    for(std::size_t t = 0; t < sweeps; ++t) {
+      regions.push_back(shrunk);
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        auto shrink = _reach[d].first + _reach[d].second;
+        shrunk.resize_dim(
+          d, shrunk.offset(d) + _reach[d].first,
+          shrunk.extent(d) > shrink ? shrunk.extent(d) - shrink : 0);
+      }
+    }
+    // rows of an iteration that must be complete before the next iteration
+    // computes a row: rows it reads and rows the previous iteration reads
+    // before they are overwritten
+    signed_pattern_size_t lag =
+      std::max(_reach[outer].first, _reach[outer].second);
+
+    auto pending = [&]() {
+      for(std::size_t t = 0; t < sweeps; ++t) {
+        if(done[t] < regions[t].extent(outer))
+          return true;
+      }
+      return false;
+    };
+    while(pending()) {
+      for(std::size_t t = 0; t < sweeps; ++t) {
+        const auto& reg   = regions[t];
+        auto        limit = reg.extent(outer);
+        if(t > 0 && done[t - 1] < regions[t - 1].extent(outer)) {
+          // rows of iteration t - 1 complete, in coordinates of iteration t
+          signed_pattern_size_t ready =
+            static_cast<signed_pattern_size_t>(regions[t - 1].offset(outer))
+            + static_cast<signed_pattern_size_t>(done[t - 1])
+            - static_cast<signed_pattern_size_t>(reg.offset(outer));
+          limit = (ready > lag)
+                    ? std::min<pattern_size_t>(limit, ready - lag)
+                    : 0;
+        }
+        if(t == 0) {
+          limit = std::min<pattern_size_t>(
+                    limit, done[0] + internal::StencilWavefrontRows);
+        }
+        if(limit <= done[t])
+          continue;
+
+        auto part = reg;
+        part.resize_dim(outer, reg.offset(outer) + done[t], limit - done[t]);
+        if(part.size() > 0) {
+          const ElementT* in = (t % 2 == 0) ? buf_0 : buf_1;
+          ElementT*       out = (t % 2 == 0) ? buf_1 : buf_0;
+          apply(policy, in, out, part, op);
+        }
+        done[t] = limit;
+      }
+    }
+
+    return (sweeps % 2 == 0) ? buf_0 : buf_1;
+  }
+
+  /**
+   * Largest extents of the stencil points in negative and positive
+   * direction of every dimension.
+   */
+  const std::array<std::pair<pattern_size_t, pattern_size_t>, NumDimensions>&
+  reach() const {
+    return _reach;
+  }
+
+private:
+  /**
+   * Computes \c region tile by tile: tiles span the outermost dimension
+   * and are blocked in all other dimensions.
+   */
+  template <typename StencilOpT>
+  void apply_tiles(const ElementT* in, ElementT* out, const ViewSpec_t& region,
+                   StencilOpT& op) const {
+    if(NumDimensions == 1) {
+      apply_row(in, out, region.offset(0), region.extent(0), op);
+      return;
+    }
+
+    auto inner = _dims[NumDimensions - 1];
+    std::array<pattern_size_t, NumDimensions> tile_extents;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      tile_extents[d] = internal::StencilTileRows;
+    tile_extents[_dims[0]] = region.extent(_dims[0]);
+    tile_extents[inner]    = internal::StencilTileInner;
+
+    // origin of the current tile relative to the region
+    std::array<pattern_size_t, NumDimensions> tile{};
+    while(true) {
+      std::array<pattern_size_t, NumDimensions> tile_ext;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        tile_ext[d] = std::min(tile_extents[d], region.extent(d) - tile[d]);
+
+      // rows of the tile in memory order
+      std::array<pattern_size_t, NumDimensions> row{};
+      while(true) {
+        signed_pattern_size_t offset = 0;
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          offset += (region.offset(d) + tile[d] + row[d]) * _strides[d];
+        }
+        apply_row(in, out, offset, tile_ext[inner], op);
+
+        if(!next(row, tile_ext, NumDimensions - 1))
+          break;
+      }
+
+      std::array<pattern_size_t, NumDimensions> steps = tile_extents;
+      if(!next_tile(tile, steps, region))
+        break;
+    }
+  }
+
+  /**
+   * Advances the coordinates \c pos within \c extents in memory order,
+   * excluding the dimensions from memory order position \c end.
+   */
+  bool next(std::array<pattern_size_t, NumDimensions>&       pos,
+            const std::array<pattern_size_t, NumDimensions>& extents,
+            dim_t                                            end) const {
+    for(dim_t p = end - 1; p >= 0; --p) {
+      auto d = _dims[p];
+      if(++pos[d] < extents[d])
+        return true;
+      pos[d] = 0;
+    }
+    return false;
+  }
+
+  bool next_tile(std::array<pattern_size_t, NumDimensions>&       tile,
+                 const std::array<pattern_size_t, NumDimensions>& steps,
+                 const ViewSpec_t&                                region) const {
+    for(dim_t p = NumDimensions - 1; p > 0; --p) {
+      auto d = _dims[p];
+      tile[d] += steps[d];
+      if(tile[d] < region.extent(d))
+        return true;
+      tile[d] = 0;
+    }
+    return false;
+  }
+
+  template <typename StencilOpT>
+  inline void apply_row(const ElementT* in, ElementT* out,
+                        signed_pattern_size_t offset, pattern_size_t nelem,
+                        StencilOpT& op) const {
+    const ElementT* center = in + offset;
+    ElementT*       result = out + offset;
+    const ElementT* points[NumStencilPoints];
+    for(std::size_t i = 0; i < NumStencilPoints; ++i)
+      points[i] = center + _offsets[i];
+
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+    #pragma omp simd
+#endif
+    for(pattern_size_t j = 0; j < nelem; ++j) {
+      StencilValues_t values;
+      for(std::size_t i = 0; i < NumStencilPoints; ++i)
+        values[i] = points[i][j];
+      result[j] = op(center[j], values);
+    }
+  }
+
+private:
+  Extents_t                                              _extents;
+  std::array<dim_t, NumDimensions>                       _dims;
+  std::array<signed_pattern_size_t, NumDimensions>       _strides;
+  std::array<signed_pattern_size_t, NumStencilPoints>    _offsets;
+  std::array<std::pair<pattern_size_t, pattern_size_t>, NumDimensions>
+                                                         _reach{};
+};  // class StencilOperator
+
+}  // namespace dash
+
+#endif  // DASH__HALO__STENCILOPERATOR_H
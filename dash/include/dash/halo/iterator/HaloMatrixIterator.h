@@ -9,7 +9,17 @@
 
 namespace dash {
 
-enum class StencilViewScope : std::uint8_t { INNER, BOUNDARY, ALL };
+enum class StencilViewScope : std::uint8_t {
+  /// Elements whose stencil points are all local elements
+  INNER,
+  /// Local elements with stencil points in halo regions
+  BOUNDARY,
+  /// All local elements whose stencil points exist
+  ALL,
+  /// Halo elements of deep halos that are computed redundantly, see
+  /// \c HaloMatrixWrapper::hbegin
+  HALO
+};
 
 template <typename ElementT, typename PatternT, typename StencilSpecT,
           StencilViewScope Scope>
@@ -42,8 +52,14 @@ public:
   using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
 
 public:
+  /**
+   * Creates an iterator at position \c idx. With scope
+   * \c StencilViewScope::HALO, the iterator range consists of the halo
+   * elements within \c halo_depth elements of the local block.
+   */
   HaloMatrixIterator(const HaloBlock_t& haloblock, HaloMemory_t& halomemory,
-                     const StencilSpecT& stencil_spec, pattern_index_t idx)
+                     const StencilSpecT& stencil_spec, pattern_index_t idx,
+                     pattern_size_t halo_depth = 0)
   : _haloblock(haloblock), _halomemory(halomemory), _stencil_spec(stencil_spec),
     _local_memory((ElementT*) _haloblock.globmem().lbegin()),
     _local_layout(_haloblock.pattern().local_memory_layout()), _idx(idx)
@@ -58,9 +74,12 @@ public:
     if(Scope == StencilViewScope::BOUNDARY)
       set_view_local(_haloblock.view());
 
+    if(Scope == StencilViewScope::HALO)
+      set_view_halo(halo_depth);
+
     if(Scope == StencilViewScope::BOUNDARY)
       _size = _haloblock.boundary_size();
-    else
+    else if(Scope != StencilViewScope::HALO)
       _size = _view_local.size();
 
     set_coords();
@@ -108,6 +127,14 @@ public:
 
   pattern_index_t lpos() const { return _local_layout.at(_coords); }
 
+  /**
+   * Position of the element in the halo memory, only valid with scope
+   * \c StencilViewScope::HALO.
+   */
+  pattern_index_t hpos() const {
+    return _current_lmemory_addr - _halomemory.pos_start();
+  }
+
   const ElementCoords_t& coords() const { return _coords; };
 
   bool is_halo_value(const region_index_t index_stencil) {
@@ -166,6 +193,9 @@ public:
     if(halo)
       return value_halo_at(halo_coords);
 
+    if(Scope == StencilViewScope::HALO)
+      return *local_pos(halo_coords);
+
     return *(_current_lmemory_addr + _stencil_offsets[index_stencil]);
   }
 
@@ -187,6 +217,9 @@ public:
       if(halo)
         return value_halo_at(halo_coords);
 
+      if(Scope == StencilViewScope::HALO)
+        return *local_pos(halo_coords);
+
       return *halo_pos(stencil);
     }
   }
@@ -343,7 +376,33 @@ private:
     }
   }
 
+  void set_view_halo(pattern_size_t halo_depth) {
+    _view_local = ViewSpec_t(_local_layout.extents());
+    for(const auto& element : _haloblock.halo_elements(halo_depth)) {
+      _halo_element_regions.push_back(element.first);
+      _bnd_elements.push_back(element.second);
+      _size += element.second.size();
+    }
+  }
+
   void set_coords() {
+    if(Scope == StencilViewScope::HALO) {
+      // the address of the halo element, the coordinates are relative to
+      // the local block
+      if(_idx >= _size)
+        return;
+      pattern_size_t local_idx = _idx;
+      std::size_t    region    = 0;
+      while(local_idx >= _bnd_elements[region].size())
+        local_idx -= _bnd_elements[region++].size();
+      _coords = _local_layout.coords(local_idx, _bnd_elements[region]);
+      auto index       = _halo_element_regions[region];
+      auto halo_coords = _coords;
+      _halomemory.to_halo_mem_coords(index, halo_coords);
+      _current_lmemory_addr = _halomemory.pos_at(index)
+                              + _halomemory.value_at(index, halo_coords);
+      return;
+    }
     _coords            = set_coords(_idx);
     pattern_size_t off = 0;
     if(MemoryArrange == ROW_MAJOR) {
@@ -387,6 +446,21 @@ private:
              + _halomemory.value_at(index, halo_coords));
   }
 
+  ElementT* local_pos(const ElementCoords_t& coords) const {
+    pattern_size_t off = 0;
+    if(MemoryArrange == ROW_MAJOR) {
+      off = coords[0];
+      for(auto d = 1; d < NumDimensions; ++d)
+        off = off * _local_layout.extent(d) + coords[d];
+    } else {
+      off = coords[NumDimensions - 1];
+      for(auto d = NumDimensions - 2; d >= 0; --d)
+        off = off * _local_layout.extent(d) + coords[d];
+    }
+
+    return _local_memory + off;
+  }
+
   ElementT* halo_pos(const Stencil_t& stencil) {
     ElementT* halo_pos = _current_lmemory_addr;
     if(MemoryArrange == ROW_MAJOR) {
@@ -425,6 +499,7 @@ private:
   ElementT*                                           _local_memory;
   ViewSpec_t                                          _view_local;
   std::vector<ViewSpec_t>                             _bnd_elements;
+  std::vector<region_index_t>                         _halo_element_regions;
   std::array<signed_pattern_size_t, NumStencilPoints> _stencil_offsets;
   const LocalLayout_t&                                _local_layout;
   pattern_index_t                                     _idx{ 0 };
@@ -8,6 +8,8 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
+#include <dash/Collective.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -24,6 +26,8 @@
 #include <functional>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 
 namespace dash {
@@ -168,6 +172,29 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+  /// Hash index slots of all units, slots contain the local offset of the
+  /// referenced element or -1 for empty slots.
+  typedef dash::Array<index_type>                            slot_index_map;
+
+private:
+  /// Slot in the hash index of local elements.
+  typedef struct {
+    /// Offset of the element in local memory space, -1 if slot is empty.
+    index_type   lidx;
+    /// Native pointer to the element.
+    value_type * lptr;
+  } index_slot;
+
+  /// Minimum number of slots in local hash index.
+  static const size_type MinIndexSlots = 16;
+
+  /// Uninitialized storage of a single element, used in buffers of
+  /// values exchanged in bulk insertion.
+  typedef typename std::aligned_storage<
+                     sizeof(value_type), alignof(value_type)
+                   >::type
+    value_storage;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -203,6 +230,15 @@ private:
   /// Default is 4 KB.
   size_type              _local_buffer_size
                            = 4096 / sizeof(value_type);
+  /// Open addressing hash index of local elements, always consistent with
+  /// local memory space.
+  std::vector<index_slot> _local_index;
+  /// Number of elements registered in the local hash index.
+  size_type              _local_index_size = 0;
+  /// Hash indices of all units as published in the last commit.
+  slot_index_map         _index;
+  /// Number of slots per unit in the published hash indices.
+  size_type              _index_lsize     = 0;
 
 public:
   /// Local proxy object, allows use in range-based for loops.
@@ -276,11 +312,13 @@ public:
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
+      _move_to_owners();
       _globmem->commit();
     }
     // Accumulate local sizes of remote units:
     _local_sizes.barrier();
     _remote_size = 0;
+    size_type max_local_size = 0;
     for (int u = 0; u < _team->size(); ++u) {
       size_type local_size_u;
       if (u != _myid) {
@@ -289,6 +327,7 @@ public:
       } else {
         local_size_u = _local_sizes.local[0];
       }
+      max_local_size = std::max(max_local_size, local_size_u);
       _local_cumul_sizes[u] = local_size_u;
       if (u > 0) {
         _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
@@ -303,6 +342,8 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    // Publish local hash index to global memory:
+    _publish_index(max_local_size);
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -347,6 +388,13 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Initialize empty hash indices, sized for the local capacity:
+    _index_lsize          = _index_capacity(lcap);
+    _local_index_size     = 0;
+    _local_index.assign(_index_lsize, index_slot { -1, nullptr });
+    _index.allocate(_team->size() * _index_lsize, dash::BLOCKED, *_team);
+    std::fill(_index.lbegin(), _index.lend(), -1);
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -394,6 +442,9 @@ public:
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _local_index.clear();
+    _local_index_size     = 0;
+    _index_lsize          = 0;
     _begin                = iterator();
     _end                  = _begin;
     DASH_LOG_TRACE_VAR("UnorderedMap.deallocate >", this);
@@ -585,11 +636,39 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator   found = _end;
+    // Elements in local memory space are resolved without communication,
+    // including elements that have not been committed yet:
+    index_type lidx  = _local_index_find(key);
+    if (lidx >= 0) {
+      found = iterator(this, _myid, lidx);
+      DASH_LOG_TRACE("UnorderedMap.find >", found);
+      return found;
+    }
+    // Committed elements are stored at the unit mapped to their key by the
+    // hash function, probe its hash index only. Keys have no owner if
+    // elements are stored at the inserting unit, probe the hash indices of
+    // all remote units in this case:
+    if (!std::is_same<hasher, dash::HashLocal<key_type>>::value) {
+      team_unit_t owner = _key_hash(key);
+      if (owner != _myid) {
+        lidx = _remote_index_find(owner, key);
+        if (lidx >= 0) {
+          found = iterator(this, owner, lidx);
+        }
+      }
+      DASH_LOG_TRACE("UnorderedMap.find >", found);
+      return found;
+    }
+    auto nunits = _team->size();
+    for (size_type u_off = 1; u_off < nunits; ++u_off) {
+      team_unit_t unit((_myid + u_off) % nunits);
+      lidx = _remote_index_find(unit, key);
+      if (lidx >= 0) {
+        found = iterator(this, unit, lidx);
+        break;
+      }
+    }
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -597,11 +676,9 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    // Iterator and const_iterator are identical types, key lookup does not
+    // modify the map:
+    const_iterator found = const_cast<self_t *>(this)->find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -651,15 +728,79 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    // Insertion of a range is not a collective operation, values are
+    // inserted one by one and moved to their target units in the next
+    // commit. See bulk_insert for collective insertion of value ranges.
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Collectively insert the values in the given range.
+   *
+   * Values are bucketed by the unit mapped to their key by the hash
+   * function and exchanged in a single collective step. Every unit then
+   * inserts the values it received in its local memory space, skipping
+   * values with keys that already exist in the map.
+   * Elements are committed to global memory on return, elements inserted
+   * by \c insert at other units before are merged with bulk inserted
+   * elements in this commit.
+   *
+   * Must not be called concurrently with other modifying operations on
+   * the map.
+   *
+   * \return  The number of new elements inserted at the calling unit.
+   */
+  template<class ForwardIterator>
+  size_type bulk_insert(
+    /// Iterator at first value in the range to insert.
+    ForwardIterator first,
+    /// Iterator past the last value in the range to insert.
+    ForwardIterator last)
+  {
+    // Values are exchanged as raw bytes:
+    static_assert(std::is_trivially_copyable<value_type>::value,
+                  "bulk_insert requires trivially copyable value type");
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert()");
+    auto nunits = _team->size();
+    auto nvalues = std::distance(first, last);
+    DASH_LOG_TRACE_VAR("UnorderedMap.bulk_insert", nvalues);
+    // Resolve target unit of every value:
+    std::vector<dart_unit_t> targets;
+    std::vector<size_t>      send_counts(nunits, 0);
+    targets.reserve(nvalues);
+    for (auto it = first; it != last; ++it) {
+      team_unit_t unit = _key_hash(it->first);
+      targets.push_back(unit);
+      ++send_counts[unit];
+    }
+    // Bucket values by target unit:
+    std::vector<size_t> send_displs(nunits, 0);
+    for (size_type u = 1; u < nunits; ++u) {
+      send_displs[u] = send_displs[u-1] + send_counts[u-1];
+    }
+    std::vector<value_storage> send_values(nvalues);
+    auto target = targets.begin();
+    for (auto it = first; it != last; ++it, ++target) {
+      new (&send_values[send_displs[*target]++]) value_type(*it);
+    }
+    // Exchange buckets:
+    std::vector<value_storage> recv_values;
+    std::vector<size_t>        recv_counts;
+    dash::alltoallv(send_values.data(), send_counts,
+                    recv_values, recv_counts, *_team);
+
+    size_type ninserted = _insert_local(
+                            reinterpret_cast<const value_type *>(
+                              recv_values.data()), recv_values.size());
+    DASH_LOG_TRACE_VAR("UnorderedMap.bulk_insert", ninserted);
+    // Commit inserted elements:
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert >");
+    return ninserted;
+  }
+
   iterator erase(
     const_iterator position)
   {
@@ -782,7 +923,286 @@ private:
   }
 
   /**
-   * Insert value at specified unit.
+   * Hash value of a key used to resolve its slot in hash indices.
+   * The result of \c std::hash is scrambled using the finalizer of
+   * MurmurHash3 as keys often are identity-hashed integers with regular
+   * stride, e.g. when distributed cyclically to units.
+   */
+  static size_type _slot_hash(const key_type & key)
+  {
+    uint64_t h = static_cast<uint64_t>(std::hash<key_type>()(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+
+  /**
+   * Number of hash index slots for the given number of elements, a power
+   * of two that maintains a load factor of at most 0.5.
+   */
+  static size_type _index_capacity(size_type nelem)
+  {
+    size_type nslots = MinIndexSlots;
+    while (nslots < 2 * nelem) {
+      nslots <<= 1;
+    }
+    return nslots;
+  }
+
+  /**
+   * Resolve local offset of the element with the given key in the local
+   * hash index.
+   *
+   * \return  local offset of the element, or -1 if the key is not
+   *          contained in local memory space.
+   */
+  index_type _local_index_find(const key_type & key) const
+  {
+    if (_local_index.empty()) {
+      return -1;
+    }
+    size_type mask = _local_index.size() - 1;
+    for (size_type slot = _slot_hash(key) & mask; ;
+         slot = (slot + 1) & mask) {
+      const index_slot & entry = _local_index[slot];
+      if (entry.lidx < 0) {
+        return -1;
+      }
+      if (_key_equal(entry.lptr->first, key)) {
+        return entry.lidx;
+      }
+    }
+  }
+
+  /**
+   * Register local element in the local hash index, doubling the index
+   * capacity if the load factor exceeds 0.5.
+   */
+  void _local_index_insert(
+    index_type   lidx,
+    value_type * lptr)
+  {
+    if (2 * (_local_index_size + 1) > _local_index.size()) {
+      _local_index_rehash(_index_capacity(_local_index_size + 1));
+    }
+    size_type mask = _local_index.size() - 1;
+    size_type slot = _slot_hash(lptr->first) & mask;
+    while (_local_index[slot].lidx >= 0) {
+      slot = (slot + 1) & mask;
+    }
+    _local_index[slot] = index_slot { lidx, lptr };
+    ++_local_index_size;
+  }
+
+  /**
+   * Rebuild the local hash index with the specified number of slots.
+   */
+  void _local_index_rehash(size_type nslots)
+  {
+    DASH_LOG_TRACE("UnorderedMap._local_index_rehash()",
+                   "slots:", _local_index.size(), "->", nslots);
+    std::vector<index_slot> entries(nslots, index_slot { -1, nullptr });
+    entries.swap(_local_index);
+    size_type mask = nslots - 1;
+    for (const auto & entry : entries) {
+      if (entry.lidx < 0) {
+        continue;
+      }
+      size_type slot = _slot_hash(entry.lptr->first) & mask;
+      while (_local_index[slot].lidx >= 0) {
+        slot = (slot + 1) & mask;
+      }
+      _local_index[slot] = entry;
+    }
+  }
+
+  /**
+   * Resolve local offset of the element with the given key in the
+   * published hash index of a remote unit.
+   * Every probe requires two one-sided reads, one for the index slot and
+   * one for the key of the referenced element.
+   *
+   * \return  local offset of the element at the remote unit, or -1 if the
+   *          key is not contained in the unit's committed elements.
+   */
+  index_type _remote_index_find(
+    team_unit_t       unit,
+    const key_type  & key)
+  {
+    if (_index_lsize == 0) {
+      return -1;
+    }
+    // Global index of the unit's first slot:
+    index_type unit_slots = unit * _index_lsize;
+    size_type  mask       = _index_lsize - 1;
+    size_type  slot       = _slot_hash(key) & mask;
+    for (size_type probe = 0; probe < _index_lsize; ++probe) {
+      index_type lidx = _index[unit_slots + slot];
+      if (lidx < 0) {
+        break;
+      }
+      dart_gptr_t gptr_key = _globmem->at(unit, lidx).dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr_key, offsetof(value_type, first)),
+        DART_OK);
+      key_type lkey;
+      dash::internal::get_blocking(gptr_key, &lkey, 1);
+      if (_key_equal(lkey, key)) {
+        return lidx;
+      }
+      slot = (slot + 1) & mask;
+    }
+    return -1;
+  }
+
+  /**
+   * Collectively publish the local hash indices of all units to global
+   * memory. Reallocates the global hash index if the largest local size of
+   * all units exceeds its capacity.
+   */
+  void _publish_index(size_type max_local_size)
+  {
+    auto nslots = _index_capacity(max_local_size);
+    if (nslots > _index_lsize) {
+      DASH_LOG_TRACE("UnorderedMap._publish_index", "reallocate index",
+                     "slots per unit:", _index_lsize, "->", nslots);
+      _index.deallocate();
+      _index.allocate(_team->size() * nslots, dash::BLOCKED, *_team);
+      _index_lsize = nslots;
+    }
+    if (_local_index.size() != _index_lsize) {
+      _local_index_rehash(_index_lsize);
+    }
+    std::transform(_local_index.begin(), _local_index.end(),
+                   _index.lbegin(),
+                   [](const index_slot & entry) { return entry.lidx; });
+    _index.barrier();
+  }
+
+  /**
+   * Insert values in local memory space, skipping values with keys that
+   * already exist in the local memory space or occurred before in the
+   * given values.
+   * Local memory is grown in a single allocation and the local size is
+   * updated in a single atomic operation.
+   *
+   * \return  The number of new elements inserted.
+   */
+  size_type _insert_local(
+    const value_type * values,
+    size_type          nvalues)
+  {
+    size_type    lsize      = _local_sizes.local[0];
+    size_type    lcap       = _globmem->local_size();
+    value_type * lptr_grown = nullptr;
+    if (lsize + nvalues > lcap) {
+      lptr_grown = static_cast<value_type *>(
+                     _globmem->grow(lsize + nvalues - lcap));
+    }
+    size_type ninserted = 0;
+    for (size_type i = 0; i < nvalues; ++i) {
+      const value_type & value = values[i];
+      if (_local_index_find(value.first) >= 0) {
+        continue;
+      }
+      index_type   lidx = lsize + ninserted;
+      value_type * lptr = static_cast<size_type>(lidx) < lcap
+                          ? static_cast<value_type *>(
+                              _globmem->lbegin() + lidx)
+                          : lptr_grown + (lidx - lcap);
+      new (lptr) value_type(value);
+      _local_index_insert(lidx, lptr);
+      ++ninserted;
+    }
+    GlobRef<Atomic<size_type>>(_local_size_gptr).add(ninserted);
+    _local_cumul_sizes[_myid] += ninserted;
+    _lend = _lbegin + lsize + ninserted;
+    return ninserted;
+  }
+
+  /**
+   * Move local elements that have been inserted for remote units to the
+   * units mapped to their key by the hash function.
+   * Moved elements are removed from local memory space, remaining local
+   * elements are compacted. Every unit inserts the elements it received
+   * in its local memory space, elements with keys that already exist at
+   * the unit are discarded.
+   * Collective operation, called in every commit.
+   */
+  void _move_to_owners()
+  {
+    // Elements are exchanged as raw bytes:
+    static_assert(std::is_trivially_copyable<value_type>::value,
+                  "UnorderedMap requires trivially copyable value type");
+    if (std::is_same<hasher, dash::HashLocal<key_type>>::value) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._move_to_owners()",
+                   "elements to move:", _move_elements.size());
+    auto      nunits = _team->size();
+    size_type lsize  = _local_sizes.local[0];
+    // Bucket elements by target unit:
+    std::vector<bool>   moved(lsize, false);
+    std::vector<size_t> send_counts(nunits, 0);
+    for (const auto & it : _move_elements) {
+      index_type lidx = it.lpos().index;
+      moved[lidx]     = true;
+      ++send_counts[_key_hash(static_cast<value_type *>(
+                                _globmem->lbegin() + lidx)->first)];
+    }
+    std::vector<size_t> send_displs(nunits, 0);
+    for (size_type u = 1; u < nunits; ++u) {
+      send_displs[u] = send_displs[u-1] + send_counts[u-1];
+    }
+    std::vector<value_storage> send_values(_move_elements.size());
+    // Compact remaining local elements:
+    size_type nkeep = 0;
+    for (size_type lidx = 0; lidx < lsize; ++lidx) {
+      value_type * lptr = static_cast<value_type *>(
+                            _globmem->lbegin() + lidx);
+      if (moved[lidx]) {
+        new (&send_values[send_displs[_key_hash(lptr->first)]++])
+          value_type(*lptr);
+        lptr->~value_type();
+        continue;
+      }
+      if (nkeep < lidx) {
+        new (static_cast<value_type *>(_globmem->lbegin() + nkeep))
+          value_type(*lptr);
+        lptr->~value_type();
+      }
+      ++nkeep;
+    }
+    if (nkeep < lsize) {
+      GlobRef<Atomic<size_type>>(_local_size_gptr).sub(lsize - nkeep);
+      _local_cumul_sizes[_myid] -= lsize - nkeep;
+      _lend = _lbegin + nkeep;
+      // Rebuild local hash index from compacted elements:
+      _local_index.assign(_local_index.size(), index_slot { -1, nullptr });
+      _local_index_size = 0;
+      for (size_type lidx = 0; lidx < nkeep; ++lidx) {
+        _local_index_insert(lidx, static_cast<value_type *>(
+                                    _globmem->lbegin() + lidx));
+      }
+    }
+    _move_elements.clear();
+    // Exchange moved elements:
+    std::vector<value_storage> recv_values;
+    std::vector<size_t>        recv_counts;
+    dash::alltoallv(send_values.data(), send_counts,
+                    recv_values, recv_counts, *_team);
+    _insert_local(reinterpret_cast<const value_type *>(recv_values.data()),
+                  recv_values.size());
+    DASH_LOG_TRACE("UnorderedMap._move_to_owners >",
+                   "local size:", _local_sizes.local[0]);
+  }
+
+  /**
+   * Insert value in local memory space. Values inserted for a remote unit
+   * are moved to the unit in the next commit.
    */
   std::pair<iterator, bool> _insert_at(
     team_unit_t        unit,
@@ -801,7 +1221,7 @@ private:
                                  ).fetch_add(1);
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -827,10 +1247,12 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    // Register new element in local hash index:
+    _local_index_insert(old_local_size, lptr_insert);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
 
     if (unit != _myid) {
@@ -269,18 +269,11 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    // Resolve local offset of element in the local hash index:
+    auto     lidx  = _map->_local_index_find(key);
+    iterator found = lidx >= 0
+                     ? iterator(_map, lidx)
+                     : end();
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -288,18 +281,10 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    auto           lidx  = _map->_local_index_find(key);
+    const_iterator found = lidx >= 0
+                           ? const_iterator(_map, lidx)
+                           : end();
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
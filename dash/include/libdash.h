@@ -39,8 +39,11 @@ namespace dash {
 #include <dash/GlobAsyncRef.h>
 
 #include <dash/Onesided.h>
+#include <dash/Aggregation.h>
+#include <dash/Collective.h>
 
 #include <dash/LaunchPolicy.h>
+#include <dash/Execution.h>
 
 #include <dash/Container.h>
 #include <dash/Shared.h>
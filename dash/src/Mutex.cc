@@ -33,4 +33,21 @@ void Mutex::unlock(){
   DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire failed");
 }
 
+void Mutex::lock_shared(){
+  dart_ret_t ret = dart_lock_acquire_shared(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire_shared failed");
+}
+
+bool Mutex::try_lock_shared(){
+  int32_t result;
+  dart_ret_t ret = dart_lock_try_acquire_shared(_mutex, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+void Mutex::unlock_shared(){
+  dart_ret_t ret = dart_lock_release_shared(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release_shared failed");
+}
+
 } // namespace dash
@@ -803,6 +803,187 @@ TEST_F(CopyTest, AsyncGlobalToLocalBlock)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToGlobalRedistribute)
+{
+  const int num_elem_per_unit = 21;
+  size_t    num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKCYCLIC(4));
+  dash::Array<int> array_c(num_elem_total, dash::CYCLIC);
+
+  for (size_t l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = array_a.pattern().global(l);
+  }
+  for (size_t l = 0; l < array_b.lsize(); ++l) {
+    array_b.local[l] = -1;
+  }
+  array_a.barrier();
+  array_b.barrier();
+
+  // BLOCKED to BLOCKCYCLIC, full range:
+  auto out_last = dash::copy(array_a.begin(), array_a.end(),
+                             array_b.begin());
+  EXPECT_EQ_U(array_b.end(), out_last);
+  array_b.barrier();
+  for (size_t l = 0; l < array_b.lsize(); ++l) {
+    EXPECT_EQ_U(array_b.pattern().global(l), array_b.local[l]);
+  }
+  array_b.barrier();
+
+  // BLOCKCYCLIC to CYCLIC, shifted subrange:
+  size_t in_offset  = 5;
+  size_t out_offset = 2;
+  size_t num_copy   = num_elem_total - 2 * in_offset;
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    array_c.local[l] = -1;
+  }
+  array_c.barrier();
+  dash::copy(array_b.begin() + in_offset,
+             array_b.begin() + in_offset + num_copy,
+             array_c.begin() + out_offset);
+  array_c.barrier();
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    int g = array_c.pattern().global(l);
+    if (g < static_cast<int>(out_offset) ||
+        g >= static_cast<int>(out_offset + num_copy)) {
+      EXPECT_EQ_U(-1, array_c.local[l]);
+    } else {
+      EXPECT_EQ_U(g - out_offset + in_offset, array_c.local[l]);
+    }
+  }
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobalTiles)
+{
+  typedef dash::TilePattern<2>                              pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t>       matrix_a_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t,
+                       pattern_t>                           matrix_b_t;
+
+  size_t tilesize_x = 3;
+  size_t tilesize_y = 2;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  // Rows of matrix_a are blocked over all units, the extents are
+  // multiples of the block and tile sizes. Units in the second dimension
+  // of matrix_b hold different numbers of tiles:
+  size_t extent_x   = 2 * tilesize_x * teamspec.size();
+  size_t extent_y   = tilesize_y * (teamspec.extent(1) + 1);
+
+  dash::SizeSpec<2> sizespec(extent_x, extent_y);
+
+  // Rows distributed in blocks:
+  matrix_a_t matrix_a(sizespec);
+  // Rows and columns distributed in tiles:
+  matrix_b_t matrix_b(pattern_t(sizespec,
+                                dash::DistributionSpec<2>(
+                                  dash::TILE(tilesize_x),
+                                  dash::TILE(tilesize_y)),
+                                teamspec));
+
+  if (_dash_id == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix_a[x][y] = (x * 1000) + y;
+      }
+    }
+  }
+  matrix_a.barrier();
+
+  auto fut_out_last = dash::copy_async(matrix_a.begin(), matrix_a.end(),
+                                       matrix_b.begin());
+  EXPECT_EQ_U(matrix_b.end(), fut_out_last.get());
+  matrix_b.barrier();
+
+  if (_dash_id == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        EXPECT_EQ_U((x * 1000) + y, static_cast<int>(matrix_b[x][y]));
+      }
+    }
+  }
+  matrix_b.barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobalTilesSubrange)
+{
+  typedef dash::TilePattern<2>                              pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t>       matrix_a_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t,
+                       pattern_t>                           matrix_b_t;
+
+  size_t tilesize_x = 3;
+  size_t tilesize_y = 2;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  // Rows of matrix_a are blocked over all units, the extents are
+  // multiples of the block and tile sizes. Units in the second dimension
+  // of matrix_b hold different numbers of tiles:
+  size_t extent_x   = 2 * tilesize_x * teamspec.size();
+  size_t extent_y   = tilesize_y * (teamspec.extent(1) + 1);
+  size_t num_elem   = extent_x * extent_y;
+
+  dash::SizeSpec<2> sizespec(extent_x, extent_y);
+
+  matrix_a_t matrix_a(sizespec);
+  matrix_b_t matrix_b(pattern_t(sizespec,
+                                dash::DistributionSpec<2>(
+                                  dash::TILE(tilesize_x),
+                                  dash::TILE(tilesize_y)),
+                                teamspec));
+
+  if (_dash_id == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        matrix_a[x][y] = (x * 1000) + y;
+      }
+    }
+  }
+  std::fill(matrix_b.lbegin(), matrix_b.lend(), -1);
+  matrix_a.barrier();
+
+  // Range starting and ending within rows of tiles:
+  size_t begin = tilesize_y + 1;
+  size_t end   = num_elem - tilesize_y - 1;
+  dash::copy_async(matrix_a.begin() + begin, matrix_a.begin() + end,
+                   matrix_b.begin() + begin).get();
+  matrix_b.barrier();
+
+  if (_dash_id == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        size_t g   = (x * extent_y) + y;
+        int    exp = (g < begin || g >= end) ? -1 : (x * 1000) + y;
+        EXPECT_EQ_U(exp, static_cast<int>(matrix_b[x][y]));
+      }
+    }
+  }
+  matrix_b.barrier();
+
+  // Range in view of columns:
+  std::fill(matrix_b.lbegin(), matrix_b.lend(), -1);
+  matrix_b.barrier();
+  auto view_a = matrix_a.sub<1>(1, extent_y - 2);
+  auto view_b = matrix_b.sub<1>(1, extent_y - 2);
+  dash::copy_async(view_a.begin(), view_a.end(), view_b.begin()).get();
+  matrix_b.barrier();
+
+  if (_dash_id == 0) {
+    for (size_t x = 0; x < extent_x; ++x) {
+      for (size_t y = 0; y < extent_y; ++y) {
+        int exp = (y < 1 || y >= extent_y - 1) ? -1 : (x * 1000) + y;
+        EXPECT_EQ_U(exp, static_cast<int>(matrix_b[x][y]));
+      }
+    }
+  }
+  matrix_b.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
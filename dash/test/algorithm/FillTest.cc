@@ -42,3 +42,29 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(FillTest, ExecutionPolicies)
+{
+  typedef int                                           Element_t;
+  typedef dash::Array<Element_t>                        Array_t;
+
+  // Large enough for the local range to be filled by several threads:
+  size_t num_local_elem = 3 * 16384 + 7;
+  Array_t array(num_local_elem * dash::size());
+
+  dash::fill(dash::execution::par, array.begin(), array.end(), 23);
+  array.barrier();
+  for (auto l = array.lbegin(); l != array.lend(); ++l) {
+    EXPECT_EQ_U(23, *l);
+  }
+  array.barrier();
+
+  // Subrange spanning units, elements outside the range are unchanged:
+  dash::fill(dash::execution::seq, array.begin() + 5, array.end() - 5, 42);
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    auto g = array.pattern().global(l);
+    bool in_range = (g >= 5 && g < array.size() - 5);
+    EXPECT_EQ_U(in_range ? 42 : 23, array.local[l]);
+  }
+}
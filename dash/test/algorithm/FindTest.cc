@@ -4,6 +4,7 @@
 #include <dash/Team.h>
 #include <dash/Array.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/Fill.h>
 
 #include <limits>
 
@@ -320,3 +321,42 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, ExecutionPolicies)
+{
+  // Large enough for the local range to be searched by several threads:
+  size_t  num_local_elem = 4 * 16384;
+  Array_t array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Matches at the end of the first unit's range and in the following
+  // units, the first match must be found:
+  index_t first_pos = num_local_elem - 100;
+  if (dash::myid() == 0) {
+    array[first_pos] = 1;
+    for (size_t u = 1; u < dash::size(); ++u) {
+      array[u * num_local_elem + 17] = 1;
+    }
+  }
+  array.barrier();
+
+  auto found_par = dash::find(dash::execution::par,
+                              array.begin(), array.end(), 1);
+  EXPECT_EQ_U(first_pos, found_par - array.begin());
+  auto found_seq = dash::find(dash::execution::seq,
+                              array.begin(), array.end(), 1);
+  EXPECT_EQ_U(first_pos, found_seq - array.begin());
+
+  auto found_if = dash::find_if(dash::execution::par,
+                                array.begin(), array.end(),
+                                [](int v) { return v > 0; });
+  EXPECT_EQ_U(first_pos, found_if - array.begin());
+  auto found_if_not = dash::find_if_not(array.begin(), array.end(),
+                                        [](int v) { return v == 0; });
+  EXPECT_EQ_U(first_pos, found_if_not - array.begin());
+
+  auto not_found = dash::find(dash::execution::par,
+                              array.begin(), array.end(), 2);
+  EXPECT_EQ_U(array.end(), not_found);
+}
@@ -166,3 +166,38 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, ExecutionPolicies)
+{
+  // Large enough for the local range to be processed by several threads:
+  size_t num_local_elem = 2 * 16384 + 11;
+  dash::Array<index_t> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), -1);
+
+  // Subrange starting in the local range of unit 0:
+  auto first = array.begin() + 3;
+  auto last  = array.end()   - 3;
+  dash::for_each_with_index(
+    dash::execution::par, first, last,
+    [](index_t & el, index_t gindex) {
+      el = gindex;
+    });
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    index_t g = array.pattern().global(l);
+    bool in_range = (g >= 3 && g < static_cast<index_t>(array.size()) - 3);
+    EXPECT_EQ_U(in_range ? g : -1, array.local[l]);
+  }
+  array.barrier();
+
+  dash::for_each(dash::execution::par, first, last,
+                 [](index_t & el) {
+                   el *= 2;
+                 });
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    index_t g = array.pattern().global(l);
+    bool in_range = (g >= 3 && g < static_cast<index_t>(array.size()) - 3);
+    EXPECT_EQ_U(in_range ? 2 * g : -1, array.local[l]);
+  }
+}
@@ -0,0 +1,92 @@
+
+#include "GatherTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Gather.h>
+
+#include <vector>
+
+
+TEST_F(GatherTest, GatherIndices)
+{
+  Array_t array(_num_elem * dash::size(), dash::BLOCKCYCLIC(7));
+  for (index_t l = 0; l < static_cast<index_t>(array.lsize()); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  // scattered indices in descending order including duplicates
+  std::vector<index_t> indices;
+  for (index_t i = array.size() - 1 - dash::myid(); i >= 0; i -= 5) {
+    indices.push_back(i);
+    if (i % 3 == 0) {
+      indices.push_back(i);
+    }
+  }
+  std::vector<Element_t> values(indices.size(), -1);
+  auto out_last = dash::gather(array, indices, values.data());
+  ASSERT_EQ_U(values.data() + values.size(), out_last);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ASSERT_EQ_U(indices[i], values[i]);
+  }
+
+  // indices relative to an iterator
+  Element_t value = -1;
+  index_t   idx   = 2;
+  dash::gather(array.begin() + 10, &idx, &idx + 1, &value);
+  ASSERT_EQ_U(12, value);
+
+  array.barrier();
+}
+
+TEST_F(GatherTest, ScatterIndices)
+{
+  Array_t array(_num_elem * dash::size(), dash::BLOCKCYCLIC(7));
+  std::fill(array.lbegin(), array.lend(), -1);
+  array.barrier();
+
+  // every unit writes the elements with index i % size == myid
+  std::vector<index_t>   indices;
+  std::vector<Element_t> values;
+  for (index_t i = array.size() - 1; i >= 0; --i) {
+    if (i % dash::size() == dash::myid()) {
+      indices.push_back(i);
+      values.push_back(i * 2);
+    }
+  }
+  dash::scatter(array, indices, values.data());
+  array.barrier();
+
+  for (index_t l = 0; l < static_cast<index_t>(array.lsize()); ++l) {
+    ASSERT_EQ_U(array.pattern().global(l) * 2, array.local[l]);
+  }
+}
+
+TEST_F(GatherTest, GatherStruct)
+{
+  struct point_t {
+    int  x;
+    int  y;
+    char tag;
+  };
+  dash::Array<point_t> array(_num_elem * dash::size());
+  for (index_t l = 0; l < static_cast<index_t>(array.lsize()); ++l) {
+    int gidx = array.pattern().global(l);
+    array.local[l] = point_t { gidx, -gidx, static_cast<char>(gidx % 100) };
+  }
+  array.barrier();
+
+  std::vector<int> indices;
+  for (int i = dash::myid(); i < static_cast<int>(array.size()); i += 13) {
+    indices.push_back(i);
+  }
+  std::vector<point_t> values(indices.size());
+  dash::gather(array, indices, values.data());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ASSERT_EQ_U(indices[i],  values[i].x);
+    ASSERT_EQ_U(-indices[i], values[i].y);
+    ASSERT_EQ_U(indices[i] % 100, values[i].tag);
+  }
+
+  array.barrier();
+}
@@ -3,6 +3,7 @@
 
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/Array.h>
 #include <dash/Matrix.h>
 
@@ -159,6 +160,31 @@ TEST_F(MinElementTest, TestFindArrayUnderfilled)
   EXPECT_EQ(min_value, found_min);
 }
 
+TEST_F(MinElementTest, TestFindFirstOccurrenceCyclic)
+{
+  // Every unit holds the minimum value, the first occurrence in global
+  // order must be found irrespective of the unit order:
+  dash::Array<int> array(4 * dash::size(), dash::CYCLIC);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    auto g = array.pattern().global(l);
+    array.local[l] = (g < 1 || g % 3 != 1) ? 100 + static_cast<int>(g) : 5;
+  }
+  array.barrier();
+
+  auto min_it = dash::min_element(array.begin(), array.end());
+  EXPECT_EQ_U(1, min_it.gpos());
+  EXPECT_EQ_U(5, static_cast<int>(*min_it));
+
+  // The maximum is at the last position that does not hold the minimum:
+  size_t max_pos = array.size() - 1;
+  while (max_pos % 3 == 1) {
+    --max_pos;
+  }
+  auto max_it = dash::max_element(array.begin(), array.end());
+  EXPECT_EQ_U(max_pos, max_it.gpos());
+  EXPECT_EQ_U(100 + static_cast<int>(max_pos), static_cast<int>(*max_it));
+}
+
 TEST_F(MinElementTest, TestShrinkRange)
 {
   dash::Array<int> arr(100);
@@ -271,3 +297,31 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, ExecutionPolicies)
+{
+  // Large enough for the local range to be searched by several threads:
+  size_t num_local_elem = 4 * 16384;
+  dash::Array<int> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 10);
+  array.barrier();
+
+  // Several occurrences of the minimum, the first one must be found:
+  index_t first_pos = num_local_elem / 2 + 1;
+  if (dash::myid() == 0) {
+    array[first_pos]          = 1;
+    array[num_local_elem - 1] = 1;
+    array[array.size() - 1]   = 1;
+  }
+  array.barrier();
+
+  auto min_par = dash::min_element(dash::execution::par,
+                                   array.begin(), array.end());
+  EXPECT_EQ_U(first_pos, min_par - array.begin());
+  auto min_seq = dash::min_element(dash::execution::seq,
+                                   array.begin(), array.end());
+  EXPECT_EQ_U(first_pos, min_seq - array.begin());
+  auto max_par = dash::max_element(dash::execution::par,
+                                   array.begin(), array.end());
+  EXPECT_EQ_U(0, max_par - array.begin());
+}
@@ -0,0 +1,161 @@
+#include "ReduceTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Accumulate.h>
+
+#include <limits>
+
+
+TEST_F(ReduceTest, SumAtAllUnits)
+{
+  // Large enough for local reduction in several threads:
+  size_t num_local_elem = 100003;
+
+  dash::Array<int> array(num_local_elem * dash::size());
+  for (auto l = array.lbegin(); l != array.lend(); ++l) {
+    *l = 3;
+  }
+  array.barrier();
+
+  // Result type follows the initial value, sum exceeds int range:
+  long init   = std::numeric_limits<int>::max();
+  long result = dash::reduce(array.begin(), array.end(), init);
+  EXPECT_EQ_U(init + 3l * array.size(), result);
+
+  // Accumulate returns the result at all units:
+  double d_result = dash::accumulate(array.begin(), array.end(), 0.5);
+  EXPECT_EQ_U(0.5 + 3.0 * array.size(), d_result);
+}
+
+TEST_F(ReduceTest, TransformReduceEmptyUnits)
+{
+  // Fewer elements than units, some units have no local elements:
+  size_t num_elem = dash::size() > 1 ? dash::size() - 1 : 1;
+
+  dash::Array<double> array(num_elem, dash::CYCLIC);
+  if (array.lsize() > 0) {
+    array.local[0] = static_cast<double>(dash::myid() + 1);
+  }
+  array.barrier();
+
+  double sum_sq = dash::transform_reduce(
+                    array.begin(), array.end(), 0.0,
+                    dash::plus<double>(),
+                    [](double x) { return x * x; });
+  double exp_sum_sq = 0;
+  for (size_t u = 0; u < num_elem; ++u) {
+    exp_sum_sq += (u + 1) * (u + 1);
+  }
+  EXPECT_EQ_U(exp_sum_sq, sum_sq);
+
+  double min = dash::reduce(array.begin(), array.end(),
+                            std::numeric_limits<double>::max(),
+                            dash::min<double>());
+  double max = dash::reduce(array.begin(), array.end(),
+                            0.0,
+                            dash::max<double>());
+  EXPECT_EQ_U(1.0, min);
+  EXPECT_EQ_U(static_cast<double>(num_elem), max);
+
+  double prod = dash::reduce(array.begin(), array.end(),
+                             2.0,
+                             dash::multiply<double>());
+  double exp_prod = 2.0;
+  for (size_t u = 0; u < num_elem; ++u) {
+    exp_prod *= (u + 1);
+  }
+  EXPECT_EQ_U(exp_prod, prod);
+}
+
+TEST_F(ReduceTest, CustomOperation)
+{
+  size_t num_local_elem = 1000;
+
+  dash::Array<int> array(num_local_elem * dash::size(),
+                         dash::BLOCKCYCLIC(7));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<int>(array.pattern().global(l));
+  }
+  array.barrier();
+
+  // Operation without corresponding DART operation:
+  auto result = dash::reduce(array.begin(), array.end(), 0l,
+                             [](long a, long b) {
+                               return (a > b) ? a : b;
+                             });
+  EXPECT_EQ_U(static_cast<long>(array.size() - 1), result);
+
+  long count_even = dash::transform_reduce(
+                      array.begin(), array.end(), 0l,
+                      dash::plus<long>(),
+                      [](int x) -> long { return (x % 2 == 0) ? 1 : 0; });
+  EXPECT_EQ_U(static_cast<long>(array.size() / 2), count_even);
+}
+
+TEST_F(ReduceTest, StructValueType)
+{
+  typedef struct {
+    double value;
+    long   index;
+  } arg_max_t;
+
+  dash::Array<double> array(100 * dash::size(), dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    auto g = array.pattern().global(l);
+    array.local[l] = static_cast<double>((g * 37) % array.size());
+  }
+  array.barrier();
+
+  arg_max_t init;
+  init.value = -1.0;
+  init.index = -1;
+  // Reduction of a struct type, combined in a single allreduce with a
+  // user-defined DART operation:
+  arg_max_t result = dash::transform_reduce(
+                       array.begin(), array.end(), init,
+                       [](const arg_max_t & a, const arg_max_t & b) {
+                         return (a.value >= b.value) ? a : b;
+                       },
+                       [](const double & x) {
+                         arg_max_t v;
+                         v.value = x;
+                         v.index = 0;
+                         return v;
+                       });
+  EXPECT_EQ_U(static_cast<double>(array.size() - 1), result.value);
+}
+
+TEST_F(ReduceTest, ExecutionPolicies)
+{
+  // Large enough for local reduction in several threads:
+  size_t num_local_elem = 4 * 16384 + 3;
+  dash::Array<long> array(num_local_elem * dash::size());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  long n        = array.size();
+  long expected = n * (n - 1) / 2;
+  EXPECT_EQ_U(expected,
+              dash::reduce(dash::execution::par,
+                           array.begin(), array.end(), 0L));
+  EXPECT_EQ_U(expected,
+              dash::reduce(dash::execution::seq,
+                           array.begin(), array.end(), 0L));
+  EXPECT_EQ_U(expected + 1,
+              dash::accumulate(dash::execution::par,
+                               array.begin(), array.end(), 1L));
+
+  // results of threads must not be packed in std::vector<bool>
+  auto all_of = [](bool lhs, bool rhs) { return lhs && rhs; };
+  EXPECT_TRUE_U(
+    dash::transform_reduce(dash::execution::par,
+                           array.begin(), array.end(), true, all_of,
+                           [](long x) { return x >= 0; }));
+  EXPECT_FALSE_U(
+    dash::transform_reduce(dash::execution::par,
+                           array.begin(), array.end(), true, all_of,
+                           [n](long x) { return x != n - 1; }));
+}
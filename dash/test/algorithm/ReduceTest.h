@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__REDUCE_TEST_H_
+#define DASH__TEST__REDUCE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::reduce and dash::transform_reduce.
+ */
+class ReduceTest : public dash::test::TestBase {
+protected:
+
+  ReduceTest() {
+  }
+
+  virtual ~ReduceTest() {
+  }
+};
+#endif // DASH__TEST__REDUCE_TEST_H_
@@ -0,0 +1,162 @@
+#include "ScanTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Scan.h>
+
+
+TEST_F(ScanTest, InclusiveInPlace)
+{
+  // Large enough for local scans in several threads:
+  size_t num_local_elem = 100003;
+
+  dash::Array<long> array(num_local_elem * dash::size());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l) % 7;
+  }
+  array.barrier();
+
+  auto out_last = dash::inclusive_scan(array.begin(), array.end(),
+                                       array.begin());
+  EXPECT_EQ_U(array.end(), out_last);
+
+  // Validate local elements and last element of preceding unit:
+  long exp = 0;
+  auto g_first = array.pattern().global(0);
+  for (size_t g = 0; g < g_first; ++g) {
+    exp += g % 7;
+  }
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    exp += (g_first + l) % 7;
+    ASSERT_EQ_U(exp, array.local[l]);
+  }
+}
+
+TEST_F(ScanTest, ExclusiveOutOfPlaceSubrange)
+{
+  size_t num_local_elem = 1000;
+  size_t num_elem       = num_local_elem * dash::size();
+
+  dash::Array<int>    in(num_elem);
+  dash::Array<double> out(num_elem);
+  for (auto l = in.lbegin(); l != in.lend(); ++l) {
+    *l = 2;
+  }
+  for (auto l = out.lbegin(); l != out.lend(); ++l) {
+    *l = -1;
+  }
+  in.barrier();
+
+  size_t begin = num_local_elem / 2;
+  size_t end   = num_elem - 3;
+  dash::exclusive_scan(in.begin() + begin, in.begin() + end,
+                       out.begin() + begin, 10.0);
+
+  if (dash::myid() == 0) {
+    std::vector<double> values(out.begin(), out.end());
+    for (size_t g = 0; g < num_elem; ++g) {
+      double exp = (g < begin || g >= end) ? -1.0 : 10.0 + 2.0 * (g - begin);
+      ASSERT_EQ_U(exp, values[g]);
+    }
+  }
+  out.barrier();
+}
+
+TEST_F(ScanTest, BlockCyclicOperations)
+{
+  size_t num_local_elem = 997;
+  size_t num_elem       = num_local_elem * dash::size();
+
+  dash::Array<int> in(num_elem, dash::BLOCKCYCLIC(13));
+  dash::Array<int> out(num_elem, dash::BLOCKCYCLIC(13));
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    in.local[l] = (in.pattern().global(l) * 7919) % 1009;
+  }
+  in.barrier();
+
+  std::vector<int> values(in.begin(), in.end());
+
+  // Prefix sum of blocks in unit order is not sufficient:
+  dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  if (dash::myid() == 0) {
+    std::vector<int> result(out.begin(), out.end());
+    int exp = 0;
+    for (size_t g = 0; g < num_elem; ++g) {
+      exp += values[g];
+      ASSERT_EQ_U(exp, result[g]);
+    }
+  }
+  out.barrier();
+
+  // Operation without corresponding DART operation:
+  dash::exclusive_scan(in.begin() + 5, in.end(), out.begin() + 5, 0,
+                       [](int a, int b) { return std::max(a, b); });
+  if (dash::myid() == 0) {
+    std::vector<int> result(out.begin(), out.end());
+    int exp = 0;
+    for (size_t g = 5; g < num_elem; ++g) {
+      ASSERT_EQ_U(exp, result[g]);
+      exp = std::max(exp, values[g]);
+    }
+  }
+  out.barrier();
+}
+
+namespace {
+
+/// Affine map x -> a * x + b modulo a prime, composition of affine maps is
+/// associative but not commutative.
+struct Affine {
+  long a;
+  long b;
+};
+
+bool operator==(const Affine & lhs, const Affine & rhs) {
+  return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+std::ostream & operator<<(std::ostream & os, const Affine & f) {
+  return os << "Affine(" << f.a << "," << f.b << ")";
+}
+
+struct AffineCompose {
+  Affine operator()(const Affine & f, const Affine & g) const {
+    Affine h;
+    h.a = (f.a * g.a) % 1009;
+    h.b = (g.a * f.b + g.b) % 1009;
+    return h;
+  }
+};
+
+} // namespace
+
+TEST_F(ScanTest, CustomOperationOrder)
+{
+  size_t num_local_elem = 211;
+  size_t num_elem       = num_local_elem * dash::size();
+
+  for (auto dist : { dash::BLOCKED, dash::CYCLIC, dash::BLOCKCYCLIC(7) }) {
+    dash::Array<Affine> array(num_elem, dist);
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      auto g = array.pattern().global(l);
+      array.local[l] = Affine { static_cast<long>(g % 13 + 1),
+                                static_cast<long>(g % 17) };
+    }
+    array.barrier();
+
+    std::vector<Affine> values(array.begin(), array.end());
+    array.barrier();
+
+    dash::inclusive_scan(array.begin(), array.end(), array.begin(),
+                         AffineCompose());
+    if (dash::myid() == 0) {
+      std::vector<Affine> result(array.begin(), array.end());
+      Affine exp = values[0];
+      ASSERT_EQ_U(exp, result[0]);
+      for (size_t g = 1; g < num_elem; ++g) {
+        exp = AffineCompose()(exp, values[g]);
+        ASSERT_EQ_U(exp, result[g]);
+      }
+    }
+    array.barrier();
+  }
+}
@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__SCAN_TEST_H_
+#define DASH__TEST__SCAN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::inclusive_scan and dash::exclusive_scan.
+ */
+class ScanTest : public dash::test::TestBase {
+protected:
+
+  ScanTest() {
+  }
+
+  virtual ~ScanTest() {
+  }
+};
+#endif // DASH__TEST__SCAN_TEST_H_
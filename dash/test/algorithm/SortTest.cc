@@ -0,0 +1,110 @@
+#include "SortTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Sort.h>
+
+#include <functional>
+#include <cstdlib>
+
+
+template <typename ArrayType, typename Compare>
+static void check_sorted(ArrayType & array, Compare compare)
+{
+  typedef typename ArrayType::value_type value_t;
+  if (dash::myid() == 0) {
+    std::vector<value_t> values(array.begin(), array.end());
+    for (size_t i = 1; i < values.size(); ++i) {
+      EXPECT_FALSE_U(compare(values[i], values[i-1]));
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, BlockedRandom)
+{
+  typedef int                    Element_t;
+  typedef dash::Array<Element_t> Array_t;
+
+  // Using a prime to cause inconvenient strides and underfilled blocks:
+  size_t num_local_elem = 10007;
+
+  Array_t array(num_local_elem * dash::size());
+
+  std::srand(dash::myid() + 1);
+  long long l_sum = 0;
+  for (auto l = array.lbegin(); l != array.lend(); ++l) {
+    *l     = std::rand() % 10000;
+    l_sum += *l;
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  check_sorted(array, std::less<Element_t>());
+  // Elements are permuted:
+  long long sum = 0;
+  for (auto l = array.lbegin(); l != array.lend(); ++l) {
+    sum += *l;
+  }
+  long long g_sum_before = 0;
+  long long g_sum_after  = 0;
+  dart_allreduce(&l_sum, &g_sum_before, 1, DART_TYPE_LONGLONG,
+                 DART_OP_SUM, dash::Team::All().dart_id());
+  dart_allreduce(&sum, &g_sum_after, 1, DART_TYPE_LONGLONG,
+                 DART_OP_SUM, dash::Team::All().dart_id());
+  EXPECT_EQ_U(g_sum_before, g_sum_after);
+}
+
+TEST_F(SortTest, DuplicatesCompare)
+{
+  typedef double                 Element_t;
+  typedef dash::Array<Element_t> Array_t;
+
+  size_t num_local_elem = 1000;
+
+  Array_t array(num_local_elem * dash::size() + 3);
+
+  // Few distinct values, all units start with the same sequence:
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<Element_t>(li % 5);
+  }
+  array.barrier();
+
+  // Sort in descending order:
+  dash::sort(array.begin(), array.end(), std::greater<Element_t>());
+
+  check_sorted(array, std::greater<Element_t>());
+}
+
+TEST_F(SortTest, CyclicSubrange)
+{
+  typedef int                    Element_t;
+  typedef dash::Array<Element_t> Array_t;
+
+  size_t num_local_elem = 1001;
+  size_t size           = num_local_elem * dash::size();
+
+  Array_t array(size, dash::CYCLIC);
+
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<Element_t>(
+                        array.pattern().global(li) * 7919 % 10007);
+  }
+  array.barrier();
+
+  // Sort range excluding the first and last elements:
+  size_t offset = 3;
+  dash::sort(array.begin() + offset, array.end() - offset);
+
+  if (dash::myid() == 0) {
+    std::vector<Element_t> values(array.begin(), array.end());
+    for (size_t i = 0; i < offset; ++i) {
+      EXPECT_EQ_U(i * 7919 % 10007, values[i]);
+      EXPECT_EQ_U((size - 1 - i) * 7919 % 10007, values[size - 1 - i]);
+    }
+    for (size_t i = offset + 1; i < size - offset; ++i) {
+      EXPECT_LE_U(values[i-1], values[i]);
+    }
+  }
+  array.barrier();
+}
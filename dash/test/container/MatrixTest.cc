@@ -736,13 +736,24 @@ TEST_F(MatrixTest, BlockCopy)
   LOG_MESSAGE("Team barrier passed");
 
   // Copy block 1 of matrix_a to block 0 of matrix_b:
-  dash::copy<element_t>(matrix_a.block(1).begin(),
-                        matrix_a.block(1).end(),
-                        matrix_b.block(0).begin());
+  dash::copy(matrix_a.block(1).begin(),
+             matrix_a.block(1).end(),
+             matrix_b.block(0).begin());
 
   LOG_MESSAGE("Wait for team barrier ...");
   dash::barrier();
   LOG_MESSAGE("Team barrier passed");
+
+  if (myid == 0) {
+    auto block_a = matrix_a.block(1);
+    auto block_b = matrix_b.block(0);
+    auto nelem   = block_a.end() - block_a.begin();
+    for (auto i = 0; i < nelem; ++i) {
+      EXPECT_EQ_U(static_cast<element_t>(*(block_a.begin() + i)),
+                  static_cast<element_t>(*(block_b.begin() + i)));
+    }
+  }
+  dash::barrier();
 }
 
 TEST_F(MatrixTest, StorageOrder)
@@ -543,3 +543,239 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, HashIndexLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  // Exceeds initial capacity of hash indices to enforce rehashing:
+  int local_elements = 1000;
+
+  map_t map;
+
+  // Insert elements in two rounds with a commit in between, the global
+  // hash index is reallocated in every commit:
+  for (int round = 0; round < 2; ++round) {
+    for (int li = round * local_elements;
+         li < (round + 1) * local_elements; ++li) {
+      key_t    key    = (nunits * li) + myid;
+      mapped_t mapped = 1.0 * key;
+      auto     insert = map.local.insert(map_value(key, mapped));
+      EXPECT_TRUE_U(insert.second);
+      EXPECT_NE_U(map.local.end(), map.local.find(key));
+    }
+    map.barrier();
+
+    int nelem = (round + 1) * local_elements;
+    EXPECT_EQ_U(nunits * nelem, map.size());
+    // Look up elements of every unit, starting at the next unit:
+    for (int u_off = 1; u_off <= nunits; ++u_off) {
+      int unit = (myid + u_off) % nunits;
+      for (int li = 0; li < nelem; li += 7) {
+        key_t key   = (nunits * li) + unit;
+        auto  found = map.find(key);
+        ASSERT_NE_U(map.end(), found);
+        map_value value = *found;
+        EXPECT_EQ_U(key,       value.first);
+        EXPECT_EQ_U(1.0 * key, value.second);
+        EXPECT_EQ_U(unit,      found.lpos().unit);
+      }
+      // Keys not contained in the map:
+      EXPECT_EQ_U(0, map.count((nunits * (nelem + 1)) + unit));
+    }
+    dash::barrier();
+  }
+}
+
+TEST_F(UnorderedMapTest, HashIndexLookupNonOwner)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  if (dash::size() < 2) {
+    LOG_MESSAGE(
+      "UnorderedMapTest.HashIndexLookupNonOwner requires at least two units");
+    return;
+  }
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int local_elements = 100;
+
+  map_t map;
+
+  // Insert keys mapped to the next unit by the hash function, elements are
+  // moved to the mapped unit in the commit:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key    = (nunits * li) + ((myid + 1) % nunits);
+    auto  insert = map.insert(map_value(key, 1.0 * key));
+    EXPECT_TRUE_U(insert.second);
+  }
+  EXPECT_EQ_U(local_elements, map.lsize());
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(local_elements, map.lsize());
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, value.first % nunits);
+  }
+
+  for (int unit = 0; unit < nunits; ++unit) {
+    int owner = (unit + 1) % nunits;
+    for (int li = 0; li < local_elements; li += 3) {
+      key_t key   = (nunits * li) + owner;
+      auto  found = map.find(key);
+      ASSERT_NE_U(map.end(), found);
+      map_value value = *found;
+      EXPECT_EQ_U(key,       value.first);
+      EXPECT_EQ_U(1.0 * key, value.second);
+      EXPECT_EQ_U(owner,     found.lpos().unit);
+    }
+  }
+  dash::barrier();
+
+  // Repeated insertion of keys inserted by other units:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key    = (nunits * li) + ((myid + 2) % nunits);
+    auto  insert = map.insert(map_value(key, -1.0));
+    EXPECT_FALSE_U(insert.second);
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Insertion of the same keys by all units before commit, duplicates are
+  // merged at the mapped unit:
+  for (int unit = 0; unit < nunits; ++unit) {
+    key_t key    = (nunits * local_elements) + unit;
+    auto  insert = map.insert(map_value(key, 1.0 * key));
+    EXPECT_TRUE_U(insert.second);
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * (local_elements + 1), map.size());
+  EXPECT_EQ_U(local_elements + 1, map.lsize());
+  EXPECT_EQ_U(1, map.count((nunits * local_elements) + myid));
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits   = dash::size();
+  int myid     = dash::myid().id;
+  int nkeys    = 1000 * nunits;
+
+  map_t map;
+
+  // Every unit inserts all keys in the first half of the key range,
+  // every key is inserted by all units and at most once in the map:
+  std::vector<map_value> values;
+  for (int k = 0; k < nkeys / 2; ++k) {
+    values.push_back(map_value(k, 1.0 * k));
+  }
+  // Duplicate keys in values of a single unit:
+  values.push_back(map_value(0, 0.0));
+  auto ninserted = map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(nkeys / 2, map.size());
+  EXPECT_EQ_U(map.lsize(), ninserted);
+
+  // Second insertion with keys partially contained in the map, keys in
+  // the second half of the key range are inserted by a single unit:
+  values.clear();
+  for (int k = 0; k < nkeys; ++k) {
+    if (k >= nkeys / 2 && k % nunits != (myid + 1) % nunits) {
+      continue;
+    }
+    values.push_back(map_value(k, 1.0 * k));
+  }
+  map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(nkeys, map.size());
+  EXPECT_EQ_U(nkeys / nunits, map.lsize());
+  EXPECT_EQ_U(nkeys / nunits,
+              std::distance(map.local.begin(), map.local.end()));
+
+  for (int k = 0; k < nkeys; k += 3) {
+    auto found = map.find(k);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(k,       value.first);
+    EXPECT_EQ_U(1.0 * k, value.second);
+    EXPECT_EQ_U(k % nunits, found.lpos().unit);
+  }
+  EXPECT_EQ_U(0, map.count(nkeys));
+  dash::barrier();
+}
+
+TEST_F(UnorderedMapTest, BulkInsertNonOwner)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  if (dash::size() < 2) {
+    LOG_MESSAGE(
+      "UnorderedMapTest.BulkInsertNonOwner requires at least two units");
+    return;
+  }
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int local_elements = 100;
+
+  map_t map;
+
+  // Keys mapped to the next unit by the hash function:
+  std::vector<map_value> values;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + ((myid + 1) % nunits);
+    values.push_back(map_value(key, 1.0 * key));
+  }
+  // Insert committed keys at non-owner, bulk insert same keys at all units:
+  for (const auto & value : values) {
+    EXPECT_TRUE_U(map.insert(value).second);
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(0, map.bulk_insert(values.begin(), values.end()));
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(local_elements, map.lsize());
+
+  // Insert uncommitted keys at non-owner, bulk insert same keys at all
+  // units:
+  values.clear();
+  for (int li = local_elements; li < 2 * local_elements; ++li) {
+    key_t key = (nunits * li) + ((myid + 1) % nunits);
+    values.push_back(map_value(key, 1.0 * key));
+  }
+  for (const auto & value : values) {
+    EXPECT_TRUE_U(map.insert(value).second);
+  }
+  map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(2 * nunits * local_elements, map.size());
+  EXPECT_EQ_U(2 * local_elements, map.lsize());
+
+  for (int li = 0; li < 2 * local_elements; li += 3) {
+    key_t key   = (nunits * li) + myid;
+    auto  found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(key,       value.first);
+    EXPECT_EQ_U(1.0 * key, value.second);
+    EXPECT_EQ_U(myid,      found.lpos().unit);
+  }
+  dash::barrier();
+}
@@ -50,3 +50,190 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+TEST_F(DARTCollectiveTest, ScanExscan) {
+  int value = _dash_id + 1;
+  int scan_result;
+  int exscan_result;
+  dart_scan(&value, &scan_result, 1, DART_TYPE_INT, DART_OP_SUM,
+            DART_TEAM_ALL);
+  dart_exscan(&value, &exscan_result, 1, DART_TYPE_INT, DART_OP_SUM,
+              DART_TEAM_ALL);
+  int exp = 0;
+  for (size_t u = 0; u < _dash_id; ++u) {
+    exp += u + 1;
+  }
+  ASSERT_EQ(exp + value, scan_result);
+  if (_dash_id > 0) {
+    ASSERT_EQ(exp, exscan_result);
+  }
+}
+
+TEST_F(DARTCollectiveTest, NonblockingCollectives) {
+  dart_handle_t handles[3];
+
+  int bcast_value = (_dash_id == 0) ? 42 : 0;
+  dart_team_unit_t root = { 0 };
+  ASSERT_EQ(DART_OK,
+            dart_ibcast(&bcast_value, 1, DART_TYPE_INT, root,
+                        DART_TEAM_ALL, &handles[0]));
+
+  int value = _dash_id + 1;
+  int sum   = 0;
+  ASSERT_EQ(DART_OK,
+            dart_iallreduce(&value, &sum, 1, DART_TYPE_INT, DART_OP_SUM,
+                            DART_TEAM_ALL, &handles[1]));
+
+  std::vector<int> values(_dash_size);
+  ASSERT_EQ(DART_OK,
+            dart_iallgather(&value, values.data(), 1, DART_TYPE_INT,
+                            DART_TEAM_ALL, &handles[2]));
+
+  ASSERT_EQ(DART_OK, dart_waitall_local(handles, 3));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(DART_HANDLE_NULL, handles[i]);
+  }
+  ASSERT_EQ(42, bcast_value);
+  ASSERT_EQ(static_cast<int>(_dash_size * (_dash_size + 1) / 2), sum);
+  for (size_t u = 0; u < _dash_size; ++u) {
+    ASSERT_EQ(static_cast<int>(u + 1), values[u]);
+  }
+
+  dart_handle_t barrier_handle;
+  ASSERT_EQ(DART_OK, dart_ibarrier(DART_TEAM_ALL, &barrier_handle));
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ(DART_OK, dart_test_local(&barrier_handle, &finished));
+  }
+  ASSERT_EQ(DART_HANDLE_NULL, barrier_handle);
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  // unit u sends (u + 1) values to every unit
+  std::vector<size_t> send_counts(_dash_size, _dash_id + 1);
+  std::vector<size_t> send_displs(_dash_size);
+  std::vector<size_t> recv_counts(_dash_size);
+  std::vector<size_t> recv_displs(_dash_size);
+  std::vector<int>    send_values;
+  size_t nrecv = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    send_displs[u] = send_values.size();
+    for (size_t e = 0; e <= _dash_id; ++e) {
+      send_values.push_back(_dash_id * 100 + u);
+    }
+    recv_counts[u] = u + 1;
+    recv_displs[u] = nrecv;
+    nrecv         += recv_counts[u];
+  }
+  std::vector<int> recv_values(nrecv);
+  ASSERT_EQ(DART_OK,
+            dart_alltoallv(send_values.data(), send_counts.data(),
+                           send_displs.data(), recv_values.data(),
+                           recv_counts.data(), recv_displs.data(),
+                           DART_TYPE_INT, DART_TEAM_ALL));
+  for (size_t u = 0; u < _dash_size; ++u) {
+    for (size_t e = 0; e < recv_counts[u]; ++e) {
+      ASSERT_EQ(static_cast<int>(u * 100 + _dash_id),
+                recv_values[recv_displs[u] + e]);
+    }
+  }
+
+  std::vector<size_t> counts(_dash_size);
+  ASSERT_EQ(DART_OK,
+            dart_alltoall(send_counts.data(), counts.data(), 1,
+                          DART_TYPE_SIZET, DART_TEAM_ALL));
+  ASSERT_EQ(recv_counts, counts);
+}
+
+namespace {
+
+typedef struct {
+  int  value;
+  int  unit;
+} value_unit_t;
+
+/// Keeps the greater value, or the lower unit for equal values
+void max_loc(const void * invec, void * inoutvec, size_t len, void *)
+{
+  const value_unit_t * in    = static_cast<const value_unit_t *>(invec);
+  value_unit_t       * inout = static_cast<value_unit_t *>(inoutvec);
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i].value > inout[i].value ||
+        (in[i].value == inout[i].value && in[i].unit < inout[i].unit)) {
+      inout[i] = in[i];
+    }
+  }
+}
+
+/// Appends the digits of the right operand, not commutative
+void concat(const void * invec, void * inoutvec, size_t len, void * base)
+{
+  const long * in    = static_cast<const long *>(invec);
+  long       * inout = static_cast<long *>(inoutvec);
+  long         b     = *static_cast<long *>(base);
+  for (size_t i = 0; i < len; ++i) {
+    long shift = 1;
+    while (shift <= inout[i]) { shift *= b; }
+    inout[i] = in[i] * shift + inout[i];
+  }
+}
+
+} // namespace
+
+TEST_F(DARTCollectiveTest, UserDefinedOperation) {
+  dart_datatype_t dtype;
+  ASSERT_EQ(DART_OK, dart_type_create_custom(sizeof(value_unit_t), &dtype));
+  dart_operation_t op;
+  ASSERT_EQ(DART_OK, dart_op_create(&max_loc, NULL, true, dtype, &op));
+
+  value_unit_t values[2];
+  values[0].value = (_dash_id * 7) % _dash_size;
+  values[0].unit  = _dash_id;
+  values[1].value = 42;
+  values[1].unit  = _dash_id;
+  value_unit_t results[2];
+  ASSERT_EQ(DART_OK,
+            dart_allreduce(values, results, 2, dtype, op, DART_TEAM_ALL));
+  ASSERT_EQ(static_cast<int>((_dash_id * 7) % _dash_size),
+            values[0].value);
+  int max_value = 0;
+  int max_unit  = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    int value = (u * 7) % _dash_size;
+    if (value > max_value) {
+      max_value = value;
+      max_unit  = u;
+    }
+  }
+  ASSERT_EQ(max_value, results[0].value);
+  ASSERT_EQ(max_unit,  results[0].unit);
+  ASSERT_EQ(42, results[1].value);
+  ASSERT_EQ(0,  results[1].unit);
+
+  // operation is only defined on its data type:
+  ASSERT_EQ(DART_ERR_INVAL,
+            dart_allreduce(values, results, 2, DART_TYPE_INT, op,
+                           DART_TEAM_ALL));
+
+  ASSERT_EQ(DART_OK, dart_op_destroy(&op));
+  ASSERT_EQ(DART_OP_UNDEFINED, op);
+  ASSERT_EQ(DART_OK, dart_type_destroy(&dtype));
+
+  // non-commutative operation, operands are combined in unit order:
+  if (_dash_size < 10) {
+    long base = 10;
+    ASSERT_EQ(DART_OK,
+              dart_op_create(&concat, &base, false, DART_TYPE_LONG, &op));
+    long digit  = _dash_id + 1;
+    long number = 0;
+    ASSERT_EQ(DART_OK,
+              dart_allreduce(&digit, &number, 1, DART_TYPE_LONG, op,
+                             DART_TEAM_ALL));
+    long exp_number = 0;
+    for (size_t u = 0; u < _dash_size; ++u) {
+      exp_number = exp_number * 10 + u + 1;
+    }
+    ASSERT_EQ(exp_number, number);
+    ASSERT_EQ(DART_OK, dart_op_destroy(&op));
+  }
+}
@@ -234,3 +234,108 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, SharedLockConcurrent) {
+  dart_lock_t lock;
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  // all units hold the lock in shared mode at the same time
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_acquire_shared(lock));
+  dash::barrier();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_release_shared(lock));
+  dash::barrier();
+
+  // shared acquisition fails while the lock is held exclusively
+  int32_t acquired;
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_shared(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, SharedExclusiveLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    if ((i + dash::myid()) % 2 == 0) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_acquire(lock));
+      shared.set(shared.get() + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release(lock));
+    } else {
+      int32_t acquired;
+      if (i % 4 == 1) {
+        do {
+          ASSERT_EQ_U(
+            DART_OK,
+            dart_lock_try_acquire_shared(lock, &acquired));
+        } while (!acquired);
+      } else {
+        ASSERT_EQ_U(
+          DART_OK,
+          dart_lock_acquire_shared(lock));
+      }
+      // no writer may modify the value while the lock is held
+      value_t first  = shared.get();
+      value_t second = shared.get();
+      ASSERT_EQ_U(first, second);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release_shared(lock));
+    }
+  }
+  dash::barrier();
+
+  int num_writes = 0;
+  for (int u = 0; u < static_cast<int>(dash::size()); ++u) {
+    for (int i = 0; i < num_iterations; ++i) {
+      num_writes += ((i + u) % 2 == 0);
+    }
+  }
+  ASSERT_EQ_U(num_writes, static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
@@ -2,8 +2,19 @@
 #include "DARTMemAllocTest.h"
 #include <dash/dart/if/dart_communication.h>
 #include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_config.h>
+#include <dash/dart/if/dart_team_group.h>
 #include <dash/Array.h>
 
+#include <algorithm>
+#include <vector>
+
+/**
+ * Size of team heaps created in the tests, large enough to serve all
+ * their allocations.
+ */
+#define DART_TEAM_HEAP_TEST_SIZE (1024 * 1024)
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
 
@@ -97,6 +108,110 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
     dart_memfree(gptr));
 }
 
+TEST_F(DARTMemAllocTest, LocalAllocMixedSizes)
+{
+  typedef char value_t;
+  const size_t num_allocs = 200;
+  // sizes of small blocks and of allocations spanning multiple pages
+  const size_t sizes[]    = { 1, 7, 8, 24, 100, 250, 1000, 3000,
+                              5000, 40000, 70000 };
+  const size_t num_sizes  = sizeof(sizes) / sizeof(sizes[0]);
+
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  std::vector<value_t *>   ptrs(num_allocs);
+  auto fill = [&](size_t i) {
+    size_t nbytes = sizes[i % num_sizes];
+    for (size_t b = 0; b < nbytes; ++b) {
+      ptrs[i][b] = static_cast<value_t>(i);
+    }
+  };
+  auto check = [&](size_t i) {
+    size_t nbytes = sizes[i % num_sizes];
+    for (size_t b = 0; b < nbytes; ++b) {
+      if (ptrs[i][b] != static_cast<value_t>(i)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(sizes[i % num_sizes], DART_TYPE_BYTE, &gptrs[i]));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&ptrs[i]));
+    fill(i);
+  }
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_TRUE_U(check(i));
+  }
+
+  // release every other allocation and reuse the memory
+  for (size_t i = 0; i < num_allocs; i += 2) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+  for (size_t i = 0; i < num_allocs; i += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(sizes[(i + 1) % num_sizes], DART_TYPE_BYTE, &gptrs[i]));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&ptrs[i]));
+    size_t nbytes = sizes[(i + 1) % num_sizes];
+    for (size_t b = 0; b < nbytes; ++b) {
+      ptrs[i][b] = 0;
+    }
+  }
+  for (size_t i = 1; i < num_allocs; i += 2) {
+    ASSERT_TRUE_U(check(i));
+  }
+
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, LocalFreeInvalid)
+{
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(DART_OK, dart_memalloc(24, DART_TYPE_BYTE, &gptr));
+
+  // offset inside the allocated block
+  dart_gptr_t gptr_inner = gptr;
+  gptr_inner.addr_or_offs.offset += 8;
+  EXPECT_EQ_U(DART_ERR_INVAL, dart_memfree(gptr_inner));
+
+  ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+  // double free
+  EXPECT_EQ_U(DART_ERR_INVAL, dart_memfree(gptr));
+
+  // the block is handed out once only
+  dart_gptr_t gptr_1, gptr_2;
+  ASSERT_EQ_U(DART_OK, dart_memalloc(24, DART_TYPE_BYTE, &gptr_1));
+  ASSERT_EQ_U(DART_OK, dart_memalloc(24, DART_TYPE_BYTE, &gptr_2));
+  EXPECT_NE_U(gptr_1.addr_or_offs.offset, gptr_2.addr_or_offs.offset);
+  ASSERT_EQ_U(DART_OK, dart_memfree(gptr_1));
+  ASSERT_EQ_U(DART_OK, dart_memfree(gptr_2));
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocUtilization)
+{
+  // allocations of 3 KiB must not be rounded up to 4 KiB, 4800 of them
+  // occupy 14 MiB of the default pool size of 16 MiB
+  const size_t nbytes     = 3 * 1024;
+  const size_t num_allocs = 4800;
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(nbytes, DART_TYPE_BYTE, &gptrs[i]));
+  }
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+}
 
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
@@ -160,3 +275,225 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+namespace {
+
+/**
+ * Creates a team of all units with a team heap of \c heap_size bytes per
+ * unit, allocations in the new team start at the beginning of its heap.
+ */
+dart_team_t create_heap_team(size_t heap_size)
+{
+  dart_config_t * config;
+  dart_config(&config);
+  size_t default_size    = config->team_heap_size;
+  config->team_heap_size = heap_size;
+
+  dart_group_t group;
+  dart_team_t  team = DART_TEAM_NULL;
+  dart_team_get_group(DART_TEAM_ALL, &group);
+  dart_team_create(DART_TEAM_ALL, group, &team);
+  dart_group_destroy(&group);
+
+  config->team_heap_size = default_size;
+  return team;
+}
+
+/**
+ * Collectively allocates \c nbytes bytes in \c team and returns the local
+ * address of the allocation.
+ */
+char * team_alloc(dart_team_t team, size_t nbytes, dart_gptr_t * gptr)
+{
+  dart_team_unit_t myid;
+  dart_team_myid(team, &myid);
+  char * addr = nullptr;
+  if (dart_team_memalloc_aligned(team, nbytes, DART_TYPE_BYTE, gptr)
+      != DART_OK) {
+    return nullptr;
+  }
+  dart_gptr_t local_gptr = *gptr;
+  dart_gptr_setunit(&local_gptr, myid);
+  dart_gptr_getaddr(local_gptr, (void**)&addr);
+  return addr;
+}
+
+} // namespace
+
+TEST_F(DARTMemAllocTest, TeamHeapReuse)
+{
+  dart_team_t team = create_heap_team(DART_TEAM_HEAP_TEST_SIZE);
+  ASSERT_NE_U(DART_TEAM_NULL, team);
+
+  dart_gptr_t gptr1, gptr2, gptr3;
+  char * addr1 = team_alloc(team, 100, &gptr1);
+  ASSERT_NE_U(nullptr, addr1);
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr1));
+
+  // the released range is handed out again
+  char * addr2 = team_alloc(team, 100, &gptr2);
+  EXPECT_EQ_U(addr1, addr2);
+  // ... to an allocation of a different size
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr2));
+  char * addr3 = team_alloc(team, 10, &gptr3);
+  EXPECT_EQ_U(addr1, addr3);
+
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr3));
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+TEST_F(DARTMemAllocTest, TeamHeapCoalescing)
+{
+  dart_team_t team = create_heap_team(DART_TEAM_HEAP_TEST_SIZE);
+  ASSERT_NE_U(DART_TEAM_NULL, team);
+
+  const size_t nbytes = 128;
+  dart_gptr_t gptr1, gptr2, gptr3, gptr4;
+  char * addr1 = team_alloc(team, nbytes, &gptr1);
+  char * addr2 = team_alloc(team, nbytes, &gptr2);
+  char * addr3 = team_alloc(team, nbytes, &gptr3);
+  ASSERT_EQ_U(addr1 + nbytes,     addr2);
+  ASSERT_EQ_U(addr1 + 2 * nbytes, addr3);
+
+  // free in reverse order, the first block is merged with its successor
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr2));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr1));
+
+  // fits only into the merged blocks in front of the third allocation
+  char * addr4 = team_alloc(team, 2 * nbytes, &gptr4);
+  EXPECT_EQ_U(addr1, addr4);
+
+  // freeing the block between two free blocks merges all three
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr4));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr3));
+  addr4 = team_alloc(team, 3 * nbytes, &gptr4);
+  EXPECT_EQ_U(addr1, addr4);
+
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr4));
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+TEST_F(DARTMemAllocTest, TeamHeapAlignment)
+{
+  dart_team_t team = create_heap_team(DART_TEAM_HEAP_TEST_SIZE);
+  ASSERT_NE_U(DART_TEAM_NULL, team);
+
+  const size_t align = 64;
+  std::vector<size_t>      sizes = { 1, 63, 64, 65, 100, 0, 200 };
+  std::vector<dart_gptr_t> gptrs(sizes.size());
+  std::vector<char *>      addrs(sizes.size());
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    addrs[i] = team_alloc(team, sizes[i], &gptrs[i]);
+    ASSERT_NE_U(nullptr, addrs[i]);
+  }
+  // the first allocation starts at the beginning of the heap, every block
+  // is rounded up to the alignment
+  for (size_t i = 1; i < sizes.size(); ++i) {
+    size_t offset = addrs[i] - addrs[0];
+    EXPECT_EQ_U(0, offset % align);
+    size_t prev_size = std::max<size_t>(
+                         ((sizes[i-1] + align - 1) / align) * align, align);
+    EXPECT_EQ_U(addrs[i-1] + prev_size, addrs[i]);
+  }
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+  }
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+TEST_F(DARTMemAllocTest, TeamHeapWindowFallback)
+{
+  const size_t heap_size = 64 * 1024;
+  dart_team_t  team      = create_heap_team(heap_size);
+  ASSERT_NE_U(DART_TEAM_NULL, team);
+  dart_team_unit_t myid;
+  size_t           team_size;
+  dart_team_myid(team, &myid);
+  dart_team_size(team, &team_size);
+
+  // starts at the beginning of the heap
+  dart_gptr_t gptr_small;
+  char * heap_begin = team_alloc(team, 64, &gptr_small);
+  ASSERT_NE_U(nullptr, heap_begin);
+  char * heap_end   = heap_begin + heap_size;
+
+  // exceeds the maximum size of allocations in the heap
+  const size_t nelem = heap_size / sizeof(int);
+  dart_gptr_t gptr_large;
+  int * large = reinterpret_cast<int *>(
+                  team_alloc(team, nelem * sizeof(int), &gptr_large));
+  ASSERT_NE_U(nullptr, large);
+  char * large_begin = reinterpret_cast<char *>(large);
+  char * large_end   = large_begin + nelem * sizeof(int);
+  EXPECT_TRUE_U(large_end <= heap_begin || large_begin >= heap_end);
+
+  // the heap is not used by the window allocation
+  dart_gptr_t gptr_next;
+  char * next = team_alloc(team, 64, &gptr_next);
+  EXPECT_EQ_U(heap_begin + 64, next);
+
+  // the window allocation is accessible by other units
+  for (size_t i = 0; i < nelem; ++i) {
+    large[i] = -1;
+  }
+  dart_barrier(team);
+  int value = myid.id;
+  dart_gptr_t gptr_right = gptr_large;
+  dart_gptr_setunit(&gptr_right,
+                    DART_TEAM_UNIT_ID((myid.id + 1) % team_size));
+  gptr_right.addr_or_offs.offset += (nelem - 1) * sizeof(int);
+  ASSERT_EQ_U(DART_OK,
+              dart_put_blocking(gptr_right, &value, 1,
+                                DART_TYPE_INT, DART_TYPE_INT));
+  dart_barrier(team);
+  EXPECT_EQ_U((myid.id + team_size - 1) % team_size, large[nelem - 1]);
+  EXPECT_EQ_U(-1, large[0]);
+
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_next));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_large));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_small));
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+TEST_F(DARTMemAllocTest, TeamHeapPendingOperations)
+{
+  dart_team_t team = create_heap_team(DART_TEAM_HEAP_TEST_SIZE);
+  ASSERT_NE_U(DART_TEAM_NULL, team);
+  dart_team_unit_t myid;
+  size_t           team_size;
+  dart_team_myid(team, &myid);
+  dart_team_size(team, &team_size);
+
+  const size_t nelem = 1024;
+  std::vector<int> values(nelem, myid.id);
+  for (int iter = 0; iter < 10; ++iter) {
+    dart_gptr_t gptr;
+    int * addr = reinterpret_cast<int *>(
+                   team_alloc(team, nelem * sizeof(int), &gptr));
+    ASSERT_NE_U(nullptr, addr);
+
+    // put to the right neighbor without waiting for completion
+    dart_gptr_setunit(&gptr, DART_TEAM_UNIT_ID((myid.id + 1) % team_size));
+    ASSERT_EQ_U(DART_OK,
+                dart_put(gptr, values.data(), nelem,
+                         DART_TYPE_INT, DART_TYPE_INT));
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+
+    // the same range is handed out again, the puts to the released
+    // allocation must not overwrite its contents
+    dart_gptr_t gptr_new;
+    int * addr_new = reinterpret_cast<int *>(
+                       team_alloc(team, nelem * sizeof(int), &gptr_new));
+    ASSERT_EQ_U(addr, addr_new);
+    for (size_t i = 0; i < nelem; ++i) {
+      addr_new[i] = -1;
+    }
+    dart_barrier(team);
+    EXPECT_EQ_U(nelem, static_cast<size_t>(
+                         std::count(addr_new, addr_new + nelem, -1)));
+    dart_barrier(team);
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_new));
+  }
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
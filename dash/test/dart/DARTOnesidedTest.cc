@@ -3,6 +3,15 @@
 
 #include <dash/Array.h>
 #include <dash/Onesided.h>
+#include <dash/Aggregation.h>
+
+#include <dash/dart/if/dart_config.h>
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <string>
+#include <vector>
 
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
@@ -377,6 +386,63 @@ TEST_F(DARTOnesidedTest, BlockedStridedToStrided) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedGetReuseType) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t stride            = 3;
+  constexpr size_t max_blocks        = num_elem_per_unit / stride;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = dash::myid() * 1000 + i;
+  }
+
+  dash::barrier();
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  // the MPI type of a strided type is created once per number of blocks
+  // and shared by all transfers using it
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+  std::vector<int> buf1(max_blocks);
+  std::vector<int> buf2(max_blocks);
+  for (int rep = 0; rep < 2; ++rep) {
+    for (size_t num_blocks = 1; num_blocks <= max_blocks; num_blocks += 3) {
+      std::fill(buf1.begin(), buf1.end(), -1);
+      std::fill(buf2.begin(), buf2.end(), -1);
+      dart_handle_t handles[2];
+      ASSERT_EQ_U(DART_OK,
+                  dart_get_handle(buf1.data(), gptr, num_blocks,
+                                  new_type, DART_TYPE_INT, &handles[0]));
+      ASSERT_EQ_U(DART_OK,
+                  dart_get_handle(buf2.data(), gptr, num_blocks,
+                                  new_type, DART_TYPE_INT, &handles[1]));
+      ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+      for (size_t i = 0; i < max_blocks; ++i) {
+        int expected = (i < num_blocks)
+                         ? static_cast<int>(neighbor * 1000 + i * stride)
+                         : -1;
+        ASSERT_EQ_U(expected, buf1[i]);
+        ASSERT_EQ_U(expected, buf2[i]);
+      }
+    }
+  }
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
+
+
 TEST_F(DARTOnesidedTest, IndexedGetSimple) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -630,3 +696,395 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, AggregatedPutAccumulate) {
+  typedef int value_t;
+  const size_t block_size = 100;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), 0);
+  array.barrier();
+
+  dart_unit_t right   = (dash::myid() + 1) % dash::size();
+  dart_unit_t left    = (dash::myid() + dash::size() - 1) % dash::size();
+  size_t      g_right = right * block_size;
+  value_t     one     = 1;
+  {
+    dash::AggregationScope aggregate;
+    for (size_t i = 0; i < block_size; ++i) {
+      array[g_right + i] = dash::myid() * 1000 + i;
+    }
+    // overwrite a buffered put
+    array[g_right] = -1;
+    // reads observe buffered puts
+    ASSERT_EQ_U(-1, static_cast<value_t>(array[g_right]));
+    array[g_right] = dash::myid() * 1000;
+    // accumulates to the same elements are applied twice
+    for (int rep = 0; rep < 2; ++rep) {
+      for (size_t i = 0; i < block_size; ++i) {
+        dart_accumulate((array.begin() + g_right + i).dart_gptr(),
+                        &one, 1, DART_TYPE_INT, DART_OP_SUM);
+      }
+    }
+  }
+  array.barrier();
+
+  for (size_t i = 0; i < block_size; ++i) {
+    ASSERT_EQ_U(static_cast<value_t>(left * 1000 + i + 2),
+                array.local[i]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, PutNotify) {
+  typedef int value_t;
+  const size_t block_size = 10;
+  const int    num_rounds = 20;
+  const int    data_id    = 0;
+  const int    ack_id     = 1;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dart_team_t team = array.team().dart_id();
+
+  int32_t flag = 1;
+  ASSERT_EQ_U(DART_OK, dart_notify_test(team, data_id, 1, &flag));
+  ASSERT_EQ_U(0, flag);
+  array.barrier();
+
+  dart_unit_t right   = (dash::myid() + 1) % dash::size();
+  dart_unit_t left    = (dash::myid() + dash::size() - 1) % dash::size();
+  dart_gptr_t g_right = (array.begin() + right * block_size).dart_gptr();
+  dart_gptr_t g_left  = (array.begin() + left * block_size).dart_gptr();
+
+  value_t values[block_size];
+  for (int r = 0; r < num_rounds; ++r) {
+    for (size_t i = 0; i < block_size; ++i) {
+      values[i] = dash::myid() * 1000 + r * block_size + i;
+    }
+    // send the next block to the right neighbor ...
+    ASSERT_EQ_U(DART_OK,
+                dart_put_notify(g_right, values, block_size,
+                                DART_TYPE_INT, DART_TYPE_INT, data_id));
+    // ... and wait for the block of the left neighbor
+    ASSERT_EQ_U(DART_OK, dart_notify_wait(team, data_id, 1));
+    for (size_t i = 0; i < block_size; ++i) {
+      ASSERT_EQ_U(static_cast<value_t>(left * 1000 + r * block_size + i),
+                  array.local[i]);
+    }
+    // acknowledge the block and wait until the right neighbor received
+    // the previous one
+    ASSERT_EQ_U(DART_OK,
+                dart_put_notify(g_left, NULL, 0,
+                                DART_TYPE_INT, DART_TYPE_INT, ack_id));
+    ASSERT_EQ_U(DART_OK, dart_notify_wait(team, ack_id, 1));
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_notify_test(team, data_id, 1, &flag));
+  ASSERT_EQ_U(0, flag);
+  array.barrier();
+}
+
+namespace {
+
+/**
+ * Concurrently updates values on the first unit of \c team with atomic
+ * operations from all units in the team and validates the results.
+ */
+void atomics_stress(dart_team_t team)
+{
+  const int num_iter = 1000;
+  size_t    team_size;
+  dart_team_unit_t myid;
+  ASSERT_EQ_U(DART_OK, dart_team_size(team, &team_size));
+  ASSERT_EQ_U(DART_OK, dart_team_myid(team, &myid));
+
+  // counter incremented by fetch-and-op, counter incremented by
+  // compare-and-swap, bitwise xor, minimum
+  dart_gptr_t gptr, gptr_dbl;
+  ASSERT_EQ_U(DART_OK,
+              dart_team_memalloc_aligned(team, 4, DART_TYPE_LONG, &gptr));
+  ASSERT_EQ_U(DART_OK,
+              dart_team_memalloc_aligned(team, 1, DART_TYPE_DOUBLE,
+                                         &gptr_dbl));
+  dart_gptr_t gptr_local = gptr;
+  dart_gptr_setunit(&gptr_local, myid);
+  long * lvalues;
+  ASSERT_EQ_U(DART_OK,
+              dart_gptr_getaddr(gptr_local, reinterpret_cast<void **>(
+                                              &lvalues)));
+  lvalues[0] = 0;
+  lvalues[1] = 0;
+  lvalues[2] = 0;
+  lvalues[3] = LONG_MAX;
+  gptr_local = gptr_dbl;
+  dart_gptr_setunit(&gptr_local, myid);
+  double * ldbl;
+  ASSERT_EQ_U(DART_OK,
+              dart_gptr_getaddr(gptr_local, reinterpret_cast<void **>(
+                                              &ldbl)));
+  *ldbl = 0.0;
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+  dart_gptr_t g_fetch = gptr;
+  dart_gptr_t g_cas   = gptr;
+  dart_gptr_t g_xor   = gptr;
+  dart_gptr_t g_min   = gptr;
+  dart_gptr_incaddr(&g_cas, 1 * sizeof(long));
+  dart_gptr_incaddr(&g_xor, 2 * sizeof(long));
+  dart_gptr_incaddr(&g_min, 3 * sizeof(long));
+
+  long   one  = 1;
+  double half = 0.5;
+  long   last = -1;
+  for (int i = 0; i < num_iter; ++i) {
+    // fetched values are unique, hence increasing on every unit
+    long prev;
+    ASSERT_EQ_U(DART_OK,
+                dart_fetch_and_op(g_fetch, &one, &prev,
+                                  DART_TYPE_LONG, DART_OP_SUM));
+    ASSERT_EQ_U(DART_OK, dart_flush(g_fetch));
+    ASSERT_GT_U(prev, last);
+    last = prev;
+
+    long cur;
+    ASSERT_EQ_U(DART_OK,
+                dart_fetch_and_op(g_cas, &one, &cur,
+                                  DART_TYPE_LONG, DART_OP_NO_OP));
+    ASSERT_EQ_U(DART_OK, dart_flush(g_cas));
+    while (true) {
+      long next = cur + 1;
+      long result;
+      ASSERT_EQ_U(DART_OK,
+                  dart_compare_and_swap(g_cas, &next, &cur, &result,
+                                        DART_TYPE_LONG));
+      ASSERT_EQ_U(DART_OK, dart_flush(g_cas));
+      if (result == cur) break;
+      cur = result;
+    }
+
+    long value = (static_cast<long>(myid.id) << 20) ^ (i * 7919L);
+    ASSERT_EQ_U(DART_OK,
+                dart_accumulate(g_xor, &value, 1,
+                                DART_TYPE_LONG, DART_OP_BXOR));
+    long min = myid.id * num_iter + i + 1;
+    ASSERT_EQ_U(DART_OK,
+                dart_accumulate(g_min, &min, 1,
+                                DART_TYPE_LONG, DART_OP_MIN));
+    ASSERT_EQ_U(DART_OK,
+                dart_accumulate(gptr_dbl, &half, 1,
+                                DART_TYPE_DOUBLE, DART_OP_SUM));
+  }
+  long expected_xor = 0;
+  for (size_t u = 0; u < team_size; ++u) {
+    for (int i = 0; i < num_iter; ++i) {
+      expected_xor ^= (static_cast<long>(u) << 20) ^ (i * 7919L);
+    }
+  }
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr_dbl));
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+  long   values[4];
+  double dbl;
+  ASSERT_EQ_U(DART_OK,
+              dart_get_blocking(values, gptr, 4,
+                                DART_TYPE_LONG, DART_TYPE_LONG));
+  ASSERT_EQ_U(DART_OK,
+              dart_get_blocking(&dbl, gptr_dbl, 1,
+                                DART_TYPE_DOUBLE, DART_TYPE_DOUBLE));
+  long total = static_cast<long>(team_size) * num_iter;
+  ASSERT_EQ_U(total, values[0]);
+  ASSERT_EQ_U(total, values[1]);
+  ASSERT_EQ_U(expected_xor, values[2]);
+  ASSERT_EQ_U(1, values[3]);
+  ASSERT_EQ_U(total * 0.5, dbl);
+
+  ASSERT_EQ_U(DART_OK, dart_barrier(team));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_dbl));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+}
+
+} // namespace
+
+TEST_F(DARTOnesidedTest, LocalAtomicsStress) {
+  dart_config_t * config;
+  dart_config(&config);
+  int local_atomics     = config->local_atomics;
+  config->local_atomics = 1;
+
+  // processor atomics are used if all units share the node
+  dart_group_t group;
+  dart_team_t  team_all;
+  ASSERT_EQ_U(DART_OK, dart_team_get_group(DART_TEAM_ALL, &group));
+  ASSERT_EQ_U(DART_OK, dart_team_create(DART_TEAM_ALL, group, &team_all));
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&group));
+  // ... and in single unit teams
+  dart_team_t team_self = team_all;
+  if (dash::size() > 1) {
+    team_self = dash::Team::All().split(dash::size()).dart_id();
+  }
+  config->local_atomics = local_atomics;
+
+  atomics_stress(team_all);
+  atomics_stress(team_self);
+
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team_all));
+}
+
+TEST_F(DARTOnesidedTest, GetvPutv) {
+  typedef int value_t;
+  const size_t block_size = 60;
+  const size_t num_blocks = 10;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), -1);
+  array.barrier();
+
+  // blocks of increasing size at every sixth element of the right
+  // neighbor and the calling unit in reverse order
+  dart_unit_t right = (dash::myid() + 1) % dash::size();
+  std::vector<dart_gptr_t>    gptrs;
+  std::vector<size_t>         nelem;
+  std::vector<value_t>        src(2 * num_blocks * 5);
+  std::vector<value_t>        dst(src.size(), 0);
+  std::vector<const void *>   src_ptrs;
+  std::vector<void *>         dst_ptrs;
+  std::vector<dart_unit_t>    units = { right };
+  if (right != dash::myid()) {
+    units.push_back(dash::myid());
+  }
+  size_t pos = 0;
+  for (int b = num_blocks - 1; b >= 0; --b) {
+    for (dart_unit_t unit : units) {
+      size_t gidx = unit * block_size + b * 6;
+      gptrs.push_back((array.begin() + gidx).dart_gptr());
+      nelem.push_back(b % 5 + 1);
+      src_ptrs.push_back(&src[pos]);
+      dst_ptrs.push_back(&dst[pos]);
+      for (size_t e = 0; e < nelem.back(); ++e) {
+        src[pos + e] = dash::myid() * 1000 + b * 6 + e;
+      }
+      pos += nelem.back();
+    }
+  }
+  ASSERT_EQ_U(DART_OK,
+              dart_putv(gptrs.data(), src_ptrs.data(), nelem.data(),
+                        gptrs.size(), DART_TYPE_INT));
+  array.barrier();
+
+  // every unit has received blocks from itself and its left neighbor
+  for (size_t b = 0; b < num_blocks; ++b) {
+    for (size_t e = 0; e < 6; ++e) {
+      value_t value = array.local[b * 6 + e];
+      if (e <= b % 5) {
+        ASSERT_EQ_U(static_cast<value_t>(b * 6 + e), value % 1000);
+      } else {
+        ASSERT_EQ_U(-1, value);
+      }
+    }
+  }
+
+  ASSERT_EQ_U(DART_OK,
+              dart_getv(dst_ptrs.data(), gptrs.data(), nelem.data(),
+                        gptrs.size(), DART_TYPE_INT));
+  for (size_t i = 0; i < gptrs.size(); ++i) {
+    const value_t *block = static_cast<const value_t *>(dst_ptrs[i]);
+    for (size_t e = 0; e < nelem[i]; ++e) {
+      ASSERT_EQ_U(src[static_cast<const value_t *>(src_ptrs[i])
+                      - src.data() + e] % 1000,
+                  block[e] % 1000);
+    }
+  }
+  array.barrier();
+}
+
+namespace {
+
+/**
+ * Number of threads of the calling process or 0 if unknown.
+ */
+size_t num_process_threads()
+{
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "Threads:") == 0) {
+      return std::stoul(line.substr(8));
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
+TEST_F(DARTOnesidedTest, ProgressThread) {
+  if (!dash::is_multithreaded()) {
+    SKIP_TEST_MSG("progress thread requires MPI_THREAD_MULTIPLE");
+  }
+  // restart DART with the progress thread enabled
+  dash::finalize();
+  size_t num_threads = num_process_threads();
+
+  dart_config_t * config;
+  dart_config(&config);
+  int progress_thread     = config->progress_thread;
+  config->progress_thread = 1;
+  dart_thread_support_level_t provided;
+  ASSERT_EQ_U(DART_OK,
+              dart_init_thread(&TESTENV::argc, &TESTENV::argv, &provided));
+  config->progress_thread = progress_thread;
+  if (num_threads > 0) {
+    EXPECT_EQ_U(num_threads + 1, num_process_threads());
+  }
+
+  dart_team_unit_t myid;
+  size_t           size;
+  dart_team_myid(DART_TEAM_ALL, &myid);
+  dart_team_size(DART_TEAM_ALL, &size);
+  dart_team_unit_t left  = DART_TEAM_UNIT_ID((myid.id + size - 1) % size);
+  dart_team_unit_t right = DART_TEAM_UNIT_ID((myid.id + 1) % size);
+
+  // puts to the first half, gets from the second half
+  const size_t nelem = 256 * 1024;
+  dart_gptr_t  gptr;
+  ASSERT_EQ_U(DART_OK,
+              dart_team_memalloc_aligned(
+                DART_TEAM_ALL, 2 * nelem, DART_TYPE_INT, &gptr));
+  int * local;
+  dart_gptr_setunit(&gptr, myid);
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&local));
+  std::fill(local, local + nelem, -1);
+  std::fill(local + nelem, local + 2 * nelem, 1000 + myid.id);
+  dart_barrier(DART_TEAM_ALL);
+
+  std::vector<int> src(nelem, myid.id);
+  std::vector<int> dst(nelem, -1);
+  dart_handle_t    handles[2];
+  dart_gptr_t      gptr_right = gptr;
+  dart_gptr_t      gptr_left  = gptr;
+  dart_gptr_setunit(&gptr_right, right);
+  dart_gptr_setunit(&gptr_left,  left);
+  gptr_left.addr_or_offs.offset += nelem * sizeof(int);
+  ASSERT_EQ_U(DART_OK,
+              dart_put_handle(gptr_right, src.data(), nelem,
+                              DART_TYPE_INT, DART_TYPE_INT, &handles[0]));
+  ASSERT_EQ_U(DART_OK,
+              dart_get_handle(dst.data(), gptr_left, nelem,
+                              DART_TYPE_INT, DART_TYPE_INT, &handles[1]));
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+  dart_barrier(DART_TEAM_ALL);
+
+  EXPECT_EQ_U(nelem, static_cast<size_t>(
+                       std::count(local, local + nelem, left.id)));
+  EXPECT_EQ_U(nelem, static_cast<size_t>(
+                       std::count(dst.begin(), dst.end(), 1000 + left.id)));
+
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+
+  // the progress thread is joined on exit
+  EXPECT_EQ_U(DART_OK, dart_exit());
+  if (num_threads > 0) {
+    EXPECT_EQ_U(num_threads, num_process_threads());
+  }
+
+  dash::init(&TESTENV::argc, &TESTENV::argv);
+}
@@ -12,8 +12,14 @@
 #include <dash/allocator/EpochSynchronizedAllocator.h>
 #include <dash/util/TeamLocality.h>
 
+#include <dash/dart/if/dart_globmem.h>
+
 #include <mpi.h>
 
+#include <future>
+#include <thread>
+#include <vector>
+
 #if defined(DASH_ENABLE_OPENMP)
 #include <omp.h>
 #endif
@@ -374,4 +380,51 @@ TEST_F(ThreadsafetyTest, ConcurrentAlgorithm) {
 #endif // !defined(DASH_ENABLE_OPENMP)
 }
 
+TEST_F(ThreadsafetyTest, LocalAllocThreadCaches) {
+  if (!dash::is_multithreaded()) {
+    SKIP_TEST_MSG("requires support for multi-threading");
+  }
+
+  // blocks of all sizes are freed into the thread caches
+  auto alloc_free = []() {
+    std::vector<dart_gptr_t> gptrs;
+    for (size_t nbytes = 8; nbytes <= 32 * 1024; nbytes *= 2) {
+      for (int i = 0; i < 64; ++i) {
+        dart_gptr_t gptr;
+        ASSERT_EQ_U(DART_OK, dart_memalloc(nbytes, DART_TYPE_BYTE, &gptr));
+        gptrs.push_back(gptr);
+      }
+    }
+    for (auto & gptr : gptrs) {
+      ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+    }
+  };
+  // 12 MiB of the default pool size of 16 MiB
+  auto alloc_large = []() {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(12 * 1024 * 1024, DART_TYPE_BYTE, &gptr));
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+  };
+
+  // cached blocks of exited threads are returned
+  for (int t = 0; t < 64; ++t) {
+    std::thread(alloc_free).join();
+  }
+  alloc_large();
+
+  // cached blocks of running threads are reclaimed
+  std::promise<void> freed, done;
+  std::thread thread([&]() {
+    alloc_free();
+    freed.set_value();
+    done.get_future().wait();
+  });
+  freed.get_future().wait();
+  alloc_large();
+  done.set_value();
+  thread.join();
+}
+
 #endif // DASH_ENABLE_THREADSUPPORT
@@ -1,11 +1,13 @@
 
 #include "HaloTest.h"
 
+#include <dash/Array.h>
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
 
 #include <iostream>
+#include <memory>
 
 using namespace dash;
 
@@ -886,3 +888,435 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMix3D)
   }
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, HaloMatrixWrapperExchange2D)
+{
+  using PatternT = dash::Pattern<2>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 2, index_type, PatternT>;
+  using DistSpecT = dash::DistributionSpec<2>;
+  using TeamSpecT = dash::TeamSpec<2>;
+  using SizeSpecT = dash::SizeSpec<2>;
+  using CycleSpecT = CycleSpec<2>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 8>;
+
+  DistSpecT dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpecT team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  MatrixT matrix_halo(pattern);
+
+  CycleSpecT cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+  StencilSpecT stencil_spec({
+      StencilT(-1,-1), StencilT(-1, 0), StencilT(-1, 1),
+      StencilT( 0,-1),                  StencilT( 0, 1),
+      StencilT( 1,-1), StencilT( 1, 0), StencilT( 1, 1)});
+
+  auto value = [](const std::array<index_type, 2>& coords, int iter) {
+    return static_cast<long>(coords[0]) * 1000 + coords[1] + iter * 1000000;
+  };
+
+  for(auto exchange : { HaloExchange::GET, HaloExchange::PUSH }) {
+    HaloMatrixWrapper<MatrixT,StencilSpecT> halo_wrapper(
+      matrix_halo, stencil_spec, cycle_spec, exchange);
+    EXPECT_EQ_U(exchange, halo_wrapper.exchange());
+
+    auto local = matrix_halo.local;
+    for(int iter = 0; iter < 4; ++iter) {
+      for(index_type i = 0; i < local.extent(0); ++i) {
+        for(index_type j = 0; j < local.extent(1); ++j) {
+          local[i][j] = value(pattern.global({ i, j }), iter);
+        }
+      }
+      // with push-based exchanges, neighbours synchronize in update:
+      if(exchange == HaloExchange::GET)
+        matrix_halo.barrier();
+
+      halo_wrapper.update();
+
+      for(const auto& region : halo_wrapper.halo_block().halo_regions()) {
+        const auto* halo_pos = halo_wrapper.halo_memory().pos_at(region.index());
+        auto it_end = region.end();
+        for(auto it = region.begin(); it != it_end; ++it) {
+          ASSERT_EQ_U(value(it.gcoords(), iter), *(halo_pos + it.rpos()));
+        }
+      }
+      if(exchange == HaloExchange::GET)
+        matrix_halo.barrier();
+    }
+  }
+
+  // get-based exchange by default, push-based exchange is opt-in
+  HaloMatrixWrapper<MatrixT,StencilSpecT> halo_wrapper(
+    matrix_halo, stencil_spec, cycle_spec);
+  EXPECT_EQ_U(HaloExchange::GET, halo_wrapper.exchange());
+
+  HaloMatrixWrapper<MatrixT,StencilSpecT> halo_wrapper_auto(
+    matrix_halo, stencil_spec, cycle_spec, HaloExchange::AUTO);
+  EXPECT_TRUE_U(halo_wrapper_auto.exchange() == HaloExchange::GET ||
+                halo_wrapper_auto.exchange() == HaloExchange::PUSH);
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperNotifySlots)
+{
+  using PatternT = dash::Pattern<2>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 2, index_type, PatternT>;
+  using DistSpecT = dash::DistributionSpec<2>;
+  using TeamSpecT = dash::TeamSpec<2>;
+  using SizeSpecT = dash::SizeSpec<2>;
+  using CycleSpecT = CycleSpec<2>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 4>;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT,StencilSpecT>;
+
+  DistSpecT dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpecT team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  MatrixT matrix_halo(pattern);
+  dash::fill(matrix_halo.begin(), matrix_halo.end(), 1);
+  dash::Team::All().barrier();
+
+  CycleSpecT cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+  StencilSpecT stencil_spec({ StencilT(-1, 0), StencilT(1, 0),
+                              StencilT( 0,-1), StencilT(0, 1) });
+
+  // every push-based exchange uses its own notification IDs
+  std::vector<std::unique_ptr<HaloWrapperT>> halo_wrappers;
+  for(int i = 0; i < dash::internal::HaloNotifySlots; ++i) {
+    halo_wrappers.emplace_back(new HaloWrapperT(
+      matrix_halo, stencil_spec, cycle_spec, HaloExchange::PUSH));
+  }
+  EXPECT_THROW(
+    HaloWrapperT(matrix_halo, stencil_spec, cycle_spec, HaloExchange::PUSH),
+    dash::exception::RuntimeError);
+
+  // notification IDs of destroyed exchanges are reused
+  halo_wrappers.erase(halo_wrappers.begin());
+  halo_wrappers.emplace_back(new HaloWrapperT(
+    matrix_halo, stencil_spec, cycle_spec, HaloExchange::PUSH));
+  for(auto& halo_wrapper : halo_wrappers) {
+    halo_wrapper->update();
+    auto it_end = halo_wrapper->bend();
+    for(auto it = halo_wrapper->bbegin(); it != it_end; ++it) {
+      for(std::size_t i = 0; i < stencil_spec.num_stencil_points(); ++i)
+        ASSERT_EQ_U(1, it.value_at(i));
+    }
+  }
+  halo_wrappers.clear();
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperDeep2D)
+{
+  using PatternT = dash::Pattern<2>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 2, index_type, PatternT>;
+  using DistSpecT = dash::DistributionSpec<2>;
+  using TeamSpecT = dash::TeamSpec<2>;
+  using SizeSpecT = dash::SizeSpec<2>;
+  using CycleSpecT = CycleSpec<2>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 4>;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT,StencilSpecT>;
+
+  const int num_iter = 7;
+
+  DistSpecT dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpecT team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  CycleSpecT cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+  StencilSpecT stencil_spec({
+                     StencilT(-1, 0),
+      StencilT( 0,-1),                  StencilT( 0, 1),
+                     StencilT( 1, 0)});
+
+  auto kernel = [](long center, long n0, long n1, long n2, long n3) {
+    return (center + 2 * n0 + 3 * n1 + 5 * n2 + 7 * n3) % 1000003;
+  };
+
+  // local values after num_iter iterations with halo exchanges in every
+  // iteration
+  std::vector<long> expected;
+  for(auto exchange : { HaloExchange::GET, HaloExchange::PUSH }) {
+    for(std::size_t depth : { 1, 3 }) {
+      MatrixT matrix_1(pattern);
+      MatrixT matrix_2(pattern);
+      for(index_type i = 0; i < matrix_1.local.extent(0); ++i) {
+        for(index_type j = 0; j < matrix_1.local.extent(1); ++j) {
+          auto gcoords = pattern.global({ i, j });
+          matrix_1.local[i][j] = gcoords[0] * 1000 + gcoords[1];
+          matrix_2.local[i][j] = 0;
+        }
+      }
+      dash::Team::All().barrier();
+
+      HaloWrapperT halo_1(matrix_1, stencil_spec, cycle_spec, exchange, depth);
+      HaloWrapperT halo_2(matrix_2, stencil_spec, cycle_spec, exchange, depth);
+      EXPECT_EQ_U(depth, halo_1.depth());
+      EXPECT_EQ_U(0, halo_1.valid_depth());
+
+      auto* current = &halo_1;
+      auto* next    = &halo_2;
+      for(int iter = 0; iter < num_iter; ++iter) {
+        if(current->valid_depth() == 0) {
+          current->update();
+          EXPECT_EQ_U(depth, current->valid_depth());
+        }
+        auto* next_local = next->matrix().lbegin();
+        auto  it_end     = current->end();
+        for(auto it = current->begin(); it != it_end; ++it) {
+          next_local[it.lpos()] = kernel(
+            *it, it.value_at(0), it.value_at(1), it.value_at(2), it.value_at(3));
+        }
+        auto* next_halo = next->halo_memory().pos_start();
+        auto  ith_end   = current->hend();
+        for(auto it = current->hbegin(); it != ith_end; ++it) {
+          next_halo[it.hpos()] = kernel(
+            *it, it.value_at(0), it.value_at(1), it.value_at(2), it.value_at(3));
+        }
+        if(depth == 1)
+          EXPECT_TRUE_U(current->hbegin() == ith_end);
+
+        next->set_valid_depth(current->valid_depth() - 1);
+        std::swap(current, next);
+        if(exchange == HaloExchange::GET)
+          dash::Team::All().barrier();
+      }
+
+      const auto& result = current->matrix();
+      if(expected.empty()) {
+        expected.assign(result.lbegin(), result.lend());
+        continue;
+      }
+      ASSERT_EQ_U(expected.size(), result.local_size());
+      for(std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ_U(expected[i], result.lbegin()[i]);
+      dash::Team::All().barrier();
+    }
+  }
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperComputeOverlapped2D)
+{
+  using PatternT = dash::Pattern<2>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 2, index_type, PatternT>;
+  using DistSpecT = dash::DistributionSpec<2>;
+  using TeamSpecT = dash::TeamSpec<2>;
+  using SizeSpecT = dash::SizeSpec<2>;
+  using CycleSpecT = CycleSpec<2>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 8>;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT,StencilSpecT>;
+
+  const int num_iter = 5;
+
+  DistSpecT dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpecT team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  CycleSpecT cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+  StencilSpecT stencil_spec({
+      StencilT(-1,-1), StencilT(-1, 0), StencilT(-1, 1),
+      StencilT( 0,-1),                  StencilT( 0, 1),
+      StencilT( 1,-1), StencilT( 1, 0), StencilT( 1, 1)});
+
+  auto stencil_op = [](long center, const std::array<long, 8>& values) {
+    long result = center;
+    for(std::size_t i = 0; i < values.size(); ++i)
+      result += static_cast<long>(i + 2) * values[i];
+    return result % 1000003;
+  };
+
+  auto init = [&](MatrixT& matrix_1, MatrixT& matrix_2) {
+    for(index_type i = 0; i < matrix_1.local.extent(0); ++i) {
+      for(index_type j = 0; j < matrix_1.local.extent(1); ++j) {
+        auto gcoords = pattern.global({ i, j });
+        matrix_1.local[i][j] = gcoords[0] * 1000 + gcoords[1];
+        matrix_2.local[i][j] = 0;
+      }
+    }
+  };
+
+  // reference with halo update, inner and boundary elements in sequence
+  std::vector<long> expected;
+  {
+    MatrixT matrix_1(pattern);
+    MatrixT matrix_2(pattern);
+    init(matrix_1, matrix_2);
+    dash::Team::All().barrier();
+
+    HaloWrapperT halo_1(matrix_1, stencil_spec, cycle_spec, HaloExchange::GET);
+    HaloWrapperT halo_2(matrix_2, stencil_spec, cycle_spec, HaloExchange::GET);
+    auto* current = &halo_1;
+    auto* next    = &halo_2;
+    for(int iter = 0; iter < num_iter; ++iter) {
+      current->update();
+      auto* next_local = next->matrix().lbegin();
+      auto  it_end     = current->end();
+      for(auto it = current->begin(); it != it_end; ++it) {
+        std::array<long, 8> values;
+        for(std::size_t i = 0; i < values.size(); ++i)
+          values[i] = it.value_at(i);
+        next_local[it.lpos()] = stencil_op(*it, values);
+      }
+      std::swap(current, next);
+      dash::Team::All().barrier();
+    }
+    expected.assign(current->matrix().lbegin(), current->matrix().lend());
+  }
+
+  for(auto exchange : { HaloExchange::GET, HaloExchange::PUSH }) {
+    for(std::size_t depth : { 1, 2 }) {
+      MatrixT matrix_1(pattern);
+      MatrixT matrix_2(pattern);
+      init(matrix_1, matrix_2);
+
+      HaloWrapperT halo_1(matrix_1, stencil_spec, cycle_spec, exchange, depth);
+      HaloWrapperT halo_2(matrix_2, stencil_spec, cycle_spec, exchange, depth);
+      auto* current = &halo_1;
+      auto* next    = &halo_2;
+      for(int iter = 0; iter < num_iter; ++iter)
+        dash::compute_overlapped(current, next, stencil_op);
+
+      const auto& result = current->matrix();
+      for(std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ_U(expected[i], result.lbegin()[i]);
+      dash::Team::All().barrier();
+    }
+  }
+
+  // result in matrix, halo regions are updated in every iteration
+  {
+    MatrixT matrix_1(pattern);
+    MatrixT matrix_2(pattern);
+    init(matrix_1, matrix_2);
+
+    HaloWrapperT halo_1(matrix_1, stencil_spec, cycle_spec, HaloExchange::PUSH);
+    HaloWrapperT halo_2(matrix_2, stencil_spec, cycle_spec, HaloExchange::PUSH);
+    for(int iter = 0; iter < num_iter; ++iter) {
+      if(iter % 2 == 0)
+        halo_1.compute_overlapped(dash::execution::seq, stencil_op, matrix_2);
+      else
+        halo_2.compute_overlapped(dash::execution::seq, stencil_op, matrix_1);
+    }
+    for(std::size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ_U(expected[i], matrix_2.lbegin()[i]);
+    dash::Team::All().barrier();
+  }
+}
+
+template <typename PatternT>
+void test_stencil_operator_3d(const PatternT& pattern)
+{
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 3, index_type, PatternT>;
+  using StencilT = Stencil<3>;
+  using StencilSpecT = StencilSpec<3, 6>;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT,StencilSpecT>;
+
+  StencilSpecT stencil_spec({
+      StencilT(-1, 0, 0), StencilT(1, 0, 0),
+      StencilT( 0,-1, 0), StencilT(0, 1, 0),
+      StencilT( 0, 0,-1), StencilT(0, 0, 1)});
+
+  auto stencil_op = [](long center, const std::array<long, 6>& values) {
+    long result = center;
+    for(std::size_t i = 0; i < values.size(); ++i)
+      result += static_cast<long>(i + 2) * values[i];
+    return result % 1000003;
+  };
+
+  MatrixT matrix(pattern);
+  for(index_type i = 0; i < matrix.local.extent(0); ++i) {
+    for(index_type j = 0; j < matrix.local.extent(1); ++j) {
+      for(index_type k = 0; k < matrix.local.extent(2); ++k) {
+        auto gcoords = pattern.global({ i, j, k });
+        matrix.local[i][j][k] = (gcoords[0] * 100 + gcoords[1]) * 100
+                                + gcoords[2];
+      }
+    }
+  }
+  dash::Team::All().barrier();
+
+  HaloWrapperT halo(matrix, stencil_spec, CycleSpec<3>(), HaloExchange::GET);
+  const auto& stencil_operator = halo.stencil_operator();
+  const auto& view_inner       = halo.view_inner_local();
+  std::vector<long> input(matrix.lbegin(), matrix.lend());
+
+  // single sweep on the inner elements against the iterator
+  std::vector<long> expected(input);
+  auto it_iend = halo.iend();
+  for(auto it = halo.ibegin(); it != it_iend; ++it) {
+    std::array<long, 6> values;
+    for(std::size_t i = 0; i < values.size(); ++i)
+      values[i] = it.value_at(i);
+    expected[it.lpos()] = stencil_op(*it, values);
+  }
+  for(auto policy_par : { false, true }) {
+    std::vector<long> result(input);
+    if(policy_par)
+      stencil_operator.apply(dash::execution::par, input.data(),
+                             result.data(), view_inner, stencil_op);
+    else
+      stencil_operator.apply(dash::execution::seq, input.data(),
+                             result.data(), view_inner, stencil_op);
+    for(std::size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ_U(expected[i], result[i]);
+  }
+
+  // temporally blocked sweeps against single sweeps on shrinking regions
+  const std::size_t sweeps = 3;
+  std::vector<long> ref_0(input);
+  std::vector<long> ref_1(input);
+  auto region = view_inner;
+  for(std::size_t t = 0; t < sweeps; ++t) {
+    stencil_operator.apply(dash::execution::seq, ref_0.data(), ref_1.data(),
+                           region, stencil_op);
+    std::swap(ref_0, ref_1);
+    for(dim_t d = 0; d < 3; ++d) {
+      region.resize_dim(d, region.offset(d) + 1,
+                        region.extent(d) > 2 ? region.extent(d) - 2 : 0);
+    }
+  }
+  std::vector<long> buf_0(input);
+  std::vector<long> buf_1(input);
+  auto* result = stencil_operator.apply(dash::execution::seq, buf_0.data(),
+                                        buf_1.data(), view_inner, sweeps,
+                                        stencil_op);
+  EXPECT_EQ_U(buf_1.data(), result);
+  for(std::size_t i = 0; i < ref_0.size(); ++i)
+    ASSERT_EQ_U(ref_0[i], result[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperator3D)
+{
+  using PatternT = dash::Pattern<3>;
+  using PatternColT = dash::Pattern<3, dash::COL_MAJOR>;
+  using DistSpecT = dash::DistributionSpec<3>;
+  using TeamSpecT = dash::TeamSpec<3>;
+  using SizeSpecT = dash::SizeSpec<3>;
+
+  const auto ext = 40;
+
+  DistSpecT dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpecT team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext, ext, ext), dist_spec, team_spec,
+                   dash::Team::All());
+  PatternColT pattern_col(SizeSpecT(ext, ext, ext), dist_spec, team_spec,
+                          dash::Team::All());
+
+  test_stencil_operator_3d(pattern);
+  test_stencil_operator_3d(pattern_col);
+}
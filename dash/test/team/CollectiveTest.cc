@@ -0,0 +1,66 @@
+#include "CollectiveTest.h"
+
+#include <dash/Team.h>
+#include <dash/Collective.h>
+
+#include <utility>
+#include <vector>
+
+
+TEST_F(CollectiveTest, AlltoallBlocks)
+{
+  auto & team   = dash::Team::All();
+  auto   nunits = team.size();
+  auto   myid   = team.myid();
+
+  size_t nelem = 3;
+  std::vector<int> values(nunits * nelem);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      values[u * nelem + e] = myid * 1000 + u * 10 + e;
+    }
+  }
+  std::vector<int> recv_values(values.size());
+  dash::alltoall(values.data(), recv_values.data(), nelem, team);
+  // In-place:
+  dash::alltoall(values.data(), values.data(), nelem, team);
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      int exp = u * 1000 + myid * 10 + e;
+      EXPECT_EQ_U(exp, recv_values[u * nelem + e]);
+      EXPECT_EQ_U(exp, values[u * nelem + e]);
+    }
+  }
+}
+
+TEST_F(CollectiveTest, AlltoallBuckets)
+{
+  typedef std::pair<long, double> value_t;
+
+  auto & team   = dash::Team::All();
+  auto   nunits = team.size();
+  size_t myid   = team.myid();
+
+  // Bucket sizes differ by source and destination, some are empty:
+  std::vector<std::vector<value_t>> buckets(nunits);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < (myid + u) % 3; ++e) {
+      buckets[u].push_back(value_t(myid, 0.5 * e + u));
+    }
+  }
+  auto recv_buckets = dash::alltoall(buckets, team);
+  dash::alltoall_inplace(buckets, team);
+
+  ASSERT_EQ_U(nunits, recv_buckets.size());
+  ASSERT_EQ_U(nunits, buckets.size());
+  for (size_t u = 0; u < nunits; ++u) {
+    ASSERT_EQ_U((myid + u) % 3, recv_buckets[u].size());
+    ASSERT_EQ_U((myid + u) % 3, buckets[u].size());
+    for (size_t e = 0; e < recv_buckets[u].size(); ++e) {
+      value_t exp(u, 0.5 * e + myid);
+      EXPECT_EQ_U(exp, recv_buckets[u][e]);
+      EXPECT_EQ_U(exp, buckets[u][e]);
+    }
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__COLLECTIVE_TEST_H_
+#define DASH__TEST__COLLECTIVE_TEST_H_
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for collective operations like dash::alltoall
+ */
+class CollectiveTest : public dash::test::TestBase {
+protected:
+
+  CollectiveTest() {
+  }
+
+  virtual ~CollectiveTest() {
+  }
+
+};
+
+#endif // DASH__TEST__COLLECTIVE_TEST_H_
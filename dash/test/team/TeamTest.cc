@@ -3,6 +3,7 @@
 
 #include <dash/Team.h>
 #include <dash/Array.h>
+#include <dash/algorithm/Operation.h>
 #include <dash/Distribution.h>
 #include <dash/Dimensional.h>
 #include <dash/util/TeamLocality.h>
@@ -106,3 +107,37 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, NonblockingCollectives)
+{
+  auto & team = dash::Team::All();
+
+  double l_norm = 0.5 * (team.myid() + 1);
+  auto fut_norm = team.iallreduce(l_norm, dash::plus<double>());
+  auto fut_max  = team.iallreduce(static_cast<int>(team.myid()),
+                                  dash::max<int>());
+
+  std::vector<long> ids(team.size());
+  long myid = team.myid();
+  auto fut_ids = team.iallgather(&myid, ids.data(), 1);
+
+  std::array<char, 4> msg {{ 0, 0, 0, 0 }};
+  if (team.myid() == 0) {
+    msg = {{ 'd', 'a', 's', 'h' }};
+  }
+  auto fut_msg = team.ibcast(msg.data(), msg.size(), dash::team_unit_t(0));
+
+  fut_ids.wait();
+  fut_msg.wait();
+  EXPECT_EQ_U(0.25 * team.size() * (team.size() + 1), fut_norm.get());
+  EXPECT_EQ_U(static_cast<int>(team.size() - 1), fut_max.get());
+  for (size_t u = 0; u < team.size(); ++u) {
+    EXPECT_EQ_U(static_cast<long>(u), ids[u]);
+  }
+  EXPECT_EQ_U('d', msg[0]);
+  EXPECT_EQ_U('h', msg[3]);
+
+  auto fut_barrier = team.ibarrier();
+  while (!fut_barrier.test()) { }
+  EXPECT_TRUE_U(fut_barrier.test());
+}